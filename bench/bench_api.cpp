@@ -0,0 +1,346 @@
+/**
+ * VitaSuwayomi - API latency benchmark
+ * Drives SuwayomiClient end to end against bench/mock_suwayomi.py: large
+ * libraries, long chapter lists, chapter pages, global search, the extension
+ * catalog and a chapter download. Each scenario resizes the mock over
+ * /mock/config, then reports wall time, network wait, parse time (the rest),
+ * GraphQL requests and response bytes as one JSON line. --baseline compares
+ * against an earlier run and exits with 2 when a scenario regressed.
+ *
+ * Usage: python3 bench/mock_suwayomi.py &
+ *        bench_api [--server URL] [--iterations N] [--latency-ms N]
+ *                  [--bandwidth-kbps N] [--scenario NAME] [--out results.jsonl]
+ *                  [--baseline previous.jsonl] [--threshold PCT]
+ */
+
+#include "app/suwayomi_client.hpp"
+#include "utils/http_client.hpp"
+#include "utils/perf_trace.hpp"
+#include "platform/platform.hpp"
+
+#include <borealis.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace vitasuwayomi;
+
+struct Options {
+    std::string serverUrl = "http://127.0.0.1:4567";
+    std::string outPath;
+    std::string baselinePath;
+    std::string onlyScenario;
+    int iterations = 3;
+    int latencyMs = 0;
+    int bandwidthKbps = 0;
+    double thresholdPct = 15.0;
+};
+
+struct Scenario {
+    const char* name;
+    std::string mockConfig;            // Merged into /mock/config before the run
+    int expected;                      // Items a complete response holds
+    std::function<int()> run;          // Returns items received, -1 on failure
+    int extraRequests = 0;             // Non-GraphQL requests per run (page downloads)
+};
+
+struct ScenarioResult {
+    int items = 0;
+    int iterations = 0;
+    double wallMs = 0;
+    double minWallMs = 0;
+    double networkMs = 0;
+    double parseMs = 0;
+    double requests = 0;
+    double responseBytes = 0;
+    double serverRequests = 0;
+    bool ok = true;
+};
+
+// First number after "key": in a flat JSON object
+static double jsonNumber(const std::string& json, const std::string& key) {
+    std::string needle = "\"" + key + "\":";
+    size_t pos = json.find(needle);
+    if (pos == std::string::npos) return -1;
+    return strtod(json.c_str() + pos + needle.size(), nullptr);
+}
+
+static std::string jsonString(const std::string& json, const std::string& key) {
+    std::string needle = "\"" + key + "\":\"";
+    size_t pos = json.find(needle);
+    if (pos == std::string::npos) return "";
+    pos += needle.size();
+    size_t end = json.find('"', pos);
+    return end == std::string::npos ? "" : json.substr(pos, end - pos);
+}
+
+static bool configureMock(const Options& options, const std::string& scenarioConfig) {
+    std::string body = "{\"latencyMs\":" + std::to_string(options.latencyMs) +
+                       ",\"bandwidthKbps\":" + std::to_string(options.bandwidthKbps);
+    if (!scenarioConfig.empty()) body += "," + scenarioConfig;
+    body += "}";
+
+    HttpClient http;
+    http.setDefaultHeader("Content-Type", "application/json");
+    HttpResponse response = http.post(options.serverUrl + "/mock/config", body);
+    return response.success && response.statusCode == 200;
+}
+
+static double mockRequestCount(const Options& options) {
+    HttpClient http;
+    HttpResponse response = http.get(options.serverUrl + "/mock/stats");
+    if (!response.success || response.statusCode != 200) return -1;
+    return jsonNumber(response.body, "requests");
+}
+
+static ScenarioResult runScenario(const Options& options, const Scenario& scenario) {
+    SuwayomiClient& client = SuwayomiClient::getInstance();
+    ScenarioResult result;
+
+    // Warm-up run against this scenario's mock sizes (connection setup, mock
+    // response generation). Configuring again resets the mock's counters, and
+    // the client's stats are reset per iteration below.
+    configureMock(options, scenario.mockConfig);
+    client.clearResponseCache();
+    scenario.run();
+    configureMock(options, scenario.mockConfig);
+
+    for (int i = 0; i < options.iterations; i++) {
+        // Every iteration measures a cold fetch, as after a launch
+        client.clearResponseCache();
+        client.resetApiStats();
+
+        auto start = std::chrono::steady_clock::now();
+        int items = scenario.run();
+        double wallMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        SuwayomiClient::ApiStats stats = client.getApiStats();
+        double networkMs = stats.networkUs / 1000.0;
+
+        if (items < 0) result.ok = false;
+        result.items = items;
+        result.wallMs += wallMs;
+        result.minWallMs = (i == 0) ? wallMs : std::min(result.minWallMs, wallMs);
+        result.networkMs += networkMs;
+        result.parseMs += std::max(0.0, wallMs - networkMs);
+        result.requests += static_cast<double>(stats.requests);
+        result.responseBytes += static_cast<double>(stats.responseBytes);
+        result.iterations++;
+    }
+
+    double n = std::max(1, result.iterations);
+    result.wallMs /= n;
+    result.networkMs /= n;
+    result.parseMs /= n;
+    result.requests = result.requests / n + scenario.extraRequests;
+    result.responseBytes /= n;
+    result.serverRequests = mockRequestCount(options) / n;
+    return result;
+}
+
+static std::map<std::string, std::string> loadBaseline(const std::string& path) {
+    std::map<std::string, std::string> lines;
+    std::vector<uint8_t> data = platform::readFile(path);
+    std::string text(data.begin(), data.end());
+    size_t start = 0;
+    while (start < text.size()) {
+        size_t end = text.find('\n', start);
+        if (end == std::string::npos) end = text.size();
+        std::string line = text.substr(start, end - start);
+        std::string name = jsonString(line, "scenario");
+        if (!name.empty()) lines[name] = line;
+        start = end + 1;
+    }
+    return lines;
+}
+
+static std::vector<Scenario> buildScenarios(const std::string& scratchDir) {
+    SuwayomiClient& client = SuwayomiClient::getInstance();
+    std::vector<Scenario> scenarios;
+
+    auto library = [&client]() {
+        std::vector<Manga> manga;
+        return client.fetchLibraryManga(manga) ? static_cast<int>(manga.size()) : -1;
+    };
+    scenarios.push_back({"library_100", "\"library\":100", 100, library});
+    scenarios.push_back({"library_1000", "\"library\":1000", 1000, library});
+    scenarios.push_back({"library_5000", "\"library\":5000", 5000, library});
+
+    scenarios.push_back({"chapters_2000", "\"chapters\":2000", 2000, [&client]() {
+        std::vector<Chapter> chapters;
+        return client.fetchChapters(1, chapters) ? static_cast<int>(chapters.size()) : -1;
+    }});
+    scenarios.push_back({"chapters_5000", "\"chapters\":5000", 5000, [&client]() {
+        std::vector<Chapter> chapters;
+        return client.fetchChapters(1, chapters) ? static_cast<int>(chapters.size()) : -1;
+    }});
+    scenarios.push_back({"chapter_pages_60", "\"pages\":60", 60, [&client]() {
+        std::vector<Page> pages;
+        return client.fetchChapterPages(1, 100001, pages) ? static_cast<int>(pages.size()) : -1;
+    }});
+    scenarios.push_back({"global_search_200", "\"search\":200", 200, [&client]() {
+        std::vector<GlobalSearchResult> results;
+        if (!client.globalSearch("mock", results)) return -1;
+        int total = 0;
+        for (const auto& result : results) total += static_cast<int>(result.manga.size());
+        return total;
+    }});
+    scenarios.push_back({"extensions_1000", "\"extensions\":1000", 1000, [&client]() {
+        std::vector<Extension> extensions;
+        return client.fetchExtensionList(extensions) ? static_cast<int>(extensions.size()) : -1;
+    }});
+    scenarios.push_back({"extensions_3000", "\"extensions\":3000", 3000, [&client]() {
+        std::vector<Extension> extensions;
+        return client.fetchExtensionList(extensions) ? static_cast<int>(extensions.size()) : -1;
+    }});
+
+    // Same HttpClient path DownloadsManager::downloadPage streams pages through
+    Scenario download{"download_chapter_20", "\"pages\":20", 20, [&client, scratchDir]() {
+        std::vector<Page> pages;
+        if (!client.fetchChapterPages(1, 100002, pages)) return -1;
+        HttpClient http = client.createHttpClient();
+        int downloaded = 0;
+        for (const auto& page : pages) {
+            std::string path = scratchDir + "/page_" + std::to_string(page.index) + ".png";
+            if (http.downloadToFile(page.imageUrl, path)) downloaded++;
+            platform::deleteFile(path);
+        }
+        return downloaded;
+    }};
+    download.extraRequests = 20;
+    scenarios.push_back(std::move(download));
+
+    return scenarios;
+}
+
+static void printUsage() {
+    fprintf(stderr,
+            "Usage: bench_api [--server URL] [--iterations N] [--latency-ms N]\n"
+            "                 [--bandwidth-kbps N] [--scenario NAME] [--out results.jsonl]\n"
+            "                 [--baseline previous.jsonl] [--threshold PCT]\n"
+            "Start bench/mock_suwayomi.py first.\n");
+}
+
+static bool parseArgs(int argc, char** argv, Options& options) {
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (i + 1 >= argc) return false;
+        if (arg == "--server") {
+            options.serverUrl = argv[++i];
+        } else if (arg == "--iterations") {
+            options.iterations = std::max(1, atoi(argv[++i]));
+        } else if (arg == "--latency-ms") {
+            options.latencyMs = std::max(0, atoi(argv[++i]));
+        } else if (arg == "--bandwidth-kbps") {
+            options.bandwidthKbps = std::max(0, atoi(argv[++i]));
+        } else if (arg == "--scenario") {
+            options.onlyScenario = argv[++i];
+        } else if (arg == "--out") {
+            options.outPath = argv[++i];
+        } else if (arg == "--baseline") {
+            options.baselinePath = argv[++i];
+        } else if (arg == "--threshold") {
+            options.thresholdPct = std::max(0.0, atof(argv[++i]));
+        } else {
+            return false;
+        }
+    }
+    while (!options.serverUrl.empty() && options.serverUrl.back() == '/') options.serverUrl.pop_back();
+    return true;
+}
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parseArgs(argc, argv, options)) {
+        printUsage();
+        return 1;
+    }
+
+    brls::Logger::setLogLevel(brls::LogLevel::LOG_ERROR);
+    PerfTrace::setThreadName("main");
+    if (!HttpClient::globalInit()) {
+        fprintf(stderr, "bench_api: curl init failed\n");
+        return 1;
+    }
+
+    if (!configureMock(options, "")) {
+        fprintf(stderr, "bench_api: no mock server at %s (start bench/mock_suwayomi.py)\n",
+                options.serverUrl.c_str());
+        return 1;
+    }
+
+    SuwayomiClient& client = SuwayomiClient::getInstance();
+    client.setServerUrl(options.serverUrl);
+    client.setAuthMode(AuthMode::NONE);
+
+    std::string scratchDir = (std::filesystem::temp_directory_path() / "bench_api").string();
+    platform::createDirRecursive(scratchDir);
+
+    FILE* out = stdout;
+    if (!options.outPath.empty()) {
+        out = fopen(options.outPath.c_str(), "w");
+        if (!out) {
+            fprintf(stderr, "bench_api: cannot write %s\n", options.outPath.c_str());
+            return 1;
+        }
+    }
+
+    std::map<std::string, std::string> baseline;
+    if (!options.baselinePath.empty()) baseline = loadBaseline(options.baselinePath);
+
+    int regressions = 0;
+    for (const Scenario& scenario : buildScenarios(scratchDir)) {
+        if (!options.onlyScenario.empty() && options.onlyScenario != scenario.name) continue;
+        if (!configureMock(options, scenario.mockConfig)) {
+            fprintf(stderr, "bench_api: mock server stopped responding\n");
+            break;
+        }
+
+        ScenarioResult result = runScenario(options, scenario);
+        fprintf(out,
+                "{\"scenario\":\"%s\",\"ok\":%s,\"items\":%d,\"expected\":%d,\"iterations\":%d,"
+                "\"wall_ms\":%.3f,\"min_wall_ms\":%.3f,\"network_ms\":%.3f,\"parse_ms\":%.3f,"
+                "\"requests\":%.1f,\"server_requests\":%.1f,\"response_bytes\":%.0f,"
+                "\"latency_ms\":%d,\"bandwidth_kbps\":%d}\n",
+                scenario.name, result.ok ? "true" : "false", result.items, scenario.expected,
+                result.iterations, result.wallMs, result.minWallMs, result.networkMs, result.parseMs,
+                result.requests, result.serverRequests, result.responseBytes,
+                options.latencyMs, options.bandwidthKbps);
+        fflush(out);
+
+        if (result.items != scenario.expected) {
+            fprintf(stderr, "bench_api: %s received %d of %d items\n",
+                    scenario.name, result.items, scenario.expected);
+        }
+
+        // Parse time and request count are what the client controls; wall
+        // time mostly tracks the shaping. 1ms of slack absorbs timer noise.
+        auto it = baseline.find(scenario.name);
+        if (it != baseline.end()) {
+            double baseParse = jsonNumber(it->second, "parse_ms");
+            double baseRequests = jsonNumber(it->second, "requests");
+            double limit = baseParse * (1.0 + options.thresholdPct / 100.0) + 1.0;
+            if (baseParse >= 0 && result.parseMs > limit) {
+                fprintf(stderr, "bench_api: REGRESSION %s parse %.3fms (baseline %.3fms)\n",
+                        scenario.name, result.parseMs, baseParse);
+                regressions++;
+            }
+            if (baseRequests >= 0 && result.requests > baseRequests + 0.5) {
+                fprintf(stderr, "bench_api: REGRESSION %s requests %.1f (baseline %.1f)\n",
+                        scenario.name, result.requests, baseRequests);
+                regressions++;
+            }
+        }
+    }
+
+    if (out != stdout) fclose(out);
+    platform::removeDir(scratchDir);
+    return regressions > 0 ? 2 : 0;
+}
@@ -0,0 +1,508 @@
+/**
+ * VitaSuwayomi - Image pipeline benchmark
+ * Headless desktop harness for the CPU side of ImageLoader: runs each page
+ * and cover of a corpus directory through the decode, segment, downscale
+ * and download re-quality kernels and prints one JSON object per
+ * (file, stage) with timing, throughput, heap allocations and peak RSS.
+ * Needs no window, GPU or server.
+ *
+ * Usage: bench_image_pipeline <corpus dir> [--iterations N] [--warmup N]
+ *                             [--max-size PX] [--cover-size PX]
+ *                             [--out results.jsonl] [--trace trace.json]
+ */
+
+#include "utils/image_pipeline.hpp"
+#include "utils/perf_trace.hpp"
+#include "app/downloads_manager.hpp"
+#include "platform/platform.hpp"
+
+#include <borealis.hpp>
+#include <webp/decode.h>
+#include "stb_image.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <functional>
+#include <new>
+#include <string>
+#include <vector>
+
+#if defined(_WIN32)
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+using namespace vitasuwayomi;
+
+// ---------------------------------------------------------------------------
+// Allocation counting
+// ---------------------------------------------------------------------------
+// On glibc the malloc family is interposed, which also catches stb_image and
+// libwebp; elsewhere only C++ operator new is counted.
+
+static std::atomic<uint64_t> s_allocCount{0};
+static std::atomic<uint64_t> s_allocBytes{0};
+static std::atomic<int64_t> s_liveBytes{0};
+static std::atomic<int64_t> s_peakLiveBytes{0};
+
+static void countAlloc(size_t bytes) {
+    s_allocCount.fetch_add(1, std::memory_order_relaxed);
+    s_allocBytes.fetch_add(bytes, std::memory_order_relaxed);
+    int64_t live = s_liveBytes.fetch_add(static_cast<int64_t>(bytes), std::memory_order_relaxed) +
+                   static_cast<int64_t>(bytes);
+    int64_t peak = s_peakLiveBytes.load(std::memory_order_relaxed);
+    while (live > peak && !s_peakLiveBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {}
+}
+
+static void countFree(size_t bytes) {
+    s_liveBytes.fetch_sub(static_cast<int64_t>(bytes), std::memory_order_relaxed);
+}
+
+#if defined(__GLIBC__)
+static const char* ALLOC_SCOPE = "malloc";
+
+extern "C" {
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t count, size_t size);
+void* __libc_realloc(void* ptr, size_t size);
+void __libc_free(void* ptr);
+
+void* malloc(size_t size) {
+    void* ptr = __libc_malloc(size);
+    if (ptr) countAlloc(malloc_usable_size(ptr));
+    return ptr;
+}
+
+void* calloc(size_t count, size_t size) {
+    void* ptr = __libc_calloc(count, size);
+    if (ptr) countAlloc(malloc_usable_size(ptr));
+    return ptr;
+}
+
+void* realloc(void* ptr, size_t size) {
+    size_t oldSize = ptr ? malloc_usable_size(ptr) : 0;
+    void* result = __libc_realloc(ptr, size);
+    if (result) {
+        countFree(oldSize);
+        countAlloc(malloc_usable_size(result));
+    } else if (size == 0) {
+        countFree(oldSize);
+    }
+    return result;
+}
+
+void free(void* ptr) {
+    if (!ptr) return;
+    countFree(malloc_usable_size(ptr));
+    __libc_free(ptr);
+}
+}
+#else
+static const char* ALLOC_SCOPE = "new";
+
+// Size-prefixed so delete can account for the block
+static constexpr size_t ALLOC_HEADER = alignof(std::max_align_t);
+
+void* operator new(size_t size) {
+    void* block = std::malloc(size + ALLOC_HEADER);
+    if (!block) throw std::bad_alloc();
+    *static_cast<size_t*>(block) = size;
+    countAlloc(size);
+    return static_cast<char*>(block) + ALLOC_HEADER;
+}
+
+void operator delete(void* ptr) noexcept {
+    if (!ptr) return;
+    void* block = static_cast<char*>(ptr) - ALLOC_HEADER;
+    countFree(*static_cast<size_t*>(block));
+    std::free(block);
+}
+
+void* operator new[](size_t size) { return operator new(size); }
+void operator delete[](void* ptr) noexcept { operator delete(ptr); }
+void operator delete(void* ptr, size_t) noexcept { operator delete(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { operator delete(ptr); }
+#endif
+
+// Peak resident set size of the process so far, in KB
+static uint64_t peakRssKb() {
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters;
+    if (K32GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return counters.PeakWorkingSetSize / 1024;
+    }
+    return 0;
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+#if defined(__APPLE__)
+    return static_cast<uint64_t>(usage.ru_maxrss) / 1024;  // Bytes on macOS
+#else
+    return static_cast<uint64_t>(usage.ru_maxrss);
+#endif
+#endif
+}
+
+// ---------------------------------------------------------------------------
+// Corpus
+// ---------------------------------------------------------------------------
+
+enum class Format { JPEG, PNG, WEBP, GIF, UNKNOWN };
+
+static const char* formatName(Format format) {
+    switch (format) {
+        case Format::JPEG: return "jpeg";
+        case Format::PNG:  return "png";
+        case Format::WEBP: return "webp";
+        case Format::GIF:  return "gif";
+        default:           return "unknown";
+    }
+}
+
+static Format detectFormat(const std::vector<uint8_t>& data) {
+    if (data.size() >= 3 && data[0] == 0xFF && data[1] == 0xD8 && data[2] == 0xFF) return Format::JPEG;
+    if (data.size() >= 8 && memcmp(data.data(), "\x89PNG\r\n\x1a\n", 8) == 0) return Format::PNG;
+    if (data.size() >= 12 && memcmp(data.data(), "RIFF", 4) == 0 &&
+        memcmp(data.data() + 8, "WEBP", 4) == 0) return Format::WEBP;
+    if (data.size() >= 6 && memcmp(data.data(), "GIF", 3) == 0) return Format::GIF;
+    return Format::UNKNOWN;
+}
+
+struct CorpusImage {
+    std::string name;
+    std::string path;
+    Format format = Format::UNKNOWN;
+    std::vector<uint8_t> data;
+    int width = 0;
+    int height = 0;
+};
+
+// Full-resolution RGBA for the downscale stage (decoded outside the timing)
+static std::vector<uint8_t> decodeRGBA(const CorpusImage& image) {
+    std::vector<uint8_t> rgba;
+    if (image.format == Format::WEBP) {
+        uint8_t* pixels = WebPDecodeRGBA(image.data.data(), image.data.size(), nullptr, nullptr);
+        if (pixels) {
+            rgba.assign(pixels, pixels + static_cast<size_t>(image.width) * image.height * 4);
+            WebPFree(pixels);
+        }
+    } else if (image.format == Format::JPEG || image.format == Format::PNG) {
+        int w, h, channels;
+        uint8_t* pixels = stbi_load_from_memory(image.data.data(), static_cast<int>(image.data.size()),
+                                                &w, &h, &channels, 4);
+        if (pixels) {
+            rgba.assign(pixels, pixels + static_cast<size_t>(w) * h * 4);
+            stbi_image_free(pixels);
+        }
+    }
+    return rgba;
+}
+
+// ---------------------------------------------------------------------------
+// Measurement
+// ---------------------------------------------------------------------------
+
+struct Options {
+    std::string corpusDir;
+    std::string outPath;
+    std::string tracePath;
+    int iterations = 5;
+    int warmup = 1;
+    int maxSize = 1280;    // Reader page texture limit (MAX_TEXTURE_SIZE)
+    int coverSize = 256;   // Longest side of a downscaled cover
+};
+
+struct StageResult {
+    int iterations = 0;
+    double totalMs = 0;
+    double minMs = 0;
+    double maxMs = 0;
+    uint64_t allocs = 0;
+    uint64_t allocBytes = 0;
+    int64_t peakHeapBytes = 0;
+    uint64_t peakRssKb = 0;
+    size_t outputBytes = 0;
+    bool ok = true;
+};
+
+// Runs one kernel invocation per iteration. setup (untimed, uncounted) runs
+// before each one; run returns the output size, or 0 on failure.
+static StageResult measure(const Options& options, const std::function<void()>& setup,
+                           const std::function<size_t()>& run) {
+    for (int i = 0; i < options.warmup; i++) {
+        if (setup) setup();
+        run();
+    }
+
+    StageResult result;
+    for (int i = 0; i < options.iterations; i++) {
+        if (setup) setup();
+
+        uint64_t allocsBefore = s_allocCount.load(std::memory_order_relaxed);
+        uint64_t bytesBefore = s_allocBytes.load(std::memory_order_relaxed);
+        int64_t liveBefore = s_liveBytes.load(std::memory_order_relaxed);
+        s_peakLiveBytes.store(liveBefore, std::memory_order_relaxed);
+
+        auto start = std::chrono::steady_clock::now();
+        size_t outputBytes = run();
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        result.allocs += s_allocCount.load(std::memory_order_relaxed) - allocsBefore;
+        result.allocBytes += s_allocBytes.load(std::memory_order_relaxed) - bytesBefore;
+        result.peakHeapBytes = std::max(result.peakHeapBytes,
+                                        s_peakLiveBytes.load(std::memory_order_relaxed) - liveBefore);
+        result.totalMs += ms;
+        result.minMs = (i == 0) ? ms : std::min(result.minMs, ms);
+        result.maxMs = std::max(result.maxMs, ms);
+        result.outputBytes = outputBytes;
+        if (outputBytes == 0) result.ok = false;
+        result.iterations++;
+    }
+    result.peakRssKb = peakRssKb();
+    return result;
+}
+
+static std::string jsonEscape(const std::string& text) {
+    std::string escaped;
+    escaped.reserve(text.size());
+    for (char c : text) {
+        if (c == '"' || c == '\\') {
+            escaped += '\\';
+            escaped += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            char buf[8];
+            snprintf(buf, sizeof(buf), "\\u%04x", c);
+            escaped += buf;
+        } else {
+            escaped += c;
+        }
+    }
+    return escaped;
+}
+
+struct StageTotals {
+    const char* stage;
+    int images = 0;
+    int failures = 0;
+    double totalMs = 0;
+    uint64_t inputBytes = 0;
+    uint64_t allocs = 0;
+    int64_t peakHeapBytes = 0;
+};
+
+static void report(FILE* out, const CorpusImage& image, const char* stage, int segments,
+                   const StageResult& result, StageTotals& totals) {
+    double meanMs = result.iterations ? result.totalMs / result.iterations : 0;
+    double mbPerSec = meanMs > 0 ? (image.data.size() / (1024.0 * 1024.0)) / (meanMs / 1000.0) : 0;
+    double imagesPerSec = meanMs > 0 ? 1000.0 / meanMs : 0;
+    uint64_t allocsPerImage = result.iterations ? result.allocs / result.iterations : 0;
+    uint64_t allocBytesPerImage = result.iterations ? result.allocBytes / result.iterations : 0;
+
+    fprintf(out,
+            "{\"file\":\"%s\",\"format\":\"%s\",\"stage\":\"%s\",\"ok\":%s,\"input_bytes\":%zu,"
+            "\"width\":%d,\"height\":%d,\"segments\":%d,\"output_bytes\":%zu,\"iterations\":%d,"
+            "\"mean_ms\":%.3f,\"min_ms\":%.3f,\"max_ms\":%.3f,\"images_per_s\":%.2f,\"mb_per_s\":%.2f,"
+            "\"allocs_per_image\":%llu,\"alloc_bytes_per_image\":%llu,\"peak_heap_bytes\":%lld,"
+            "\"peak_rss_kb\":%llu,\"alloc_scope\":\"%s\"}\n",
+            jsonEscape(image.name).c_str(), formatName(image.format), stage, result.ok ? "true" : "false",
+            image.data.size(), image.width, image.height, segments, result.outputBytes, result.iterations,
+            meanMs, result.minMs, result.maxMs, imagesPerSec, mbPerSec,
+            static_cast<unsigned long long>(allocsPerImage), static_cast<unsigned long long>(allocBytesPerImage),
+            static_cast<long long>(result.peakHeapBytes), static_cast<unsigned long long>(result.peakRssKb),
+            ALLOC_SCOPE);
+    fflush(out);
+
+    totals.images++;
+    if (!result.ok) totals.failures++;
+    totals.totalMs += meanMs;
+    totals.inputBytes += image.data.size();
+    totals.allocs += allocsPerImage;
+    totals.peakHeapBytes = std::max(totals.peakHeapBytes, result.peakHeapBytes);
+}
+
+// ---------------------------------------------------------------------------
+
+static void printUsage() {
+    fprintf(stderr,
+            "Usage: bench_image_pipeline <corpus dir> [--iterations N] [--warmup N]\n"
+            "                            [--max-size PX] [--cover-size PX]\n"
+            "                            [--out results.jsonl] [--trace trace.json]\n");
+}
+
+static bool parseArgs(int argc, char** argv, Options& options) {
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--iterations" && hasValue) {
+            options.iterations = std::max(1, atoi(argv[++i]));
+        } else if (arg == "--warmup" && hasValue) {
+            options.warmup = std::max(0, atoi(argv[++i]));
+        } else if (arg == "--max-size" && hasValue) {
+            options.maxSize = std::max(64, atoi(argv[++i]));
+        } else if (arg == "--cover-size" && hasValue) {
+            options.coverSize = std::max(16, atoi(argv[++i]));
+        } else if (arg == "--out" && hasValue) {
+            options.outPath = argv[++i];
+        } else if (arg == "--trace" && hasValue) {
+            options.tracePath = argv[++i];
+        } else if (!arg.empty() && arg[0] != '-' && options.corpusDir.empty()) {
+            options.corpusDir = arg;
+        } else {
+            return false;
+        }
+    }
+    return !options.corpusDir.empty();
+}
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parseArgs(argc, argv, options)) {
+        printUsage();
+        return 1;
+    }
+
+    // Kernel logging would dominate the timings
+    brls::Logger::setLogLevel(brls::LogLevel::LOG_ERROR);
+    PerfTrace::setThreadName("main");
+
+    std::vector<std::string> names = platform::listDir(options.corpusDir);
+    std::sort(names.begin(), names.end());
+
+    std::vector<CorpusImage> corpus;
+    for (const auto& name : names) {
+        CorpusImage image;
+        image.name = name;
+        image.path = options.corpusDir + "/" + name;
+        image.data = platform::readFile(image.path);
+        image.format = detectFormat(image.data);
+        if (image.format == Format::UNKNOWN) continue;
+
+        int channels;
+        bool known = (image.format == Format::WEBP)
+            ? WebPGetInfo(image.data.data(), image.data.size(), &image.width, &image.height) != 0
+            : stbi_info_from_memory(image.data.data(), static_cast<int>(image.data.size()),
+                                    &image.width, &image.height, &channels) != 0;
+        if (!known) image.width = image.height = 0;
+        corpus.push_back(std::move(image));
+    }
+
+    if (corpus.empty()) {
+        fprintf(stderr, "bench_image_pipeline: no JPEG/PNG/WebP/GIF files in %s\n", options.corpusDir.c_str());
+        return 1;
+    }
+
+    FILE* out = stdout;
+    if (!options.outPath.empty()) {
+        out = fopen(options.outPath.c_str(), "w");
+        if (!out) {
+            fprintf(stderr, "bench_image_pipeline: cannot write %s\n", options.outPath.c_str());
+            return 1;
+        }
+    }
+
+    if (!options.tracePath.empty()) PerfTrace::getInstance().start();
+
+    // recompressImage rewrites its file, so each iteration gets a fresh copy
+    std::string scratchPath = (std::filesystem::temp_directory_path() / "bench_image_pipeline.jpg").string();
+
+    StageTotals gifTotals{"gif_decode"};
+    StageTotals segmentTotals{"image_segment"};
+    StageTotals webpTotals{"webp_segment"};
+    StageTotals downscaleTotals{"downscale"};
+    StageTotals requalityTotals{"requality"};
+
+    for (const CorpusImage& image : corpus) {
+        const uint8_t* data = image.data.data();
+        size_t size = image.data.size();
+
+        if (image.format == Format::GIF) {
+            StageResult result = measure(options, nullptr, [&]() {
+                return decodeGIFToTGA(data, size, options.maxSize).size();
+            });
+            report(out, image, gifTotals.stage, 1, result, gifTotals);
+            continue;
+        }
+
+        // Every segment of the page, as the reader's per-segment path decodes it
+        int segments = calculateSegments(image.width, image.height, options.maxSize);
+        bool isWebP = image.format == Format::WEBP;
+        StageResult segmentResult = measure(options, nullptr, [&]() {
+            size_t total = 0;
+            for (int segment = 0; segment < segments; segment++) {
+                std::vector<uint8_t> tga = isWebP
+                    ? convertWebPtoTGASegment(data, size, segment, segments, options.maxSize)
+                    : convertImageToTGASegment(data, size, segment, segments, options.maxSize);
+                if (tga.empty()) return static_cast<size_t>(0);
+                total += tga.size();
+            }
+            return total;
+        });
+        if (isWebP) {
+            report(out, image, webpTotals.stage, segments, segmentResult, webpTotals);
+        } else {
+            report(out, image, segmentTotals.stage, segments, segmentResult, segmentTotals);
+        }
+
+        // Cover-sized downscale of the already decoded page
+        std::vector<uint8_t> rgba = decodeRGBA(image);
+        if (!rgba.empty()) {
+            float scale = static_cast<float>(options.coverSize) / std::max(image.width, image.height);
+            int dstW = std::max(1, static_cast<int>(image.width * std::min(scale, 1.0f)));
+            int dstH = std::max(1, static_cast<int>(image.height * std::min(scale, 1.0f)));
+            StageResult result = measure(options, nullptr, [&]() {
+                return downscaleRGBAtoTGA(rgba.data(), image.width, image.height, dstW, dstH).size();
+            });
+            report(out, image, downscaleTotals.stage, 1, result, downscaleTotals);
+        }
+        rgba.clear();
+        rgba.shrink_to_fit();
+
+        // Download re-quality at the MEDIUM setting (WebP is converted to
+        // JPEG before this step in the app, so only JPEG/PNG apply)
+        if (!isWebP) {
+            StageResult result = measure(options,
+                [&]() { platform::writeFile(scratchPath, data, size); },
+                [&]() -> size_t {
+                    if (!DownloadsManager::recompressImage(scratchPath, 960, 80)) return 0;
+                    int64_t written = platform::fileSize(scratchPath);
+                    return written > 0 ? static_cast<size_t>(written) : 0;
+                });
+            report(out, image, requalityTotals.stage, 1, result, requalityTotals);
+        }
+    }
+
+    platform::deleteFile(scratchPath);
+
+    // One summary line per stage
+    for (const StageTotals* totals : {&gifTotals, &segmentTotals, &webpTotals, &downscaleTotals, &requalityTotals}) {
+        if (totals->images == 0) continue;
+        double imagesPerSec = totals->totalMs > 0 ? totals->images * 1000.0 / totals->totalMs : 0;
+        double mbPerSec = totals->totalMs > 0
+            ? (totals->inputBytes / (1024.0 * 1024.0)) / (totals->totalMs / 1000.0) : 0;
+        fprintf(out,
+                "{\"summary\":\"%s\",\"images\":%d,\"failures\":%d,\"total_ms\":%.3f,\"images_per_s\":%.2f,"
+                "\"mb_per_s\":%.2f,\"allocs_per_image\":%llu,\"peak_heap_bytes\":%lld,\"peak_rss_kb\":%llu}\n",
+                totals->stage, totals->images, totals->failures, totals->totalMs, imagesPerSec, mbPerSec,
+                static_cast<unsigned long long>(totals->allocs / totals->images),
+                static_cast<long long>(totals->peakHeapBytes), static_cast<unsigned long long>(peakRssKb()));
+    }
+
+    if (out != stdout) fclose(out);
+
+    if (!options.tracePath.empty()) {
+        PerfTrace::getInstance().stop();
+        PerfTrace::getInstance().exportJson(options.tracePath);
+    }
+    return 0;
+}
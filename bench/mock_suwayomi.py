@@ -0,0 +1,486 @@
+#!/usr/bin/env python3
+"""
+VitaSuwayomi - Mock Suwayomi server
+
+Local stand-in for a Suwayomi server, used by bench_api. Answers the GraphQL
+queries SuwayomiClient sends for the library, chapter lists, chapter pages,
+global search and the extension catalog, and serves page images. Responses
+are synthesized at the configured sizes, or replayed from recorded JSON when
+--fixtures points at a directory containing any of:
+
+    library.json  chapters.json  pages.json  search.json  extensions.json
+
+(each the full GraphQL response body, e.g. saved from a real server with
+curl). Latency and bandwidth shaping apply to every response.
+
+GET /api/graphql with a WebSocket upgrade speaks graphql-transport-ws:
+connection_init is acked, pings are answered, and each subscription gets
+updateEvents updateStatusChanged messages, eventIntervalMs apart, counting
+the pending jobs down to zero.
+
+Runtime control (used by bench_api between scenarios):
+    POST /mock/config   JSON object with any of the options below
+                        (library, chapters, pages, search, extensions,
+                        latencyMs, bandwidthKbps, updateEvents,
+                        eventIntervalMs); resets the stats
+    GET  /mock/stats    {"requests":N,"bytes":N} since the last config
+
+Python 3 standard library only.
+"""
+
+import argparse
+import base64
+import hashlib
+import json
+import os
+import re
+import struct
+import threading
+import time
+import zlib
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+
+DEFAULTS = {
+    "library": 100,
+    "chapters": 200,
+    "pages": 20,
+    "search": 50,
+    "extensions": 300,
+    "latencyMs": 0,
+    "bandwidthKbps": 0,   # 0 = unshaped
+    "pageWidth": 800,
+    "pageHeight": 1200,
+    "updateEvents": 5,
+    "eventIntervalMs": 500,
+}
+
+FIXTURE_NAMES = ("library", "chapters", "pages", "search", "extensions")
+CHUNK_SIZE = 16 * 1024
+BASE_TIME_MS = 1700000000000
+
+
+class MockState:
+    def __init__(self, config, fixtures):
+        self.lock = threading.Lock()
+        self.config = dict(config)
+        self.fixtures = fixtures
+        self.cache = {}
+        self.requests = 0
+        self.bytes = 0
+
+    def update(self, changes):
+        with self.lock:
+            for key, value in changes.items():
+                if key in DEFAULTS:
+                    self.config[key] = int(value)
+            # Cached bodies are keyed by their sizes, so they stay valid
+            self.requests = 0
+            self.bytes = 0
+
+    def count(self, size):
+        with self.lock:
+            self.requests += 1
+            self.bytes += size
+
+    def get(self, key):
+        with self.lock:
+            return self.config[key]
+
+    def cached(self, key, build):
+        with self.lock:
+            body = self.cache.get(key)
+        if body is None:
+            body = build()
+            with self.lock:
+                self.cache[key] = body
+        return body
+
+
+# ---------------------------------------------------------------------------
+# Synthetic data (same shape as Suwayomi's GraphQL schema)
+# ---------------------------------------------------------------------------
+
+def manga_node(manga_id, query):
+    node = {
+        "id": manga_id,
+        "title": "Mock Manga %05d" % manga_id,
+        "thumbnailUrl": "/api/v1/manga/%d/thumbnail" % manga_id,
+        "author": "Author %d" % (manga_id % 97),
+        "inLibrary": True,
+    }
+    # List projection (see mangaFragment in suwayomi_client.cpp)
+    if "artist" in query:
+        node.update({
+            "artist": "Artist %d" % (manga_id % 89),
+            "genre": ["Action", "Drama", "Fantasy", "Genre %d" % (manga_id % 13)],
+            "status": ("ONGOING", "COMPLETED", "ON_HIATUS")[manga_id % 3],
+            "inLibraryAt": str(BASE_TIME_MS // 1000 - manga_id * 3600),
+            "lastFetchedAt": str(BASE_TIME_MS // 1000),
+            "chaptersLastFetchedAt": str(BASE_TIME_MS // 1000),
+            "unreadCount": manga_id % 40,
+            "downloadCount": manga_id % 5,
+            "source": {"displayName": "Mock Source (EN)"},
+            "chapters": {"totalCount": 50 + manga_id % 150},
+            "lastReadChapter": {"lastReadAt": str(BASE_TIME_MS // 1000 - manga_id * 60)},
+            "latestUploadedChapter": {"uploadDate": str(BASE_TIME_MS - manga_id * 86400000)},
+            "categories": {"nodes": [{"id": manga_id % 4}]},
+        })
+    if "description" in query:
+        node.update({
+            "description": "Synthetic description for manga %d. " % manga_id * 4,
+            "url": "/manga/%d" % manga_id,
+            "initialized": True,
+        })
+    return node
+
+
+def chapter_node(manga_id, index, total):
+    return {
+        "id": manga_id * 100000 + index,
+        "name": "Chapter %d" % (total - index),
+        "chapterNumber": float(total - index),
+        "scanlator": "Mock Scans",
+        "uploadDate": str(BASE_TIME_MS - index * 86400000),
+        "isRead": index >= total // 2,
+        "isDownloaded": False,
+        "isBookmarked": index % 50 == 0,
+        "pageCount": 20,
+        "lastPageRead": 0,
+        "lastReadAt": "0",
+        "sourceOrder": total - index,
+    }
+
+
+def extension_node(index):
+    return {
+        "pkgName": "eu.kanade.tachiyomi.extension.mock.source%d" % index,
+        "name": "Mock Source %d" % index,
+        "lang": ("en", "ja", "es", "fr", "all")[index % 5],
+        "versionName": "1.4.%d" % (index % 30),
+        "versionCode": index % 30,
+        "iconUrl": "/api/v1/extension/icon/mock-source%d.apk" % index,
+        "isInstalled": index % 10 == 0,
+        "hasUpdate": index % 40 == 0,
+        "isObsolete": False,
+        "isNsfw": False,
+        "repo": "https://example.invalid/mock-repo/index.min.json",
+        "source": {"nodes": [{"isConfigurable": index % 3 == 0}]},
+    }
+
+
+def first_arg(query, default):
+    match = re.search(r"first:\s*(\d+)", query)
+    return int(match.group(1)) if match else default
+
+
+def graphql_body(state, query, variables):
+    def fixture(name):
+        return state.fixtures.get(name)
+
+    if "fetchChapterPages" in query:
+        if fixture("pages"):
+            return fixture("pages")
+        chapter_id = int(variables.get("id", 1))
+        count = state.get("pages")
+        manga_id = chapter_id // 100000 or 1
+        pages = ["/api/v1/manga/%d/chapter/%d/page/%d" % (manga_id, chapter_id, i) for i in range(count)]
+        return json.dumps({"data": {"fetchChapterPages": {"pages": pages}}})
+
+    if "fetchSourceManga" in query:
+        if fixture("search"):
+            return fixture("search")
+        count = state.get("search")
+        return state.cached(("search", count, "artist" in query), lambda: json.dumps({"data": {
+            "fetchSourceManga": {"mangas": [manga_node(i + 1, query) for i in range(count)],
+                                 "hasNextPage": False}}}))
+
+    if re.search(r"\bextensions\b", query):
+        if fixture("extensions"):
+            return fixture("extensions")
+        count = state.get("extensions")
+        return state.cached(("extensions", count), lambda: json.dumps({"data": {
+            "extensions": {"nodes": [extension_node(i) for i in range(count)]}}}))
+
+    if re.search(r"\bchapters\s*\(", query):
+        if fixture("chapters"):
+            return fixture("chapters")
+        manga_id = int(variables.get("mangaId", 1))
+        total = state.get("chapters")
+        shown = min(total, first_arg(query, total))
+        return state.cached(("chapters", manga_id, total, shown), lambda: json.dumps({"data": {
+            "chapters": {"nodes": [chapter_node(manga_id, i, total) for i in range(shown)],
+                         "totalCount": total}}}))
+
+    if re.search(r"\bmangas\s*\(", query):
+        if fixture("library"):
+            return fixture("library")
+        total = state.get("library")
+        shown = min(total, first_arg(query, total))
+        return state.cached(("library", total, shown, "artist" in query, "description" in query),
+                            lambda: json.dumps({"data": {
+                                "mangas": {"nodes": [manga_node(i + 1, query) for i in range(shown)],
+                                           "totalCount": total}}}))
+
+    return json.dumps({"data": {}})
+
+
+# ---------------------------------------------------------------------------
+# Page images: a deterministic gradient PNG per page size
+# ---------------------------------------------------------------------------
+
+def make_png(width, height, seed):
+    rows = bytearray()
+    for y in range(height):
+        shade = (y * 255 // max(1, height - 1) + seed * 37) & 0xFF
+        rows.append(0)  # Filter: none
+        rows += bytes(v for x in range(width)
+                      for v in ((x + shade) & 0xFF, shade, (x * 3 + seed) & 0xFF))
+
+    def chunk(kind, data):
+        return (struct.pack(">I", len(data)) + kind + data +
+                struct.pack(">I", zlib.crc32(kind + data) & 0xFFFFFFFF))
+
+    header = struct.pack(">IIBBBBB", width, height, 8, 2, 0, 0, 0)
+    return (b"\x89PNG\r\n\x1a\n" + chunk(b"IHDR", header) +
+            chunk(b"IDAT", zlib.compress(bytes(rows), 6)) + chunk(b"IEND", b""))
+
+
+# ---------------------------------------------------------------------------
+# HTTP
+# ---------------------------------------------------------------------------
+
+PAGE_ROUTE = re.compile(r"^/api/v1/manga/\d+/chapter/\d+/page/(\d+)")
+WS_GUID = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11"
+WS_PROTOCOL = "graphql-transport-ws"
+
+
+class WebSocketSession:
+    """Server side of one graphql-transport-ws connection."""
+
+    def __init__(self, handler):
+        self.handler = handler
+        self.state = handler.state
+        self.write_lock = threading.Lock()
+        self.active = {}  # Subscription id -> threading.Event set on complete
+        self.closed = threading.Event()
+
+    def send_frame(self, opcode, payload):
+        if isinstance(payload, str):
+            payload = payload.encode("utf-8")
+        header = bytes([0x80 | opcode])
+        if len(payload) < 126:
+            header += bytes([len(payload)])
+        elif len(payload) <= 0xFFFF:
+            header += bytes([126]) + struct.pack(">H", len(payload))
+        else:
+            header += bytes([127]) + struct.pack(">Q", len(payload))
+        with self.write_lock:
+            try:
+                self.handler.wfile.write(header + payload)
+                self.handler.wfile.flush()
+            except (BrokenPipeError, ConnectionResetError, ValueError):
+                self.closed.set()
+
+    def send_json(self, message):
+        self.send_frame(0x1, json.dumps(message))
+
+    def read_frame(self):
+        head = self.handler.rfile.read(2)
+        if len(head) < 2:
+            return None, None
+        opcode = head[0] & 0x0F
+        length = head[1] & 0x7F
+        if length == 126:
+            length = struct.unpack(">H", self.handler.rfile.read(2))[0]
+        elif length == 127:
+            length = struct.unpack(">Q", self.handler.rfile.read(8))[0]
+        mask = self.handler.rfile.read(4) if head[1] & 0x80 else b"\0\0\0\0"
+        data = self.handler.rfile.read(length)
+        return opcode, bytes(b ^ mask[i & 3] for i, b in enumerate(data))
+
+    def emit_updates(self, sub_id, done):
+        events = max(1, self.state.get("updateEvents"))
+        interval = self.state.get("eventIntervalMs") / 1000.0
+        total = self.state.get("library")
+        for step in range(events):
+            if done.wait(interval) or self.closed.is_set():
+                return
+            pending = total * (events - 1 - step) // events
+            status = {
+                "isRunning": pending > 0,
+                "pendingJobs": {"mangas": {"totalCount": pending}},
+                "runningJobs": {"mangas": {"totalCount": 1 if pending > 0 else 0}},
+            }
+            self.send_json({"id": sub_id, "type": "next",
+                            "payload": {"data": {"updateStatusChanged": status}}})
+        self.send_json({"id": sub_id, "type": "complete"})
+
+    def run(self):
+        while not self.closed.is_set():
+            opcode, payload = self.read_frame()
+            if opcode is None or opcode == 0x8:
+                if opcode == 0x8:
+                    self.send_frame(0x8, payload[:2])
+                break
+            if opcode == 0x9:
+                self.send_frame(0xA, payload)
+                continue
+            if opcode != 0x1:
+                continue
+            try:
+                message = json.loads(payload)
+            except ValueError:
+                continue
+            kind = message.get("type")
+            if kind == "connection_init":
+                self.send_json({"type": "connection_ack"})
+            elif kind == "ping":
+                self.send_json({"type": "pong"})
+            elif kind == "subscribe":
+                done = threading.Event()
+                self.active[message.get("id")] = done
+                threading.Thread(target=self.emit_updates, args=(message.get("id"), done),
+                                 daemon=True).start()
+            elif kind == "complete":
+                done = self.active.pop(message.get("id"), None)
+                if done:
+                    done.set()
+        self.closed.set()
+        for done in self.active.values():
+            done.set()
+
+
+class Handler(BaseHTTPRequestHandler):
+    protocol_version = "HTTP/1.1"
+    state = None
+
+    def log_message(self, fmt, *args):
+        pass
+
+    def send_body(self, body, content_type="application/json", status=200, shaped=True):
+        if isinstance(body, str):
+            body = body.encode("utf-8")
+        if shaped:
+            latency = self.state.get("latencyMs")
+            if latency > 0:
+                time.sleep(latency / 1000.0)
+        self.send_response(status)
+        self.send_header("Content-Type", content_type)
+        self.send_header("Content-Length", str(len(body)))
+        self.end_headers()
+
+        rate = self.state.get("bandwidthKbps") * 1024 / 8 if shaped else 0
+        try:
+            for offset in range(0, len(body), CHUNK_SIZE):
+                chunk = body[offset:offset + CHUNK_SIZE]
+                self.wfile.write(chunk)
+                if rate > 0:
+                    time.sleep(len(chunk) / rate)
+        except (BrokenPipeError, ConnectionResetError):
+            self.close_connection = True
+            return
+        if shaped:
+            self.state.count(len(body))
+
+    def read_json(self):
+        length = int(self.headers.get("Content-Length", 0))
+        raw = self.rfile.read(length) if length else b"{}"
+        try:
+            return json.loads(raw or b"{}")
+        except ValueError:
+            return None
+
+    def do_POST(self):
+        if self.path == "/mock/config":
+            changes = self.read_json()
+            if not isinstance(changes, dict):
+                self.send_body('{"error":"bad config"}', status=400, shaped=False)
+                return
+            self.state.update(changes)
+            self.send_body(json.dumps(self.state.config), shaped=False)
+            return
+
+        if self.path.startswith("/api/graphql"):
+            request = self.read_json()
+            if not isinstance(request, dict) or "query" not in request:
+                self.send_body('{"errors":[{"message":"bad request"}]}', status=400)
+                return
+            self.send_body(graphql_body(self.state, request["query"], request.get("variables") or {}))
+            return
+
+        self.send_body('{"error":"not found"}', status=404)
+
+    def handle_websocket(self):
+        key = self.headers.get("Sec-WebSocket-Key", "")
+        protocols = [p.strip() for p in self.headers.get("Sec-WebSocket-Protocol", "").split(",")]
+        if not key or WS_PROTOCOL not in protocols:
+            self.send_body('{"error":"bad upgrade"}', status=400, shaped=False)
+            return
+        accept = base64.b64encode(hashlib.sha1((key + WS_GUID).encode("ascii")).digest()).decode("ascii")
+        self.send_response(101)
+        self.send_header("Upgrade", "websocket")
+        self.send_header("Connection", "Upgrade")
+        self.send_header("Sec-WebSocket-Accept", accept)
+        self.send_header("Sec-WebSocket-Protocol", WS_PROTOCOL)
+        self.end_headers()
+        self.wfile.flush()
+        WebSocketSession(self).run()
+        self.close_connection = True
+
+    def do_GET(self):
+        if self.path.startswith("/api/graphql") and self.headers.get("Upgrade", "").lower() == "websocket":
+            self.handle_websocket()
+            return
+
+        if self.path == "/mock/stats":
+            with self.state.lock:
+                stats = {"requests": self.state.requests, "bytes": self.state.bytes}
+            self.send_body(json.dumps(stats), shaped=False)
+            return
+
+        match = PAGE_ROUTE.match(self.path)
+        if match:
+            width, height = self.state.get("pageWidth"), self.state.get("pageHeight")
+            seed = int(match.group(1)) % 8
+            png = self.state.cached(("png", width, height, seed), lambda: make_png(width, height, seed))
+            self.send_body(png, content_type="image/png")
+            return
+
+        self.send_body('{"error":"not found"}', status=404)
+
+
+def load_fixtures(directory):
+    fixtures = {}
+    if not directory:
+        return fixtures
+    for name in FIXTURE_NAMES:
+        path = os.path.join(directory, name + ".json")
+        if os.path.isfile(path):
+            with open(path, "r", encoding="utf-8") as f:
+                fixtures[name] = f.read()
+    return fixtures
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Mock Suwayomi server for bench_api")
+    parser.add_argument("--host", default="127.0.0.1")
+    parser.add_argument("--port", type=int, default=4567)
+    parser.add_argument("--fixtures", help="directory of recorded GraphQL responses")
+    for key, value in DEFAULTS.items():
+        parser.add_argument("--" + re.sub(r"([A-Z])", r"-\1", key).lower(), dest=key, type=int, default=value)
+    args = parser.parse_args()
+
+    config = {key: getattr(args, key) for key in DEFAULTS}
+    Handler.state = MockState(config, load_fixtures(args.fixtures))
+
+    server = ThreadingHTTPServer((args.host, args.port), Handler)
+    server.daemon_threads = True
+    print("mock_suwayomi: listening on http://%s:%d" % (args.host, args.port), flush=True)
+    try:
+        server.serve_forever()
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == "__main__":
+    main()
@@ -8,6 +8,8 @@
 
 #include <borealis.hpp>
 #include <chrono>
+#include <map>
+#include <set>
 #include "app/suwayomi_client.hpp"
 #include "app/application.hpp"
 #include "view/rotatable_image.hpp"
@@ -90,7 +92,7 @@ private:
     void updateProgress();
     void showControls();
     void hideControls();
-    void preloadAdjacentPages();
+    void preloadAdjacentPages();  // Refresh the decoded-page ring window
     void markChapterAsRead();
     void applySettings();
     void saveSettingsToApp();  // Persist settings to AppSettings
@@ -192,6 +194,13 @@ private:
     bool m_prevChapterLoaded = false;
     void preloadPrevChapter();
 
+    // Webtoon layout: read the natural size of pages the dimension cache
+    // doesn't know from their headers, starting at firstIndex, and apply them
+    // to the strip and the loaded/preloaded page lists as they arrive
+    std::set<int> m_sizeProbedChapters;
+    void probePageSizes(int chapterId, const std::vector<Page>& pages, int firstIndex = 0);
+    void applyPageSizes(const std::map<std::string, std::pair<int, int>>& sizes);
+
     // Swipe-to-chapter tracking: when swiping shows a cross-chapter preview,
     // completing the swipe should trigger chapter navigation instead of page nav
     bool m_swipeToChapter = false;
@@ -282,6 +291,15 @@ private:
     std::shared_ptr<bool> m_pageLoadAlive; // Per-load alive flag to cancel stale async loads
     std::shared_ptr<bool> m_previewLoadAlive; // Per-preview-cycle alive flag to cancel stale preview loads
     std::shared_ptr<bool> m_crossChapterPreloadAlive; // Survives preloadAdjacentPreviews() re-invocation
+
+    // Decoded-page ring (ImageLoader::setPageRingWindow): pages kept decoded
+    // around the current one in reading direction, across chapter edges
+    static constexpr int PAGE_RING_AHEAD = 3;
+    static constexpr int PAGE_RING_BEHIND = 1;
+    int m_readDirection = 1;           // +1 = towards later pages, -1 = backwards
+    int m_lastLoadedPage = -1;         // Previous loadPage() index, for direction tracking
+    int m_lastLoadedChapterPos = -1;   // Chapter position of m_lastLoadedPage
+    std::chrono::steady_clock::time_point m_turnStartTime;  // Page-turn latency start
     bool m_loadedFromLocal = false;  // True when current chapter was loaded from local downloads
     void showPageError(const std::string& message);
     void hidePageError();
@@ -7,6 +7,7 @@
 
 #include <string>
 #include <functional>
+#include <memory>
 #include <mutex>
 #include <set>
 #include <map>
@@ -14,6 +15,8 @@
 #include <cstdint>
 #include <nanovg.h>
 
+#include "utils/settings_store.hpp"
+
 // Application version — set by CMake via -DAPP_VERSION, fallback for IDE indexers
 #ifndef VITA_SUWAYOMI_VERSION
 #define VITA_SUWAYOMI_VERSION "1.0.0"
@@ -266,6 +269,9 @@ public:
     std::string getAlternateServerUrl() const;  // Returns the URL not currently in use
     void switchToLocalUrl();
     void switchToRemoteUrl();
+    // Routes this session to the local or remote URL without touching the
+    // saved choice (EndpointSelector's latency-based switching)
+    void routeToServerUrl(bool remote);
     bool hasLocalUrl() const { return !m_settings.localServerUrl.empty(); }
     bool hasRemoteUrl() const { return !m_settings.remoteServerUrl.empty(); }
     bool hasBothUrls() const { return hasLocalUrl() && hasRemoteUrl(); }
@@ -279,9 +285,11 @@ public:
         m_authPassword = password;
     }
 
-    // Settings persistence
+    // Settings persistence. saveSettings() only snapshots the current values;
+    // the write happens on a worker, coalesced with other saves in the window.
     bool loadSettings();
     bool saveSettings();
+    void flushSettings();  // Write any queued save now (blocking)
 
     // Current category (for context)
     int getCurrentCategoryId() const { return m_currentCategoryId; }
@@ -402,6 +410,23 @@ private:
     ReaderResult m_lastReaderResult;
     ReaderResultCallback m_readerResultCallback;
     std::string m_pendingDeeplink;
+
+    // Values saveSettings() hands to the background writer
+    struct SettingsSnapshot {
+        AppSettings settings;
+        std::string serverUrl;
+        std::string authUsername;
+        std::string authPassword;
+        int currentCategoryId = 0;
+    };
+
+    void writePendingSettings();
+
+    SettingsStore m_settingsStore;                 // Guarded by m_settingsWriteMutex
+    std::mutex m_settingsWriteMutex;
+    std::mutex m_settingsSaveMutex;                // Guards the two below
+    std::unique_ptr<SettingsSnapshot> m_pendingSettings;
+    uint64_t m_settingsSaveTimer = 0;
 };
 
 } // namespace vitasuwayomi
@@ -85,6 +85,10 @@ class DownloadsManager {
 public:
     static DownloadsManager& getInstance();
 
+    // Shrink an image file to maxWidth (keeping aspect) and rewrite it as JPEG
+    // at jpegQuality. Keeps the original if it can't be decoded.
+    static bool recompressImage(const std::string& filePath, int maxWidth, int jpegQuality);
+
     // Initialize downloads directory and load saved state
     bool init();
 
@@ -0,0 +1,76 @@
+/**
+ * VitaSuwayomi - Endpoint Selector
+ * Routes requests between the local and remote server URLs. A background
+ * prober measures round-trip time to both every PROBE_INTERVAL_MS and moves
+ * the app to the fastest healthy one, so moving between home Wi-Fi and a
+ * hotspot needs no manual switching. A request that cannot reach its
+ * endpoint is retried once on the other through failoverUrl().
+ * Switches last for the session; the saved Local/Remote choice is kept.
+ * Only active with "Auto-Switch on Failure" on and both URLs configured.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+namespace vitasuwayomi {
+
+class EndpointSelector {
+public:
+    static EndpointSelector& getInstance();
+
+    // Mirrors the server URL settings; called whenever they are saved
+    void configure(const std::string& localUrl, const std::string& remoteUrl,
+                   bool useRemote, bool autoSwitch);
+
+    // Starts the periodic prober
+    void start();
+
+    // Marks the endpoint url belongs to as failing and returns url rewritten
+    // onto the other endpoint, or "" if there is no usable alternative
+    std::string failoverUrl(const std::string& url);
+
+    // Stable key for the server url belongs to: the local base URL when url is
+    // on either configured endpoint, so caches survive a local/remote switch
+    std::string serverIdentity(const std::string& url);
+
+    // Last smoothed round-trip time in ms, -1 if unknown or unreachable
+    int getRttMs(bool remote);
+
+private:
+    EndpointSelector() = default;
+    ~EndpointSelector() = default;
+    EndpointSelector(const EndpointSelector&) = delete;
+    EndpointSelector& operator=(const EndpointSelector&) = delete;
+
+    struct Endpoint {
+        std::string baseUrl;  // Without trailing slash
+        bool probed = false;
+        bool healthy = false;
+        float rttMs = 0.0f;   // Smoothed over probes
+    };
+
+    static std::string normalize(const std::string& url);
+    static bool probeEndpoint(const std::string& baseUrl, int& rttMs);
+
+    bool enabledLocked() const;
+    int endpointForUrlLocked(const std::string& url) const;  // 0 local, 1 remote, -1 neither
+    void requestProbeLocked();
+    void probe();
+
+    std::mutex m_mutex;
+    Endpoint m_endpoints[2];  // Local, remote
+    int m_active = 0;
+    bool m_preferRemote = false;  // Saved choice, as last configured
+    bool m_configured = false;
+    bool m_autoSwitch = false;
+    bool m_started = false;
+    bool m_probing = false;
+    uint64_t m_soonTimer = 0;
+    std::chrono::steady_clock::time_point m_lastProbe;
+};
+
+} // namespace vitasuwayomi
@@ -0,0 +1,81 @@
+/**
+ * VitaSuwayomi - Mutation Outbox
+ * Durable queue for chapter progress and read-state writes. Each change is
+ * appended to a journal (on a worker, shortly after) before the replay sends
+ * it, coalesced per
+ * chapter so only the latest page and read state are sent, and replayed in
+ * batched GraphQL mutations with backoff until the server accepts it.
+ * Callers never wait on the network. A write that fails to reach the server
+ * is kept until it does; one the server itself rejects MAX_FAILURES times
+ * while other writes succeed (e.g. a deleted chapter) is dropped.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace vitasuwayomi {
+
+class MutationOutbox {
+public:
+    static MutationOutbox& getInstance();
+
+    // Loads writes left over from a previous run and schedules their replay
+    void init();
+
+    // Queue a write. Never blocks on the network or the journal file.
+    void setProgress(int mangaId, int chapterId, int lastPageRead);
+    void setRead(int mangaId, int chapterId, bool read);
+
+    // Writes queued journal records now instead of on the worker (at exit)
+    void flushJournal();
+
+    // Replay now instead of waiting out the backoff, e.g. after reconnecting
+    void flush();
+
+    size_t pendingCount();
+
+private:
+    MutationOutbox() = default;
+    ~MutationOutbox() = default;
+    MutationOutbox(const MutationOutbox&) = delete;
+    MutationOutbox& operator=(const MutationOutbox&) = delete;
+
+    struct Pending {
+        int mangaId = 0;
+        int lastPageRead = -1;  // -1 = no progress write queued
+        int read = -1;          // -1 = no read-state write queued
+        uint64_t version = 0;   // Bumped on every change; replay acks only what it sent
+        int failures = 0;
+    };
+
+    static std::string getJournalPath();
+
+    // Fills m_pending from a journal image; false if it is not a journal
+    bool loadJournalLocked(const std::vector<uint8_t>& data);
+    void record(int mangaId, int chapterId, int lastPageRead, int read);
+    void queueRecordLocked(int chapterId, const Pending& entry);
+    // Appends queued records, or replaces the journal with the pending set
+    // when rewrite is true or it is mostly superseded records
+    void writeJournal(bool rewrite);
+    void scheduleReplayLocked(int delayMs);
+    void replay();
+
+    std::mutex m_mutex;
+    std::mutex m_journalMutex;  // Orders journal writes; taken before m_mutex
+    std::map<int, Pending> m_pending;  // By chapter ID
+    uint64_t m_version = 0;
+    std::string m_unwritten;           // Encoded records not yet in the journal
+    uint64_t m_journalTimer = 0;
+    size_t m_journalRecords = 0;
+    uint64_t m_replayTimer = 0;
+    bool m_replaying = false;
+    int m_backoffMs = 0;
+};
+
+} // namespace vitasuwayomi
@@ -13,8 +13,11 @@
 #include <map>
 #include <set>
 #include <mutex>
+#include <atomic>
 #include <ctime>
 #include "utils/http_client.hpp"
+#include "utils/response_cache.hpp"
+#include "utils/single_flight.hpp"
 
 namespace vitasuwayomi {
 
@@ -142,6 +145,10 @@ struct Manga {
     int64_t lastReadAt = 0;         // Timestamp when manga was last read (Unix ms)
     int64_t latestChapterUploadDate = 0;  // Latest chapter upload date for "Date Updated" sort
 
+    // Server-side fetch times, used as the delta library sync watermark
+    int64_t lastFetchedAt = 0;
+    int64_t chaptersLastFetchedAt = 0;
+
     // Tracking info
     std::vector<int> categoryIds;
 
@@ -207,6 +214,15 @@ struct Manga {
     }
 };
 
+// Named field sets for manga list queries, so a call only pays for the
+// fields its view uses. Fields outside the profile stay at their defaults;
+// the detail view fills them in from the details cache or fetchManga.
+enum class MangaProjection {
+    GRID,    // Browse/search cells: title, cover, author, library badge
+    LIST,    // Library lists: GRID plus what sorting, grouping and search use
+    DETAIL   // LIST plus description, url and initialized
+};
+
 // Page info for chapter reader
 struct Page {
     int index = 0;
@@ -216,6 +232,8 @@ struct Page {
     int segment = 0;        // Reserved (unused)
     int totalSegments = 1;  // Reserved (unused)
     int originalIndex = -1; // Original page index (-1 = same as index)
+    int width = 0;          // Natural size when known before loading (0 = unknown)
+    int height = 0;
 };
 
 // Recent chapter update
@@ -224,6 +242,30 @@ struct RecentUpdate {
     Chapter chapter;
 };
 
+// Pending writes for one chapter; -1 leaves a field unchanged
+struct ChapterPatch {
+    int chapterId = 0;
+    int lastPageRead = -1;
+    int isRead = -1;
+};
+
+// Delta library sync position, in the server's own timestamp units.
+// fetchedAt tracks manga/chapter list refreshes, lastReadAt tracks reading.
+struct LibrarySyncWatermark {
+    int64_t fetchedAt = 0;
+    int64_t lastReadAt = 0;
+
+    bool isValid() const { return fetchedAt > 0; }
+    static LibrarySyncWatermark fromManga(const std::vector<Manga>& manga);
+};
+
+// Changes to one category since a watermark
+struct CategoryMangaDelta {
+    std::vector<int> memberIds;   // Every manga currently in the category
+    std::vector<Manga> changed;   // Full records for new or changed members
+    LibrarySyncWatermark watermark;  // Position to sync from next time
+};
+
 // Global search result
 struct GlobalSearchResult {
     Source source;
@@ -456,9 +498,15 @@ public:
     bool removeExtensionRepo(const std::string& repoUrl);
 
     // Source Management
-    bool fetchSourceList(std::vector<Source>& sources);
+    // Read-only queries below go through the response cache. When the cached
+    // copy is stale, onStale gets it (on the calling thread) before the
+    // request; the return value is always the server's answer. The library
+    // and manga detail screens draw LibraryCache's copy first instead.
+    bool fetchSourceList(std::vector<Source>& sources,
+                         const std::function<void(const std::vector<Source>&)>& onStale = nullptr);
     bool fetchSource(int64_t sourceId, Source& source);
-    bool fetchSourceFilters(int64_t sourceId, std::vector<SourceFilter>& filters);
+    bool fetchSourceFilters(int64_t sourceId, std::vector<SourceFilter>& filters,
+                            const std::function<void(const std::vector<SourceFilter>&)>& onStale = nullptr);
     bool setSourceFilters(int64_t sourceId, const std::vector<SourceFilter>& filters);
 
     // Source Preferences (for configurable sources)
@@ -473,18 +521,22 @@ public:
     bool fetchSourcesForExtension(const std::string& pkgName, std::vector<Source>& sources);
 
     // Source Browsing
-    bool fetchPopularManga(int64_t sourceId, int page, std::vector<Manga>& manga, bool& hasNextPage);
-    bool fetchLatestManga(int64_t sourceId, int page, std::vector<Manga>& manga, bool& hasNextPage);
+    bool fetchPopularManga(int64_t sourceId, int page, std::vector<Manga>& manga, bool& hasNextPage,
+                           MangaProjection projection = MangaProjection::GRID);
+    bool fetchLatestManga(int64_t sourceId, int page, std::vector<Manga>& manga, bool& hasNextPage,
+                          MangaProjection projection = MangaProjection::GRID);
     bool searchManga(int64_t sourceId, const std::string& query, int page,
-                     std::vector<Manga>& manga, bool& hasNextPage);
+                     std::vector<Manga>& manga, bool& hasNextPage,
+                     MangaProjection projection = MangaProjection::GRID);
     bool searchMangaWithFilters(int64_t sourceId, const std::string& query, int page,
                                 const std::vector<SourceFilter>& filters,
-                                std::vector<Manga>& manga, bool& hasNextPage);
+                                std::vector<Manga>& manga, bool& hasNextPage,
+                                MangaProjection projection = MangaProjection::GRID);
     bool quickSearchManga(int64_t sourceId, const std::string& query, std::vector<Manga>& manga);
 
     // Manga Operations
     bool fetchManga(int mangaId, Manga& manga);
-    bool fetchMangaFull(int mangaId, Manga& manga);
+    bool fetchMangaFull(int mangaId, Manga& manga, const std::function<void(const Manga&)>& onStale = nullptr);
     bool refreshManga(int mangaId, Manga& manga);
     bool addMangaToLibrary(int mangaId);
     bool removeMangaFromLibrary(int mangaId);
@@ -501,13 +553,17 @@ public:
     bool markAllChaptersRead(int mangaId);
     bool markAllChaptersUnread(int mangaId);
     bool updateChapterProgress(int mangaId, int chapterIndex, int lastPageRead);
+    // Applies several chapters' writes in one GraphQL request. All or nothing:
+    // a rejected patch fails the whole batch.
+    bool applyChapterPatches(const std::vector<ChapterPatch>& patches);
 
     // Page Operations
     bool fetchChapterPages(int mangaId, int chapterId, std::vector<Page>& pages);
     std::string getPageImageUrl(int chapterId, int pageIndex);
 
     // Category Management
-    bool fetchCategories(std::vector<Category>& categories);
+    bool fetchCategories(std::vector<Category>& categories,
+                         const std::function<void(const std::vector<Category>&)>& onStale = nullptr);
     bool createCategory(const std::string& name);
     bool deleteCategory(int categoryId);
     bool updateCategory(int categoryId, const std::string& name, bool isDefault);
@@ -515,15 +571,23 @@ public:
     bool moveCategoryOrder(int categoryId, int newPosition);  // Move category to new position (0-indexed)
     bool addMangaToCategory(int mangaId, int categoryId);
     bool removeMangaFromCategory(int mangaId, int categoryId);
-    bool fetchCategoryManga(int categoryId, std::vector<Manga>& manga);
+    bool fetchCategoryManga(int categoryId, std::vector<Manga>& manga,
+                            MangaProjection projection = MangaProjection::LIST);
+    // Only the manga in a category that changed since the watermark, plus the
+    // current member IDs so removals can be applied. knownIds are the members
+    // the caller already has; new ones are fetched in full. Returns false when
+    // the server can't answer a delta query and a full fetch is needed.
+    bool fetchCategoryMangaDelta(int categoryId, const LibrarySyncWatermark& since,
+                                 const std::vector<int>& knownIds, CategoryMangaDelta& delta);
 
     // Combined/parallel fetch operations (single request for multiple data)
     bool fetchCategoriesWithManga(std::vector<Category>& categories, int categoryId, std::vector<Manga>& manga);
     bool fetchMangaWithChapters(int mangaId, Manga& manga, std::vector<Chapter>& chapters);
 
     // Library Operations
-    bool fetchLibraryManga(std::vector<Manga>& manga);
-    bool fetchLibraryMangaByCategory(int categoryId, std::vector<Manga>& manga);
+    bool fetchLibraryManga(std::vector<Manga>& manga, MangaProjection projection = MangaProjection::LIST);
+    bool fetchLibraryMangaByCategory(int categoryId, std::vector<Manga>& manga,
+                                     MangaProjection projection = MangaProjection::LIST);
     bool triggerLibraryUpdate();
     bool triggerLibraryUpdate(int categoryId);
     bool triggerLibraryUpdate(const std::vector<int>& categoryIds);
@@ -536,6 +600,10 @@ public:
     bool queueChapterDownloads(const std::vector<int>& chapterIds);
     bool deleteChapterDownloads(const std::vector<int>& chapterIds, int mangaId = 0, const std::vector<int>& chapterIndexes = {});
     bool fetchDownloadQueue(std::vector<DownloadQueueItem>& queue);
+    // Push updates via SubscriptionClient: subscription document and a parser
+    // for its "next" messages (same queue shape as fetchDownloadQueue)
+    static const char* getDownloadQueueSubscription();
+    void parseDownloadQueue(const std::string& json, std::vector<DownloadQueueItem>& queue);
     bool startDownloads();
     bool stopDownloads();
     bool clearDownloadQueue();
@@ -547,7 +615,8 @@ public:
     bool validateBackup(const std::string& filePath);
 
     // Tracking
-    bool fetchTrackers(std::vector<Tracker>& trackers);
+    bool fetchTrackers(std::vector<Tracker>& trackers,
+                       const std::function<void(const std::vector<Tracker>&)>& onStale = nullptr);
     bool fetchTracker(int trackerId, Tracker& tracker);
     bool loginTrackerCredentials(int trackerId, const std::string& username, const std::string& password);
     bool loginTrackerOAuth(int trackerId, const std::string& callbackUrl, std::string& oauthUrl);
@@ -582,8 +651,17 @@ public:
     bool deleteMangaMeta(int mangaId, const std::string& key);
 
     // Configuration
-    void setServerUrl(const std::string& url) { m_serverUrl = url; }
-    const std::string& getServerUrl() const { return m_serverUrl; }
+    void setServerUrl(const std::string& url) {
+        std::lock_guard<std::recursive_mutex> lock(m_mutex);
+        m_serverUrl = url;
+    }
+    std::string getServerUrl() const {
+        std::lock_guard<std::recursive_mutex> lock(m_mutex);
+        return m_serverUrl;
+    }
+    // Same value whichever endpoint of the server is active; keys persisted
+    // and cached state so switching local/remote doesn't start cold
+    std::string getServerIdentity() const;
     void setAuthCredentials(const std::string& username, const std::string& password);
     void clearAuth();
 
@@ -628,10 +706,29 @@ public:
 
     // Get update summary
     bool fetchUpdateSummary(int& pendingUpdates, int& runningJobs, bool& isUpdating);
+    // Library update progress pushed over SubscriptionClient
+    static const char* getUpdateStatusSubscription();
+    bool parseUpdateStatus(const std::string& json, int& pendingUpdates, int& runningJobs, bool& isUpdating);
 
     // Create HTTP client with authentication (public for use by other managers)
     HttpClient createHttpClient();
 
+    // Drop every cached response (memory and disk)
+    void clearResponseCache();
+
+    // Reads that joined another caller's in-flight request (perf overlay)
+    uint64_t getCoalescedRequestCount() const { return m_inFlight.joinedCount(); }
+
+    // GraphQL round trips since the last reset: requests sent, response bytes
+    // and time spent waiting on the network (the rest of a call is parsing)
+    struct ApiStats {
+        uint64_t requests = 0;
+        uint64_t responseBytes = 0;
+        uint64_t networkUs = 0;
+    };
+    ApiStats getApiStats() const;
+    void resetApiStats();
+
 private:
     SuwayomiClient() = default;
     ~SuwayomiClient() = default;
@@ -645,18 +742,44 @@ private:
     // Internal GraphQL executor with retry control (for token refresh)
     std::string executeGraphQLInternal(const std::string& query, const std::string& variables, bool allowRetry);
 
+    // Read-through to m_responseCache: a fresh body skips fetch, a stale one
+    // goes to onStale before fetch runs. Returns fetch's body ("" on failure).
+    std::string cachedRequest(CachedOp op, const std::string& variables,
+                              const std::function<std::string()>& fetch,
+                              const std::function<void(const std::string&)>& onStale);
+
+    // Uncoalesced bodies of the public reads that go through m_inFlight
+    bool fetchMangaInternal(int mangaId, Manga& manga);
+    bool fetchMangaFullInternal(int mangaId, Manga& manga, const std::function<void(const Manga&)>& onStale);
+    bool fetchChaptersInternal(int mangaId, std::vector<Chapter>& chapters);
+    bool fetchMangaWithChaptersInternal(int mangaId, Manga& manga, std::vector<Chapter>& chapters);
+    bool fetchChapterPagesInternal(int mangaId, int chapterId, std::vector<Page>& pages);
+    bool fetchCategoriesInternal(std::vector<Category>& categories,
+                                 const std::function<void(const std::vector<Category>&)>& onStale);
+    bool fetchCategoryMangaInternal(int categoryId, std::vector<Manga>& manga, MangaProjection projection);
+
     // GraphQL-based implementations (primary API)
-    bool fetchSourceListGraphQL(std::vector<Source>& sources);
-    bool fetchPopularMangaGraphQL(int64_t sourceId, int page, std::vector<Manga>& manga, bool& hasNextPage);
-    bool fetchLatestMangaGraphQL(int64_t sourceId, int page, std::vector<Manga>& manga, bool& hasNextPage);
-    bool searchMangaGraphQL(int64_t sourceId, const std::string& query, int page, std::vector<Manga>& manga, bool& hasNextPage);
+    bool fetchSourceListGraphQL(std::vector<Source>& sources,
+                                const std::function<void(const std::vector<Source>&)>& onStale);
+    bool parseSourceListResponse(const std::string& response, std::vector<Source>& sources);
+    bool fetchPopularMangaGraphQL(int64_t sourceId, int page, std::vector<Manga>& manga, bool& hasNextPage,
+                                  MangaProjection projection);
+    bool fetchLatestMangaGraphQL(int64_t sourceId, int page, std::vector<Manga>& manga, bool& hasNextPage,
+                                 MangaProjection projection);
+    bool searchMangaGraphQL(int64_t sourceId, const std::string& query, int page, std::vector<Manga>& manga,
+                            bool& hasNextPage, MangaProjection projection);
     bool searchMangaWithFiltersGraphQL(int64_t sourceId, const std::string& query, int page,
                                         const std::vector<SourceFilter>& filters,
-                                        std::vector<Manga>& manga, bool& hasNextPage);
-    bool fetchSourceFiltersGraphQL(int64_t sourceId, std::vector<SourceFilter>& filters);
+                                        std::vector<Manga>& manga, bool& hasNextPage,
+                                        MangaProjection projection);
+    bool fetchSourceFiltersGraphQL(int64_t sourceId, std::vector<SourceFilter>& filters,
+                                   const std::function<void(const std::vector<SourceFilter>&)>& onStale);
+    bool parseSourceFiltersResponse(const std::string& response, std::vector<SourceFilter>& filters);
     std::string buildFilterChangesJson(const std::vector<SourceFilter>& filters);
-    bool fetchLibraryMangaGraphQL(std::vector<Manga>& manga);
-    bool fetchCategoriesGraphQL(std::vector<Category>& categories);
+    bool fetchLibraryMangaGraphQL(std::vector<Manga>& manga, MangaProjection projection);
+    bool fetchCategoriesGraphQL(std::vector<Category>& categories,
+                                const std::function<void(const std::vector<Category>&)>& onStale);
+    bool parseCategoriesResponse(const std::string& response, std::vector<Category>& categories);
     bool fetchChaptersGraphQL(int mangaId, std::vector<Chapter>& chapters);
     bool fetchMangaGraphQL(int mangaId, Manga& manga);
     bool refreshMangaGraphQL(int mangaId);  // fetchManga mutation - tells server to fetch from source
@@ -670,8 +793,8 @@ private:
     bool fetchReadingHistoryGraphQL(int offset, int limit, std::vector<ReadingHistoryItem>& history);
     bool globalSearchGraphQL(const std::string& query, std::vector<GlobalSearchResult>& results);
     bool setMangaCategoriesGraphQL(int mangaId, const std::vector<int>& categoryIds);
-    bool fetchCategoryMangaGraphQL(int categoryId, std::vector<Manga>& manga);
-    bool fetchCategoryMangaGraphQLFallback(int categoryId, std::vector<Manga>& manga);
+    bool fetchCategoryMangaGraphQL(int categoryId, std::vector<Manga>& manga, MangaProjection projection);
+    bool fetchCategoryMangaGraphQLFallback(int categoryId, std::vector<Manga>& manga, MangaProjection projection);
     bool fetchCategoriesWithMangaGraphQL(std::vector<Category>& categories, int categoryId, std::vector<Manga>& manga);
     bool fetchMangaWithChaptersGraphQL(int mangaId, Manga& manga, std::vector<Chapter>& chapters);
 
@@ -710,7 +833,9 @@ private:
     bool fetchSourceGraphQL(int64_t sourceId, Source& source);
 
     // Tracking GraphQL methods
-    bool fetchTrackersGraphQL(std::vector<Tracker>& trackers);
+    bool fetchTrackersGraphQL(std::vector<Tracker>& trackers,
+                              const std::function<void(const std::vector<Tracker>&)>& onStale);
+    bool parseTrackersResponse(const std::string& response, std::vector<Tracker>& trackers);
     bool fetchTrackerGraphQL(int trackerId, Tracker& tracker);
     bool fetchMangaTrackingGraphQL(int mangaId, std::vector<TrackRecord>& records);
     bool searchTrackerGraphQL(int trackerId, const std::string& query, std::vector<TrackSearchResult>& results);
@@ -735,7 +860,7 @@ private:
     Extension parseExtensionFromGraphQL(const std::string& json);
 
     // Parse GraphQL response data
-    Manga parseMangaFromGraphQL(const std::string& json);
+    Manga parseMangaFromGraphQL(const std::string& json, MangaProjection projection = MangaProjection::DETAIL);
     Chapter parseChapterFromGraphQL(const std::string& json);
     Source parseSourceFromGraphQL(const std::string& json);
     Category parseCategoryFromGraphQL(const std::string& json);
@@ -786,6 +911,13 @@ private:
     // hit 401 simultaneously and all try to refresh the token
     time_t m_lastTokenRefreshTime = 0;
 
+    ResponseCache m_responseCache;
+    SingleFlight m_inFlight;
+
+    std::atomic<uint64_t> m_apiRequests{0};
+    std::atomic<uint64_t> m_apiResponseBytes{0};
+    std::atomic<uint64_t> m_apiNetworkUs{0};
+
     // Login methods
     bool loginGraphQL(const std::string& username, const std::string& password);
     bool loginSimpleREST(const std::string& username, const std::string& password);
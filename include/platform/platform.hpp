@@ -20,6 +20,7 @@
 #include <functional>
 #include <cstdint>
 #include <mutex>
+#include <condition_variable>
 
 namespace platform {
 
@@ -42,18 +43,28 @@ bool isLocalPath(const std::string& url);
 /// Read an entire file into memory. Returns empty vector on failure.
 std::vector<uint8_t> readFile(const std::string& path);
 
+/// Read at most maxBytes from the start of a file. Returns empty vector on failure.
+std::vector<uint8_t> readFilePrefix(const std::string& path, size_t maxBytes);
+
 /// Write raw bytes to a file (creates/truncates). Returns true on success.
 bool writeFile(const std::string& path, const void* data, size_t size);
 
 /// Write a string to a file (creates/truncates). Returns true on success.
 bool writeFile(const std::string& path, const std::string& content);
 
+/// Append raw bytes to a file, creating it if needed. Returns true on success.
+bool appendFile(const std::string& path, const void* data, size_t size);
+
 /// Check if a file or directory exists.
 bool fileExists(const std::string& path);
 
 /// Delete a single file. Returns true on success.
 bool deleteFile(const std::string& path);
 
+/// Rename a file, replacing any existing file at the destination.
+/// Returns true on success.
+bool renameFile(const std::string& from, const std::string& to);
+
 /// Get file size in bytes. Returns -1 if file doesn't exist.
 int64_t fileSize(const std::string& path);
 
@@ -85,11 +96,19 @@ void launchThread(std::function<void()> task);
 /// Launch a thread with a large stack (256KB+ on Vita, 512KB on Switch).
 void launchLargeStackThread(std::function<void()> task);
 
+/// Number of ThreadPool workers behind asyncRun/asyncTask. Most tasks block
+/// on the network rather than the CPU, so this can exceed the core count.
+int workerThreadCount();
+
 /// Platform-safe condition variable wait with timeout.
 /// On Switch, polls instead of using wait_for (pthread_cond_timedwait is ENOSYS).
 /// Returns true if predicate became true, false on timeout.
 bool condWaitFor(std::mutex& mtx, std::unique_lock<std::mutex>& lock,
                  int milliseconds, std::function<bool()> predicate);
+/// Same, on a caller-owned condition variable so notify_one() ends the wait
+/// early. Switch still polls, so there it is only noticed within 50ms.
+bool condWaitFor(std::condition_variable& cv, std::unique_lock<std::mutex>& lock,
+                 int milliseconds, std::function<bool()> predicate);
 
 // ── Display / Image Constraints ────────────────────────────────────────
 
@@ -2,8 +2,8 @@
  * VitaSuwayomi - Async utilities
  * Simple async task execution with UI thread callbacks
  *
- * Threading is delegated to the platform abstraction layer
- * (platform::launchThread / platform::launchLargeStackThread)
+ * asyncRun/asyncTask run on the shared ThreadPool; asyncRunLargeStack still
+ * gets a dedicated thread from the platform layer (platform::launchLargeStackThread)
  * so no #ifdef platform code is needed here.
  */
 
@@ -12,6 +12,7 @@
 #include <functional>
 #include <borealis.hpp>
 #include "platform/platform.hpp"
+#include "utils/thread_pool.hpp"
 
 namespace vitasuwayomi {
 
@@ -23,6 +24,7 @@ inline void launchThread(std::function<void()> task) {
 } // namespace detail
 
 /// Run task with larger stack size — needed for file operations on Vita.
+/// Dedicated thread, so this is also the place for long-running loops.
 inline void asyncRunLargeStack(std::function<void()> task) {
     platform::launchLargeStackThread(std::move(task));
 }
@@ -32,7 +34,7 @@ inline void asyncRunLargeStack(std::function<void()> task) {
  */
 template<typename T>
 inline void asyncTask(std::function<T()> task, std::function<void(T)> callback) {
-    platform::launchThread([task, callback]() {
+    ThreadPool::getInstance().submit([task, callback]() {
         T result = task();
         brls::sync([callback, result]() {
             callback(result);
@@ -44,7 +46,7 @@ inline void asyncTask(std::function<T()> task, std::function<void(T)> callback)
  * Execute a void task asynchronously and call a callback on the UI thread when done.
  */
 inline void asyncTask(std::function<void()> task, std::function<void()> callback) {
-    platform::launchThread([task, callback]() {
+    ThreadPool::getInstance().submit([task, callback]() {
         task();
         brls::sync([callback]() {
             callback();
@@ -56,7 +58,20 @@ inline void asyncTask(std::function<void()> task, std::function<void()> callback
  * Execute a task asynchronously without a callback
  */
 inline void asyncRun(std::function<void()> task) {
-    platform::launchThread(std::move(task));
+    ThreadPool::getInstance().submit(std::move(task));
+}
+
+inline void asyncRun(std::function<void()> task, TaskPriority priority) {
+    ThreadPool::getInstance().submit(std::move(task), priority);
+}
+
+/**
+ * Execute a task asynchronously unless the owner is gone by the time a worker
+ * picks it up (pass the view's m_alive). Fetches only - see CancelToken.
+ */
+inline void asyncRun(std::function<void()> task, CancelToken token,
+                     TaskPriority priority = TaskPriority::NORMAL) {
+    ThreadPool::getInstance().submit(std::move(task), std::move(token), priority);
 }
 
 } // namespace vitasuwayomi
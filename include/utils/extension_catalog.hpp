@@ -0,0 +1,74 @@
+/**
+ * VitaSuwayomi - Extension Catalog
+ * On-disk copy of the server's extension list so the Extensions tab can draw
+ * immediately on launch. Entries are kept sorted by name with the per-language
+ * grouping stored alongside, and a fresh server list is merged in place so only
+ * added, removed or changed entries are touched (and nothing is rewritten when
+ * the catalog is unchanged).
+ *
+ * Plain value type: build or merge on a worker, then move it to the UI thread.
+ */
+
+#pragma once
+
+#include "app/suwayomi_client.hpp"
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace vitasuwayomi {
+
+class ExtensionCatalog {
+public:
+    struct LanguageGroup {
+        std::string lang;
+        std::vector<int> members;  // Indices into entries(), in name order
+    };
+
+    struct Delta {
+        int added = 0;
+        int removed = 0;
+        int changed = 0;
+        bool empty() const { return added == 0 && removed == 0 && changed == 0; }
+    };
+
+    // Returns false if there is no catalog on disk or it is unreadable
+    bool load();
+    bool save() const;
+
+    // Apply a full list from the server
+    Delta merge(const std::vector<Extension>& fresh);
+
+    const std::vector<Extension>& entries() const { return m_entries; }
+    const std::vector<LanguageGroup>& languageGroups() const { return m_groups; }
+    bool empty() const { return m_entries.empty(); }
+
+    // For local edits after install/update/uninstall (name and lang must not
+    // change). Not persisted; the next merge brings the server's view back.
+    Extension* find(const std::string& pkgName);
+
+    // Case-insensitive substring match on the name. Indices in name order.
+    std::vector<int> search(const std::string& query) const;
+
+    // Content hash of the catalog as last fetched, and when (unix seconds)
+    uint32_t version() const { return m_version; }
+    int64_t fetchedAt() const { return m_fetchedAt; }
+
+private:
+    void rebuildDerived(bool regroup);
+    static std::string getCatalogFilePath();
+
+    std::vector<Extension> m_entries;
+    std::vector<LanguageGroup> m_groups;
+    std::unordered_map<std::string, int> m_indexByPkg;
+
+    // Name index: lowercase names plus postings for every byte bigram
+    std::vector<std::string> m_nameLower;
+    std::unordered_map<uint16_t, std::vector<int>> m_bigrams;
+
+    uint32_t m_version = 0;
+    int64_t m_fetchedAt = 0;
+};
+
+} // namespace vitasuwayomi
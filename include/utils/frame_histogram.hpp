@@ -0,0 +1,90 @@
+/**
+ * VitaSuwayomi - Frame Histogram
+ * Fixed-size log-linear histogram of durations in microseconds, in the
+ * style of HdrHistogram: exact below 64us, then 32 buckets per power of two
+ * (about 3% relative error) up to MAX_US. Recording is a few shifts and an
+ * increment, so it can run every frame; percentiles walk the buckets.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+namespace vitasuwayomi {
+
+class FrameHistogram {
+public:
+    static constexpr int SUB_BITS = 6;
+    static constexpr uint32_t SUB_COUNT = 1u << SUB_BITS;       // Exact range
+    static constexpr uint32_t HALF_COUNT = SUB_COUNT / 2;       // Buckets per power of two
+    static constexpr uint32_t MAX_US = (1u << 22) - 1;          // ~4.2s; longer frames clamp
+    static constexpr int BUCKET_COUNT = (22 - SUB_BITS) * HALF_COUNT + SUB_COUNT;
+
+    void record(uint32_t us) {
+        if (us > MAX_US) us = MAX_US;
+        m_buckets[bucketIndex(us)]++;
+        m_count++;
+        m_totalUs += us;
+        if (us > m_maxUs) m_maxUs = us;
+    }
+
+    void recordMs(float ms) {
+        record(ms <= 0.0f ? 0 : static_cast<uint32_t>(ms * 1000.0f + 0.5f));
+    }
+
+    // Value at or below which percentile (0-100) of samples fall, in ms.
+    // Reports the top of the bucket (never above the recorded max).
+    float percentileMs(float percentile) const {
+        if (m_count == 0) return 0.0f;
+        if (percentile < 0.0f) percentile = 0.0f;
+        if (percentile > 100.0f) percentile = 100.0f;
+        uint64_t target = static_cast<uint64_t>(percentile / 100.0f * m_count + 0.5f);
+        if (target < 1) target = 1;
+
+        uint64_t seen = 0;
+        for (int i = 0; i < BUCKET_COUNT; i++) {
+            seen += m_buckets[i];
+            if (seen >= target) {
+                uint32_t top = bucketUpperUs(i);
+                return (top < m_maxUs ? top : m_maxUs) / 1000.0f;
+            }
+        }
+        return m_maxUs / 1000.0f;
+    }
+
+    float maxMs() const { return m_maxUs / 1000.0f; }
+    float meanMs() const { return m_count ? (m_totalUs / 1000.0f) / m_count : 0.0f; }
+    uint64_t count() const { return m_count; }
+    uint32_t bucketCount(int index) const { return m_buckets[index]; }
+
+    void reset() {
+        std::memset(m_buckets, 0, sizeof(m_buckets));
+        m_count = 0;
+        m_totalUs = 0;
+        m_maxUs = 0;
+    }
+
+    static int bucketIndex(uint32_t us) {
+        if (us < SUB_COUNT) return static_cast<int>(us);
+        int msb = 31 - __builtin_clz(us);
+        int shift = msb - (SUB_BITS - 1);  // Keeps the top SUB_BITS bits
+        return static_cast<int>(shift * HALF_COUNT + (us >> shift));
+    }
+
+    // Largest value that lands in bucket index
+    static uint32_t bucketUpperUs(int index) {
+        if (index < static_cast<int>(SUB_COUNT)) return static_cast<uint32_t>(index);
+        int shift = index / HALF_COUNT - 1;
+        uint32_t mantissa = index - shift * HALF_COUNT;
+        return ((mantissa + 1) << shift) - 1;
+    }
+
+private:
+    uint32_t m_buckets[BUCKET_COUNT] = {};
+    uint64_t m_count = 0;
+    uint64_t m_totalUs = 0;
+    uint32_t m_maxUs = 0;
+};
+
+} // namespace vitasuwayomi
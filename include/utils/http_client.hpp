@@ -21,6 +21,11 @@ struct HttpResponse {
     bool success = false;
 };
 
+// Receives the body received so far as it grows (2xx responses only);
+// fresh is true on the first call of each request. Returning false stops
+// the calls, not the transfer.
+using BodyProgressCallback = std::function<bool(const std::string& body, bool fresh)>;
+
 // HTTP request configuration
 struct HttpRequest {
     std::string url;
@@ -29,6 +34,8 @@ struct HttpRequest {
     std::map<std::string, std::string> headers;
     int timeout = 30;
     bool followRedirects = true;
+    size_t maxBytes = 0;  // > 0: ask for a byte range and stop reading after this many
+    BodyProgressCallback onBodyProgress;
 };
 
 /**
@@ -65,6 +72,7 @@ public:
     void setDefaultHeader(const std::string& key, const std::string& value);
     void removeDefaultHeader(const std::string& key);
     void clearDefaultHeaders();
+    const std::map<std::string, std::string>& getDefaultHeaders() const { return m_defaultHeaders; }
 
     // Configuration
     void setTimeout(int seconds) { m_timeout = seconds; }
@@ -74,6 +82,10 @@ public:
     // Simple get that returns body directly
     bool get(const std::string& url, std::string& response);
 
+    // GET only the first maxBytes of the body (Range request; servers that
+    // ignore Range are cut off once enough has arrived)
+    HttpResponse getPrefix(const std::string& url, size_t maxBytes);
+
     // Download file with progress callbacks
     // writeCallback: receives data chunks, return false to cancel
     // sizeCallback: called with total file size when known
@@ -13,6 +13,7 @@
 #include <mutex>
 #include <queue>
 #include <set>
+#include <unordered_map>
 #include <atomic>
 #include <condition_variable>
 #include <vector>
@@ -77,11 +78,22 @@ public:
     // Preload full-size image to cache (for manga reader)
     static void preloadFullSize(const std::string& url);
 
-    // Get image dimensions and suggested segment count for a URL (downloads image temporarily)
-    // Returns true if dimensions were obtained, false on error
+    // Get image dimensions and suggested segment count for a URL. Reads only the
+    // header bytes (HTTP Range / file prefix) for JPEG, PNG and WebP; other
+    // formats are downloaded whole. Returns true if dimensions were obtained.
     // suggestedSegments will be > 1 if the image is taller than MAX_TEXTURE_SIZE (2048)
     static bool getImageDimensions(const std::string& url, int& width, int& height, int& suggestedSegments);
 
+    // Decoded-page ring for the paged reader. The reader passes the pages it
+    // wants ready in priority order (current, N ahead, M behind in reading
+    // direction, spilling into the neighbouring chapter). Their decoded TGA
+    // is held outside the shared LRU so thumbnail churn can't evict it, and
+    // loadAsyncFullSize serves ring hits as upload-only. Pages that leave
+    // the window fall back to the LRU; missing pages are queued as preloads.
+    // The ring is capped in bytes; pages furthest down the list give way.
+    static void setPageRingWindow(const std::vector<std::string>& urls);
+    static void clearPageRing();
+
     // Clear image cache
     static void clearCache();
 
@@ -101,6 +113,16 @@ public:
     // the flag is cleared.
     static void setDeferTextureUploads(bool defer);
 
+    // Trim uniform white/black page margins from reader pages at decode
+    // time (ReaderSettings::cropBorders). Detected bounds are remembered
+    // per URL and cropped pages use their own memory/disk cache entries.
+    static void setCropBorders(bool enabled);
+
+    // Smoothed time from worker pickup to decoded texture data for recent
+    // full-size page loads (network/disk + decode). Used by the webtoon view
+    // to size its prefetch window to how far the reader travels meanwhile.
+    static int getAverageFullSizeLoadMs();
+
 private:
     // Pending load request for brls::Image
     struct LoadRequest {
@@ -132,7 +154,7 @@ private:
         std::vector<uint8_t> data;
     };
     static std::list<CacheEntry> s_cacheList;
-    static std::map<std::string, std::list<CacheEntry>::iterator> s_cacheMap;
+    static std::unordered_map<std::string, std::list<CacheEntry>::iterator> s_cacheMap;
     static size_t s_maxCacheSize;
     static size_t s_currentCacheMemory;
     static std::mutex s_cacheMutex;
@@ -140,6 +162,42 @@ private:
     // LRU cache helpers
     static void cachePut(const std::string& url, const std::vector<uint8_t>& data);
     static bool cacheGet(const std::string& url, std::vector<uint8_t>& data);
+    static void cacheErase(const std::string& url);
+
+    // Decoded tier: ready-to-upload RGBA keyed by URL and decode size, with
+    // its own byte budget. Thumbnails and covers live here instead of the
+    // TGA LRU, so grid re-entry goes straight to nvgCreateImageRGBA with no
+    // TGA parse or decode in between.
+    struct RGBAEntry {
+        std::string key;
+        std::vector<uint8_t> rgba;
+        int width = 0;
+        int height = 0;
+    };
+    static std::list<RGBAEntry> s_rgbaList;
+    static std::unordered_map<std::string, std::list<RGBAEntry>::iterator> s_rgbaMap;
+    static size_t s_rgbaMemory;
+    static std::mutex s_rgbaMutex;
+    static std::string rgbaKey(const std::string& url, int maxSize);
+    static void rgbaPut(const std::string& key, const std::vector<uint8_t>& rgba, int width, int height);
+    static bool rgbaGet(const std::string& key, std::vector<uint8_t>& rgba, int& width, int& height);
+    static bool rgbaHas(const std::string& key);
+
+    // Decoded-page ring (see setPageRingWindow). Slots are rebuilt when the
+    // window moves; a slot with empty data is still being decoded.
+    // Shared with the RotatableImage it is uploaded to, so a hit is not copied
+    struct PageRingSlot {
+        std::string url;
+        std::shared_ptr<const std::vector<uint8_t>> data;
+        size_t bytes() const { return data ? data->size() : 0; }
+    };
+    static std::vector<PageRingSlot> s_pageRing;
+    static std::mutex s_pageRingMutex;
+    // Hand a decoded page to the ring; false if the URL isn't in the window
+    // or the page doesn't fit the byte budget next to nearer pages
+    static bool pageRingOffer(const std::string& url, const std::vector<uint8_t>& data);
+    static bool pageRingGet(const std::string& url, std::shared_ptr<const std::vector<uint8_t>>& data);
+    static bool pageRingHas(const std::string& url);
     static std::string s_authUsername;
     static std::string s_authPassword;
     static std::string s_accessToken;    // JWT access token for Bearer auth
@@ -168,7 +226,9 @@ private:
     // Background threads push completed images here instead of calling brls::sync() directly.
     // A single scheduled callback processes a few textures per frame.
     struct PendingTextureUpdate {
-        std::vector<uint8_t> data;
+        std::vector<uint8_t> rgba;
+        int width = 0;
+        int height = 0;
         brls::Image* target;
         LoadCallback callback;
         std::shared_ptr<bool> alive;  // If set and *alive==false, skip (owner destroyed)
@@ -179,9 +239,9 @@ private:
     static std::atomic<bool> s_deferTextureUploads;
     static constexpr int MAX_TEXTURES_PER_FRAME = 1;  // Limit GPU uploads per frame (each upload stalls Vita GPU for ~15-20ms)
 
-    // Queue a texture for batched upload on the main thread
-    static void queueTextureUpdate(const std::vector<uint8_t>& data, brls::Image* target, LoadCallback callback,
-                                   std::shared_ptr<bool> alive = nullptr);
+    // Queue decoded RGBA for batched upload on the main thread
+    static void queueTextureUpdate(std::vector<uint8_t> rgba, int width, int height, brls::Image* target,
+                                   LoadCallback callback, std::shared_ptr<bool> alive = nullptr);
     // Process a batch of pending texture uploads (called on main thread)
     static void processPendingTextures();
 
@@ -207,14 +267,20 @@ private:
     // Limits GPU uploads to MAX_ROTATABLE_TEXTURES_PER_FRAME per frame to prevent
     // the "group loading" appearance where multiple images pop in simultaneously.
     struct PendingRotatableTextureUpdate {
-        // Single-texture path
+        // Single-texture path; sharedData instead of data for page ring hits
         std::vector<uint8_t> data;
+        std::shared_ptr<const std::vector<uint8_t>> sharedData;
         // Multi-segment path (auto-split tall images)
         std::vector<std::vector<uint8_t>> segmentDatas;
         int origW = 0;
         int origH = 0;
         std::vector<int> segHeights;
         bool isSegmented = false;  // true = use segmentDatas, false = use data
+        // Streaming decode: streamId opens a stream on the first update; later
+        // updates only append segments to it (streamAppend), the last closes it
+        uint64_t streamId = 0;
+        bool streamAppend = false;
+        bool streamLast = false;
         RotatableImage* target = nullptr;
         RotatableLoadCallback callback;
         std::shared_ptr<bool> alive;
@@ -222,15 +288,24 @@ private:
     static std::queue<PendingRotatableTextureUpdate> s_pendingRotatableTextures;
     static std::mutex s_pendingRotatableMutex;
     static std::atomic<bool> s_pendingRotatableScheduled;
-    static constexpr int MAX_ROTATABLE_TEXTURES_PER_FRAME = 1;  // 1 per frame to avoid stutter during scroll
+    // 1 per frame to avoid stutter during scroll. Tall pages count one per
+    // RotatableImage::TILE_ROWS tile, so a long strip streams in over frames.
+    static constexpr int MAX_ROTATABLE_TEXTURES_PER_FRAME = 1;
 
     // Queue a RotatableImage texture for batched upload (single-texture path)
     static void queueRotatableTextureUpdate(const std::vector<uint8_t>& data, RotatableImage* target,
                                             RotatableLoadCallback callback, std::shared_ptr<bool> alive = nullptr);
-    // Queue a RotatableImage texture for batched upload (multi-segment path)
+    static void queueRotatableTextureUpdate(std::shared_ptr<const std::vector<uint8_t>> data, RotatableImage* target,
+                                            RotatableLoadCallback callback, std::shared_ptr<bool> alive = nullptr);
+    // Queue a RotatableImage texture for batched upload (multi-segment path).
+    // A non-zero streamId leaves the image open for queueRotatableStreamUpdate.
     static void queueRotatableSegmentUpdate(std::vector<std::vector<uint8_t>> segDatas, int origW, int origH,
                                             std::vector<int> segHeights, RotatableImage* target,
-                                            RotatableLoadCallback callback, std::shared_ptr<bool> alive = nullptr);
+                                            RotatableLoadCallback callback, std::shared_ptr<bool> alive = nullptr,
+                                            uint64_t streamId = 0);
+    // Queue the next segments of a streaming decode (last closes the stream)
+    static void queueRotatableStreamUpdate(uint64_t streamId, std::vector<std::vector<uint8_t>> segDatas,
+                                           std::vector<int> segHeights, bool last, std::shared_ptr<bool> alive);
     // Process a batch of pending RotatableImage texture uploads (called on main thread)
     static void processPendingRotatableTextures();
 };
@@ -0,0 +1,35 @@
+/**
+ * VitaSuwayomi - Image Pipeline kernels
+ * The CPU decode/resize stages behind ImageLoader, exposed so they can be
+ * driven without a window or a server (bench_image_pipeline). Every kernel
+ * returns a TGA buffer (18-byte header + BGRA pixels) ready for upload, or
+ * an empty vector on failure.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace vitasuwayomi {
+
+// Fused downscale + RGBA->BGRA swizzle of a raw RGBA image
+std::vector<uint8_t> downscaleRGBAtoTGA(const uint8_t* src, int srcW, int srcH,
+                                         int dstW, int dstH);
+
+// First frame of a GIF, fitted within maxSize
+std::vector<uint8_t> decodeGIFToTGA(const uint8_t* data, size_t size, int maxSize);
+
+// Number of maxSize-tall segments a width x height page is split into
+int calculateSegments(int width, int height, int maxSize);
+
+// One horizontal segment of a tall WebP page
+std::vector<uint8_t> convertWebPtoTGASegment(const uint8_t* webpData, size_t webpSize,
+                                              int segment, int totalSegments, int maxSize);
+
+// One horizontal segment of a tall JPEG/PNG page
+std::vector<uint8_t> convertImageToTGASegment(const uint8_t* data, size_t dataSize,
+                                               int segment, int totalSegments, int maxSize);
+
+} // namespace vitasuwayomi
@@ -31,6 +31,17 @@ public:
     bool hasCategoryCache(int categoryId);
     void invalidateCategoryCache(int categoryId);
 
+    // Delta sync position of a cached category list. Tied to the server it
+    // came from; lastFullSync is when the list was last fetched in full (Unix s).
+    bool saveCategorySyncState(int categoryId, const std::string& serverUrl,
+                               const LibrarySyncWatermark& watermark, int64_t lastFullSync);
+    bool loadCategorySyncState(int categoryId, const std::string& serverUrl,
+                               LibrarySyncWatermark& watermark, int64_t& lastFullSync);
+    // Merges a delta into a category list: manga no longer in the category are
+    // dropped, changed ones replaced and new ones appended. manga holds the
+    // cached list on entry and the merged list, which is also saved, on return.
+    bool applyCategoryDelta(int categoryId, const CategoryMangaDelta& delta, std::vector<Manga>& manga);
+
     // All-library manga caching (flat list for NO_GROUPING / BY_SOURCE modes)
     bool saveAllLibraryManga(const std::vector<Manga>& manga);
     bool loadAllLibraryManga(std::vector<Manga>& manga);
@@ -49,9 +60,13 @@ public:
     std::string getCoverCachePath(int mangaId);
 
     // Reader page image caching (decoded TGA data cached to disk)
-    bool savePageImage(int mangaId, int chapterId, int pageIndex, const std::vector<uint8_t>& imageData);
-    bool loadPageImage(int mangaId, int chapterId, int pageIndex, std::vector<uint8_t>& imageData);
-    bool hasPageCache(int mangaId, int chapterId, int pageIndex);
+    // cropped selects the border-cropped variant so toggling cropBorders never
+    // serves a page decoded under the other setting.
+    bool savePageImage(int mangaId, int chapterId, int pageIndex, const std::vector<uint8_t>& imageData,
+                       bool cropped = false);
+    bool loadPageImage(int mangaId, int chapterId, int pageIndex, std::vector<uint8_t>& imageData,
+                       bool cropped = false);
+    bool hasPageCache(int mangaId, int chapterId, int pageIndex, bool cropped = false);
     void clearPageCache();  // Clear all cached pages
     void clearPageCache(int mangaId);  // Clear pages for a specific manga
 
@@ -67,6 +82,24 @@ public:
     bool hasChaptersCache(int mangaId);
     void invalidateChaptersCache(int mangaId);
 
+    // Chapter page-list caching (page image URLs keyed by chapterId) so
+    // reopening or preloading a chapter skips fetchChapterPages. Server URLs
+    // are stored relative to the server, and entries expire after a TTL.
+    bool saveChapterPages(int chapterId, const std::vector<Page>& pages);
+    bool loadChapterPages(int chapterId, std::vector<Page>& pages);
+    // Drop the cached list when the server's chapter info disagrees with it
+    // (different page count, or chapter re-fetched after the list was saved).
+    // Returns true if the cached list was dropped.
+    bool validateChapterPages(const Chapter& chapter);
+    void invalidateChapterPages(int chapterId);
+    void clearChapterPagesCache();
+
+    // Natural width/height of each page of a chapter, by page index (0x0 =
+    // unknown), so the webtoon strip can be laid out before pages load.
+    // Dropped together with the chapter's page list.
+    bool savePageDimensions(int chapterId, const std::vector<std::pair<int, int>>& sizes);
+    bool loadPageDimensions(int chapterId, std::vector<std::pair<int, int>>& sizes);
+
     // Cache management
     void clearAllCache();
     void clearCoverCache();
@@ -90,12 +123,13 @@ private:
     std::string getCoverCacheDir();
     std::string getMangaDetailsCacheDir();
     std::string getCategoryFilePath(int categoryId);
+    std::string getCategorySyncFilePath(int categoryId);
     std::string getCategoriesFilePath();
     std::string getAllLibraryFilePath();
     std::string getMangaDetailsFilePath(int mangaId);
     bool ensureDirectoryExists(const std::string& path);
     std::string getPageCacheDir();
-    std::string getPageCachePath(int mangaId, int chapterId, int pageIndex);
+    std::string getPageCachePath(int mangaId, int chapterId, int pageIndex, bool cropped = false);
 
     // Serialize/deserialize manga (basic - for category lists)
     std::string serializeManga(const Manga& manga);
@@ -119,6 +153,9 @@ private:
     bool deserializeChapter(const std::string& line, Chapter& chapter);
     std::string getChaptersCacheDir();
     std::string getChaptersFilePath(int mangaId);
+    std::string getPageListsCacheDir();
+    std::string getPageListFilePath(int chapterId);
+    std::string getPageDimensionsFilePath(int chapterId);
 
     bool m_enabled = true;
     bool m_coverCacheEnabled = true;
@@ -0,0 +1,107 @@
+/**
+ * VitaSuwayomi - Offline Library Search
+ * Inverted trigram index over title, author, artist, genre and description
+ * of library manga. Built incrementally from the lists LibraryCache already
+ * holds, persisted next to them, and queried without touching the server so
+ * it keeps working in downloadsOnlyMode.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "app/suwayomi_client.hpp"
+
+namespace vitasuwayomi {
+
+class LibrarySearchIndex {
+public:
+    struct Result {
+        int mangaId;
+        float score;
+    };
+
+    static LibrarySearchIndex& getInstance();
+
+    // Add or refresh documents for the given manga. Entries whose indexed
+    // fields are unchanged are skipped, so calling this with the whole
+    // library after every load is cheap. Persists the index shortly after
+    // if anything changed; returns whether it did.
+    bool update(const std::vector<Manga>& mangaList);
+    // Same as update() but on a worker thread (copies the list). onChanged
+    // runs on the main thread once the list is indexed, if anything changed.
+    void updateAsync(const std::vector<Manga>& mangaList, std::function<void()> onChanged = nullptr);
+
+    void remove(int mangaId);
+    void clear();  // Drops the in-memory index and its file
+
+    // Ranked fuzzy search. Typos and partial words still match as long as
+    // enough of the query's trigrams hit; exact title matches rank first.
+    std::vector<Result> search(const std::string& query, size_t maxResults = 200);
+
+    size_t size();
+
+private:
+    LibrarySearchIndex() = default;
+    ~LibrarySearchIndex() = default;
+    LibrarySearchIndex(const LibrarySearchIndex&) = delete;
+    LibrarySearchIndex& operator=(const LibrarySearchIndex&) = delete;
+
+    struct Gram {
+        uint32_t key;
+        uint16_t weight;
+    };
+
+    struct Doc {
+        int mangaId = 0;
+        uint32_t signature = 0;
+        std::string title;         // Normalized, for exact/prefix bonuses
+        std::vector<Gram> grams;   // Deduplicated, weights summed over fields
+    };
+
+    struct Posting {
+        uint32_t slot;
+        uint16_t weight;
+    };
+
+    static std::string normalize(const std::string& text);
+    static void addGrams(const std::string& normalized, uint16_t weight,
+                         std::unordered_map<uint32_t, uint16_t>& out);
+    static uint32_t computeSignature(const Manga& manga);
+    static Doc buildDoc(const Manga& manga, uint32_t signature);
+
+    void ensureLoaded();    // Caller holds m_mutex
+    void rebuildPostings(); // Caller holds m_mutex
+    bool load();
+    void save();
+    void scheduleSaveLocked();  // Caller holds m_mutex
+    std::string serialize();  // Caller holds m_mutex
+    std::string getIndexFilePath();
+
+    std::mutex m_mutex;
+    std::mutex m_saveMutex;   // Orders file writes so an older snapshot never lands last
+    bool m_loaded = false;
+    bool m_postingsDirty = true;
+    std::vector<Doc> m_docs;                   // Slot-addressed; removed slots have mangaId 0
+    std::unordered_map<int, uint32_t> m_slotById;
+    std::unordered_map<uint32_t, std::vector<Posting>> m_postings;
+    uint64_t m_saveTimer = 0;  // Pending debounced save
+
+    // Per-query scratch, sized to m_docs so queries do not allocate per doc
+    std::vector<float> m_scratchScore;
+    std::vector<uint16_t> m_scratchHits;
+
+    // updateAsync coalesces into a single worker; lists queued while it is
+    // busy are merged by manga ID, newest entry wins
+    std::mutex m_queueMutex;
+    std::vector<Manga> m_queuedList;
+    std::vector<std::function<void()>> m_queuedCallbacks;
+    bool m_hasQueued = false;
+    bool m_workerRunning = false;
+};
+
+} // namespace vitasuwayomi
@@ -2,7 +2,9 @@
  * VitaSuwayomi - Performance Debug Overlay
  * Lightweight FPS/frame-time overlay for profiling rendering bottlenecks.
  * Shows: FPS, frame time, texture upload queue depth, draw call estimate,
- * and per-section timing breakdown.
+ * and per-section timing breakdown. While enabled, frame and section times
+ * also go into per-screen histograms (p50/p95/p99/max plus jank counts) that
+ * can be dumped as CSV.
  */
 
 #pragma once
@@ -11,18 +13,29 @@
 #include <chrono>
 #include <string>
 #include <cstdio>
+#include "utils/frame_histogram.hpp"
 
 namespace vitasuwayomi {
 
+// Screen whose draw drives the frame timing; frame statistics are kept per screen
+enum class PerfScreen {
+    OTHER = 0,
+    GRID,
+    READER,
+    WEBTOON,
+    COUNT
+};
+
 class PerfOverlay {
 public:
     static PerfOverlay& getInstance();
 
     // Call at the very START of the frame (before any drawing)
-    void beginFrame();
+    void beginFrame(PerfScreen screen = PerfScreen::OTHER);
 
-    // Call at the very END of the frame (after all drawing)
-    void endFrame();
+    // Call at the very END of the frame (after all drawing). Only closes a
+    // frame the same screen began; anything else is dropped, not recorded.
+    void endFrame(PerfScreen screen = PerfScreen::OTHER);
 
     // Mark a named section start/end for breakdown timing
     void beginSection(const char* name);
@@ -34,11 +47,26 @@ public:
     // Record pending texture queue size
     void recordPendingTextures(int count);
 
+    // Record one reader page turn: time from the turn until the new page's
+    // texture is ready. Recorded even while the overlay is hidden.
+    void recordPageTurn(float ms);
+
+    // Page-turn latency percentile (0-100) over the recent turn history,
+    // 0 if no turns were recorded yet
+    float getPageTurnPercentile(float percentile) const;
+
+    // Frame-time percentile (0-100) on a screen since the overlay was enabled
+    float getFramePercentile(PerfScreen screen, float percentile) const;
+
+    // Writes the per-screen frame and section statistics as CSV
+    bool dumpStats(const std::string& path) const;
+    void resetStats();
+
     // Draw the overlay (call at end of frame, before endFrame)
     void draw(NVGcontext* vg, float screenWidth, float screenHeight);
 
-    // Enable/disable
-    void setEnabled(bool enabled) { m_enabled = enabled; }
+    // Enable/disable. Enabling starts a fresh set of statistics.
+    void setEnabled(bool enabled);
     bool isEnabled() const { return m_enabled; }
 
     // Flush and close log file
@@ -48,6 +76,9 @@ private:
     PerfOverlay() = default;
     ~PerfOverlay();
 
+    // Frame and section timing also runs while PerfTrace records
+    bool isTiming() const;
+
     bool m_enabled = false;
 
     // Log file
@@ -62,6 +93,9 @@ private:
     using TimePoint = Clock::time_point;
 
     TimePoint m_frameStart;
+    uint64_t m_frameStartUs = 0;  // Same instant on the PerfTrace clock
+    bool m_frameOpen = false;     // beginFrame ran since the last endFrame
+    PerfScreen m_frameScreen = PerfScreen::OTHER;
     TimePoint m_lastFpsUpdate;
     int m_frameCount = 0;
     float m_fps = 0.0f;
@@ -78,15 +112,33 @@ private:
     struct Section {
         const char* name = nullptr;
         TimePoint start;
+        uint64_t startUs = 0;  // PerfTrace clock
         float lastMs = 0.0f;
     };
     Section m_sections[MAX_SECTIONS];
     int m_sectionCount = 0;
 
+    // Per-screen histograms (sections indexed like m_sections)
+    struct ScreenStats {
+        FrameHistogram frames;
+        FrameHistogram sections[MAX_SECTIONS];
+        uint64_t jank60 = 0;  // Frames past 1.5x the 60fps period (a dropped vsync)
+        uint64_t jank30 = 0;  // Frames past 1.5x the 30fps period
+    };
+    static constexpr int SCREEN_COUNT = static_cast<int>(PerfScreen::COUNT);
+    ScreenStats m_screenStats[SCREEN_COUNT];
+    static const char* screenName(PerfScreen screen);
+
     // GPU/texture stats
     int m_textureUploadsThisFrame = 0;
     int m_pendingTextures = 0;
 
+    // Page-turn latency ring (most recent TURN_HISTORY_SIZE turns)
+    static constexpr int TURN_HISTORY_SIZE = 64;
+    float m_turnHistory[TURN_HISTORY_SIZE] = {};
+    int m_turnIndex = 0;
+    int m_turnCount = 0;
+
     // Helpers
     int findSection(const char* name);
 };
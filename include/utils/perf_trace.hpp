@@ -0,0 +1,113 @@
+/**
+ * VitaSuwayomi - Perf Trace
+ * Timeline recorder for attributing frame hitches. PERF_TRACE_SCOPE markers
+ * on any thread append a complete event to that thread's own ring buffer
+ * without locking; start()/stop() bracket a recording and exportJson()
+ * writes it as Chrome trace_event JSON (chrome://tracing, Perfetto).
+ * PerfOverlay frames and sections are recorded on the main thread, so a
+ * slow frame lines up against the decode, upload or parse spans around it.
+ * A marker costs one relaxed atomic load while nothing is recording.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace vitasuwayomi {
+
+class PerfTrace {
+public:
+    static PerfTrace& getInstance();
+
+    // Starts a new recording, dropping the events of the previous one
+    void start();
+    void stop();
+    bool isRecording() const { return m_recording.load(std::memory_order_relaxed); }
+
+    // Writes the current recording; safe while still recording
+    bool exportJson(const std::string& path);
+
+    // Labels the calling thread in the timeline. name must outlive the trace
+    // (a string literal).
+    static void setThreadName(const char* name);
+
+    // Microseconds on the trace clock
+    static uint64_t nowUs();
+
+    // Adds one span on the calling thread. name must be a string literal.
+    void record(const char* name, uint64_t startUs, uint64_t endUs);
+
+private:
+    PerfTrace() = default;
+    PerfTrace(const PerfTrace&) = delete;
+    PerfTrace& operator=(const PerfTrace&) = delete;
+
+    static constexpr size_t EVENTS_PER_THREAD = 4096;  // Oldest spans are overwritten
+    static constexpr size_t MAX_THREADS = 32;          // Live threads beyond this are not traced
+
+    // Relaxed atomics so the exporter may read a slot while it is rewritten
+    struct Event {
+        std::atomic<const char*> name{nullptr};
+        std::atomic<uint64_t> startUs{0};
+        std::atomic<uint32_t> durUs{0};
+    };
+
+    // Written only by its thread; head is published with release so the
+    // exporter sees complete events below it. Handed to a new thread once its
+    // owner exits.
+    struct ThreadBuffer {
+        int tid = 0;  // Changed only under m_mutex
+        std::atomic<bool> inUse{true};
+        std::atomic<const char*> name{nullptr};
+        std::atomic<uint64_t> generation{0};
+        std::atomic<uint64_t> head{0};
+        std::unique_ptr<Event[]> events;
+    };
+
+    // Releases the calling thread's buffer when the thread exits
+    struct ThreadHandle {
+        ThreadBuffer* buffer = nullptr;
+        ~ThreadHandle() {
+            if (buffer) buffer->inUse.store(false, std::memory_order_release);
+        }
+    };
+    static thread_local ThreadHandle s_thread;
+
+    ThreadBuffer* bufferForThisThread();
+
+    std::mutex m_mutex;  // Guards m_buffers (thread registration and export)
+    std::vector<std::unique_ptr<ThreadBuffer>> m_buffers;
+    int m_nextTid = 1;
+    std::atomic<bool> m_recording{false};
+    std::atomic<uint64_t> m_generation{0};
+};
+
+// Records the enclosing scope while a trace is recording
+class PerfTraceScope {
+public:
+    explicit PerfTraceScope(const char* name)
+        : m_name(name), m_active(PerfTrace::getInstance().isRecording()),
+          m_startUs(m_active ? PerfTrace::nowUs() : 0) {}
+    ~PerfTraceScope() {
+        if (m_active) PerfTrace::getInstance().record(m_name, m_startUs, PerfTrace::nowUs());
+    }
+
+    PerfTraceScope(const PerfTraceScope&) = delete;
+    PerfTraceScope& operator=(const PerfTraceScope&) = delete;
+
+private:
+    const char* m_name;
+    bool m_active;
+    uint64_t m_startUs;
+};
+
+#define PERF_TRACE_CONCAT_(a, b) a##b
+#define PERF_TRACE_CONCAT(a, b)  PERF_TRACE_CONCAT_(a, b)
+#define PERF_TRACE_SCOPE(name)   PerfTraceScope PERF_TRACE_CONCAT(perfTraceScope_, __LINE__)(name)
+
+} // namespace vitasuwayomi
@@ -0,0 +1,94 @@
+/**
+ * VitaSuwayomi - Response Cache
+ * Raw response bodies for SuwayomiClient's read-only queries, keyed by
+ * operation, server and a hash of the variables. Each operation has a TTL:
+ * inside it the cached body is used without a request, past it the body is
+ * still handed out as stale while the caller revalidates. Operations marked
+ * persistent are also written to cache/responses so a cold start can draw
+ * from disk.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace vitasuwayomi {
+
+enum class CachedOp {
+    CATEGORIES = 0,
+    SOURCES,
+    MANGA_FULL,
+    TRACKERS,
+    SOURCE_FILTERS,
+    COUNT
+};
+
+class ResponseCache {
+public:
+    enum class Freshness { MISS, FRESH, STALE };
+
+    struct Policy {
+        const char* name;  // Also the disk file prefix
+        int ttlSeconds;
+        bool persist;
+    };
+
+    static const Policy& policy(CachedOp op);
+
+    // scope separates servers; variables is whatever identifies the request
+    Freshness lookup(CachedOp op, const std::string& scope, const std::string& variables,
+                     std::string& body);
+    // generation is what generation(op) returned before the request was sent;
+    // the body is dropped if op was invalidated since, as it may predate a
+    // mutation
+    void store(CachedOp op, const std::string& scope, const std::string& variables,
+               const std::string& body, uint64_t generation);
+
+    // Bumped by every invalidate(op) and clear()
+    uint64_t generation(CachedOp op);
+
+    void invalidate(CachedOp op);
+    void clear();
+
+    // Drops entries for op when it goes out of scope, i.e. after the mutation
+    // it guards has finished on whichever path it took
+    class InvalidateOnExit {
+    public:
+        InvalidateOnExit(ResponseCache& cache, CachedOp op) : m_cache(cache), m_op(op) {}
+        ~InvalidateOnExit() { m_cache.invalidate(m_op); }
+        InvalidateOnExit(const InvalidateOnExit&) = delete;
+        InvalidateOnExit& operator=(const InvalidateOnExit&) = delete;
+
+    private:
+        ResponseCache& m_cache;
+        CachedOp m_op;
+    };
+
+private:
+    struct Entry {
+        CachedOp op = CachedOp::CATEGORIES;
+        std::string body;
+        int64_t storedAt = 0;  // Unix seconds
+        uint64_t lastUsed = 0;
+    };
+
+    static uint64_t makeKey(CachedOp op, const std::string& scope, const std::string& variables);
+    static std::string getCacheDir();
+    static std::string getFilePath(CachedOp op, uint64_t key);
+
+    bool loadFromDisk(CachedOp op, uint64_t key, Entry& entry);
+    void evictIfNeeded();
+
+    std::mutex m_mutex;
+    std::mutex m_diskMutex;  // Orders file writes and unlinks; taken before m_mutex
+    std::unordered_map<uint64_t, Entry> m_entries;
+    uint64_t m_generations[static_cast<int>(CachedOp::COUNT)] = {};
+    size_t m_bytes = 0;
+    uint64_t m_useCounter = 0;
+    bool m_dirReady = false;
+};
+
+} // namespace vitasuwayomi
@@ -0,0 +1,76 @@
+/**
+ * VitaSuwayomi - Settings Store
+ * Typed key-value store behind settings persistence. Values live in a sorted
+ * map so per-item groups (keys sharing a "section." prefix, e.g. the per-manga
+ * reader settings) are a contiguous range, and the on-disk form is a flat
+ * binary record list with no size limit.
+ *
+ * Setters only mark the store dirty when a value actually changes. A writer
+ * wraps a full snapshot in beginSnapshot()/endSnapshot() so keys that were
+ * not set again (a removed category sort mode, say) are dropped.
+ *
+ * Not thread-safe: the owner serialises access.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace vitasuwayomi {
+
+class SettingsStore {
+public:
+    bool getBool(const std::string& key, bool defaultVal = false) const;
+    int64_t getInt(const std::string& key, int64_t defaultVal = 0) const;
+    std::string getString(const std::string& key, const std::string& defaultVal = "") const;
+    std::vector<std::string> getList(const std::string& key) const;
+    bool has(const std::string& key) const { return m_values.count(key) > 0; }
+
+    void setBool(const std::string& key, bool value);
+    void setInt(const std::string& key, int64_t value);
+    void setString(const std::string& key, const std::string& value);
+    void setList(const std::string& key, const std::vector<std::string>& value);
+
+    // Distinct child names under "section.", e.g. the manga IDs in
+    // "mangaReaderSettings.<id>.readingMode"
+    std::vector<std::string> children(const std::string& section) const;
+
+    void beginSnapshot();
+    void endSnapshot();
+
+    bool isDirty() const { return m_dirty; }
+    size_t size() const { return m_values.size(); }
+
+    // Binary form. save() writes a temp file and renames it over the target
+    // so a crash mid-write leaves the previous copy intact.
+    bool load(const std::string& path);
+    bool save(const std::string& path);
+
+    // One-pass import of the legacy settings.json. Nested objects flatten to
+    // dotted keys and arrays become string lists.
+    bool importJson(const std::string& content);
+
+private:
+    enum class Type : uint8_t { BOOL = 0, INT = 1, STRING = 2, LIST = 3 };
+
+    struct Value {
+        Type type = Type::INT;
+        int64_t i = 0;
+        std::string s;
+        std::vector<std::string> list;
+        uint32_t generation = 0;
+    };
+
+    Value& slot(const std::string& key, Type type, bool& isNew);
+    bool parseBinary(const std::vector<uint8_t>& data);
+
+    std::map<std::string, Value> m_values;
+    uint32_t m_generation = 0;
+    bool m_inSnapshot = false;
+    bool m_dirty = false;
+};
+
+} // namespace vitasuwayomi
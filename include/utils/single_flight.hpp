@@ -0,0 +1,91 @@
+/**
+ * VitaSuwayomi - Single Flight
+ * Coalesces concurrent identical reads: while one call for a key is running,
+ * later callers with the same key wait for it and receive a copy of its
+ * parsed result instead of issuing their own request. Nothing is kept once
+ * the call returns, so this never serves old data.
+ *
+ * Only for read-only calls. Each key must always carry the same result type,
+ * and a call must not re-enter run() with its own key.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace vitasuwayomi {
+
+class SingleFlight {
+public:
+    template<typename T>
+    bool run(const std::string& key, T& out, const std::function<bool(T&)>& fn) {
+        std::shared_ptr<Flight> flight;
+        bool leader = false;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            auto it = m_flights.find(key);
+            if (it != m_flights.end()) {
+                flight = it->second;
+                flight->waiters++;
+            } else {
+                flight = std::make_shared<Flight>();
+                m_flights[key] = flight;
+                leader = true;
+            }
+        }
+
+        if (!leader) {
+            m_joined.fetch_add(1);
+            std::unique_lock<std::mutex> lock(flight->mutex);
+            flight->cv.wait(lock, [&flight]() { return flight->done; });
+            if (!flight->ok) return false;
+            out = *std::static_pointer_cast<T>(flight->result);
+            return true;
+        }
+
+        bool ok = fn(out);
+
+        // Unpublish first so a caller arriving from here on starts a new call
+        int waiters = 0;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_flights.erase(key);
+            waiters = flight->waiters;
+        }
+        {
+            std::lock_guard<std::mutex> lock(flight->mutex);
+            // Copy only when someone is waiting for it
+            if (ok && waiters > 0) flight->result = std::make_shared<T>(out);
+            flight->ok = ok;
+            flight->done = true;
+        }
+        flight->cv.notify_all();
+        return ok;
+    }
+
+    // Calls that were served by another caller's request
+    uint64_t joinedCount() const { return m_joined.load(); }
+
+private:
+    struct Flight {
+        std::mutex mutex;
+        std::condition_variable cv;  // Untimed wait; the leader always finishes
+        bool done = false;
+        bool ok = false;
+        int waiters = 0;  // Guarded by SingleFlight::m_mutex
+        std::shared_ptr<void> result;
+    };
+
+    std::mutex m_mutex;
+    std::unordered_map<std::string, std::shared_ptr<Flight>> m_flights;
+    std::atomic<uint64_t> m_joined{0};
+};
+
+} // namespace vitasuwayomi
@@ -0,0 +1,93 @@
+/**
+ * VitaSuwayomi - GraphQL Subscription Client
+ * Minimal graphql-transport-ws client over a WebSocket carried by libcurl's
+ * CONNECT_ONLY socket (works with libcurl builds that lack native ws support).
+ * One connection is shared by all subscriptions; it is opened when the first
+ * subscription is added and closed when the last one is removed, so an idle
+ * app sends nothing. The worker sleeps in select() on the socket until data,
+ * a subscribe/unsubscribe, or the next keepalive ping is due.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace vitasuwayomi {
+
+class SubscriptionClient {
+public:
+    // Both handlers run on the subscription worker thread; wrap UI work in brls::sync.
+    // onNext receives the whole "next" message (payload.data holds the result).
+    using MessageHandler = std::function<void(const std::string& message)>;
+    // onState(true) once the subscription is active on a live connection,
+    // onState(false) when the connection drops or cannot be opened (callers
+    // fall back to polling until it comes back).
+    using StateHandler = std::function<void(bool live)>;
+
+    static SubscriptionClient& getInstance();
+
+    // Returns a handle for unsubscribe(), or -1 if no server is configured
+    int subscribe(const std::string& query, MessageHandler onNext, StateHandler onState = nullptr);
+    void unsubscribe(int id);
+
+    bool isLive() const { return m_live.load(); }
+
+    // Override the server (base URL, e.g. "http://127.0.0.1:4567") and the
+    // handshake headers. When unset both are taken from SuwayomiClient on each
+    // connect, so auth changes are picked up. Used to run against a stand-in server.
+    void setEndpoint(const std::string& serverUrl, const std::map<std::string, std::string>& headers);
+
+private:
+    SubscriptionClient() = default;
+    ~SubscriptionClient() = default;
+    SubscriptionClient(const SubscriptionClient&) = delete;
+    SubscriptionClient& operator=(const SubscriptionClient&) = delete;
+
+    struct Subscription {
+        std::string query;
+        MessageHandler onNext;
+        StateHandler onState;
+        bool started = false;  // subscribe message sent on the current connection
+    };
+
+    void runLoop();
+    bool openConnection();
+    void closeConnection();
+    bool runSession();  // Returns when the connection ends or no subscriptions remain
+
+    bool sendFrame(int opcode, const std::string& payload);
+    bool sendRaw(const char* data, size_t size);
+    // Reads whatever is available; returns false on connection error/close
+    bool pumpReceive(bool& gotData);
+    // Blocks until the socket is readable (writable with forWrite), wakeLocked()
+    // is called, or timeoutMs passes
+    void waitForSocket(int timeoutMs, bool forWrite = false);
+    void wakeLocked();  // Ends the worker's waitForSocket early; caller holds m_mutex
+    bool parseFrames();
+    void handleMessage(const std::string& message);
+    void notifyState(bool live);
+
+    mutable std::mutex m_mutex;
+    std::map<int, Subscription> m_subs;
+    std::vector<std::string> m_outbox;  // Text messages queued by subscribe/unsubscribe
+    int m_nextId = 1;
+    bool m_running = false;             // Worker thread alive
+    std::atomic<bool> m_live{false};
+    bool m_acked = false;
+
+    std::string m_endpointOverride;
+    std::map<std::string, std::string> m_headersOverride;
+
+    // Connection state (worker thread only)
+    void* m_curl = nullptr;
+    std::string m_rx;        // Unparsed bytes from the socket
+    std::string m_fragment;  // Text message being reassembled from continuation frames
+    bool m_closeReceived = false;
+};
+
+} // namespace vitasuwayomi
@@ -0,0 +1,79 @@
+/**
+ * VitaSuwayomi - Texture Residency
+ * Keeps the big GPU textures (reader pages and grid covers) within a
+ * per-platform VRAM budget. Owners register the bytes they hold and touch
+ * them whenever they are drawn; when the budget is exceeded the least
+ * recently drawn textures are evicted through the owner's callback, which
+ * frees them and reloads on demand (from the decoded caches, not the network).
+ * Anything drawn in the last PROTECT_MS is on screen and never evicted; the
+ * budget is overrun instead.
+ * Main thread only, like every NanoVG call.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <unordered_map>
+
+namespace vitasuwayomi {
+
+class TextureResidency {
+public:
+    using EvictCallback = std::function<void()>;
+
+    struct Stats {
+        size_t residentBytes = 0;
+        size_t peakBytes = 0;
+        size_t budgetBytes = 0;
+        int textures = 0;         // Tracked owners, not NVG handles
+        uint64_t evictions = 0;
+    };
+
+    static TextureResidency& getInstance();
+
+    // Registers the textures held by owner, or updates their size. The
+    // callback must free them; it runs after the owner is untracked.
+    void track(const void* owner, size_t bytes, EvictCallback evict);
+    void untrack(const void* owner);
+
+    // Marks owner's textures as drawn now
+    void touch(const void* owner);
+
+    // Moves owner ahead of older textures without protecting it, for
+    // textures kept for later (prefetched pages) rather than drawn
+    void touchPrefetched(const void* owner);
+
+    // Evicts until bytes more fit in the budget. Call before an upload.
+    // exclude (the uploading owner) is never evicted for its own upload.
+    void reserve(size_t bytes, const void* exclude = nullptr);
+
+    Stats getStats() const;
+
+private:
+    TextureResidency() = default;
+    TextureResidency(const TextureResidency&) = delete;
+    TextureResidency& operator=(const TextureResidency&) = delete;
+
+    using Clock = std::chrono::steady_clock;
+
+    struct Entry {
+        const void* owner = nullptr;
+        size_t bytes = 0;
+        Clock::time_point lastDrawn;
+        EvictCallback evict;
+    };
+
+    void evictFor(size_t incoming, const void* exclude = nullptr);
+
+    std::list<Entry> m_lru;  // Most recently drawn or prefetched at front
+    std::unordered_map<const void*, std::list<Entry>::iterator> m_index;
+    size_t m_residentBytes = 0;
+    size_t m_peakBytes = 0;
+    uint64_t m_evictions = 0;
+};
+
+} // namespace vitasuwayomi
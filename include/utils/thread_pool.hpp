@@ -0,0 +1,97 @@
+/**
+ * VitaSuwayomi - Worker Thread Pool
+ * Fixed set of workers behind asyncRun/asyncTask. A thread per task is costly
+ * on Vita (sceKernelCreateThread) and Switch, and a library screen fires
+ * dozens of short requests at once. Each worker owns one deque per priority;
+ * submissions are spread round-robin and idle workers steal from the others.
+ *
+ * Only short tasks belong here. Long-lived loops (download worker, image
+ * loader workers, timer wheel, subscription socket) keep their own threads
+ * so they never pin a pool worker.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace vitasuwayomi {
+
+enum class TaskPriority {
+    HIGH = 0,    // The user is waiting on it (reader pages, opening a view)
+    NORMAL = 1,
+    LOW = 2      // Background upkeep (progress sync, index rebuilds)
+};
+
+// A view's m_alive flag. A task whose token has expired or reads false when
+// it is dequeued is dropped without running. Only pass one for fetches whose
+// result is useless once the view is gone - never for server mutations.
+using CancelToken = std::weak_ptr<bool>;
+
+class ThreadPool {
+public:
+    struct Stats {
+        int workers = 0;
+        int busy = 0;
+        size_t queued[3] = {0, 0, 0};  // By priority
+        size_t peakQueued = 0;
+        uint64_t completed = 0;
+        uint64_t cancelled = 0;
+    };
+
+    static ThreadPool& getInstance();
+
+    void submit(std::function<void()> task, TaskPriority priority = TaskPriority::NORMAL);
+    void submit(std::function<void()> task, CancelToken token,
+                TaskPriority priority = TaskPriority::NORMAL);
+
+    Stats getStats();
+    size_t queueDepth() const { return m_queued.load(); }
+
+private:
+    ThreadPool() = default;
+    ~ThreadPool() = default;
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    static constexpr int PRIORITY_COUNT = 3;
+
+    struct Task {
+        std::function<void()> fn;
+        CancelToken token;
+        bool hasToken = false;
+    };
+
+    struct Worker {
+        std::mutex mutex;
+        std::deque<Task> queues[PRIORITY_COUNT];
+    };
+
+    void start();
+    void enqueue(Task task, TaskPriority priority);
+    bool takeTask(int index, Task& out);
+    void workerLoop(int index);
+
+    std::once_flag m_startOnce;
+    std::vector<std::unique_ptr<Worker>> m_workers;  // Fixed once start() returns
+    std::atomic<int> m_workerCount{0};
+
+    std::mutex m_sleepMutex;
+    std::condition_variable m_sleepCv;  // Untimed wait only
+
+    std::atomic<size_t> m_queued{0};
+    std::atomic<size_t> m_queuedByPriority[PRIORITY_COUNT] = {};
+    std::atomic<size_t> m_peakQueued{0};
+    std::atomic<unsigned> m_nextWorker{0};
+    std::atomic<int> m_busy{0};
+    std::atomic<uint64_t> m_completed{0};
+    std::atomic<uint64_t> m_cancelled{0};
+};
+
+} // namespace vitasuwayomi
@@ -0,0 +1,89 @@
+/**
+ * VitaSuwayomi - Timer Wheel
+ * One service thread runs every delayed and periodic callback in the app, so
+ * "do X in 2 seconds" no longer parks a whole thread (and its large Vita/Switch
+ * stack) in sleep_for. Hierarchical wheel with 10ms ticks: four levels of
+ * 256/64/64/64 slots cover ~7.7 days; longer delays are re-cascaded.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace vitasuwayomi {
+
+enum class TimerDispatch {
+    MAIN_THREAD,  // brls::sync - for view updates
+    WORKER        // asyncRun - for blocking work such as network requests
+};
+
+class TimerWheel {
+public:
+    using TimerId = uint64_t;  // 0 is never a valid id
+
+    static TimerWheel& getInstance();
+
+    // Run callback once after delayMs
+    TimerId schedule(int delayMs, std::function<void()> callback,
+                     TimerDispatch dispatch = TimerDispatch::MAIN_THREAD);
+    // Run callback every intervalMs until cancelled. A run that is still
+    // queued when the next one is due is not doubled up.
+    TimerId schedulePeriodic(int intervalMs, std::function<void()> callback,
+                             TimerDispatch dispatch = TimerDispatch::MAIN_THREAD);
+
+    // Safe from any thread, including from the callback itself. A MAIN_THREAD
+    // callback already handed to brls::sync is skipped if cancelled before it runs.
+    bool cancel(TimerId id);
+
+    size_t pendingCount();
+
+private:
+    TimerWheel() = default;
+    ~TimerWheel() = default;
+    TimerWheel(const TimerWheel&) = delete;
+    TimerWheel& operator=(const TimerWheel&) = delete;
+
+    static constexpr int TICK_MS = 10;
+    static constexpr int LEVEL0_BITS = 8;
+    static constexpr int LEVELN_BITS = 6;
+    static constexpr int LEVELS = 4;
+
+    struct Timer {
+        TimerId id = 0;
+        uint64_t expiry = 0;        // In ticks
+        uint64_t intervalTicks = 0; // 0 for one-shot
+        std::function<void()> callback;
+        TimerDispatch dispatch = TimerDispatch::MAIN_THREAD;
+        std::atomic<bool> cancelled{false};
+        std::atomic<bool> inFlight{false};  // Dispatched, not yet run (periodic)
+    };
+    using TimerPtr = std::shared_ptr<Timer>;
+
+    TimerId add(int delayMs, int intervalMs, std::function<void()> callback, TimerDispatch dispatch);
+    uint64_t nowTicks() const;
+    void insert(const TimerPtr& timer, bool allowCurrentTick);  // Caller holds m_mutex
+    void advanceTo(uint64_t tick, std::vector<TimerPtr>& due);  // Caller holds m_mutex
+    void cascade(int level);                                    // Caller holds m_mutex
+    uint64_t nextWakeTick();                                    // Caller holds m_mutex
+    void run(const TimerPtr& timer);
+    void serviceLoop();
+
+    std::mutex m_mutex;
+    std::condition_variable m_cv;  // Service thread sleeps here; add() wakes it for earlier timers
+    std::vector<TimerPtr> m_slots[LEVELS][1 << LEVEL0_BITS];
+    std::unordered_map<TimerId, TimerPtr> m_timers;  // Live (not cancelled) timers
+    uint64_t m_currentTick = 0;
+    TimerId m_nextId = 1;
+    bool m_threadStarted = false;
+    uint64_t m_sleepUntil = 0;  // Tick the service thread is sleeping until, 0 while awake
+    bool m_wake = false;
+};
+
+} // namespace vitasuwayomi
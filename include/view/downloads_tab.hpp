@@ -29,6 +29,7 @@ public:
 private:
     void refresh();
     void refreshQueue();
+    void applyServerQueue(const std::vector<DownloadQueueItem>& queue);
     void refreshLocalDownloads();
     void showDownloadOptions(const std::string& ratingKey, const std::string& title);
     void startAutoRefresh();
@@ -73,7 +74,11 @@ private:
 
     // Auto-refresh state (atomic for thread safety)
     std::atomic<bool> m_autoRefreshEnabled{false};
-    std::atomic<bool> m_autoRefreshTimerActive{false};
+    uint64_t m_autoRefreshTimerId = 0;  // TimerWheel id, 0 when stopped
+
+    // Server queue pushed over SubscriptionClient; polling only runs while it is down
+    int m_queueSubscriptionId = -1;
+    std::atomic<bool> m_queueSubscriptionLive{false};
 
     // Throttle progress updates to avoid excessive UI refreshes
     std::chrono::steady_clock::time_point m_lastProgressRefresh;
@@ -8,7 +8,9 @@
 
 #include <borealis.hpp>
 #include "app/suwayomi_client.hpp"
+#include "utils/extension_catalog.hpp"
 #include <map>
+#include <set>
 #include <functional>
 #include <memory>
 
@@ -148,14 +150,35 @@ public:
     // Language name helper (used by data source)
     std::string getLanguageDisplayName(const std::string& langCode);
 
+    // Visible extensions whose name contains query, in name order (used by data source)
+    std::vector<Extension> searchExtensions(const std::string& query);
+
     // Alive flag accessor (used by data source for image loader safety)
     std::shared_ptr<bool> getAlive() const { return m_alive; }
 
 private:
+    struct ExtensionLists {
+        std::vector<Extension> updates;
+        std::vector<Extension> installed;
+        std::vector<Extension> uninstalled;
+        std::map<std::string, std::vector<Extension>> grouped;
+    };
+
     // Data loading
     void loadExtensionsFast();
     void refreshExtensions();
     void refreshUIFromCache();
+    // Categorize on the calling thread, then install on the UI thread.
+    // complete=false keeps m_cacheLoaded unset so a server fetch still follows.
+    void publishCatalog(ExtensionCatalog catalog, const std::set<std::string>& filterLanguages,
+                        std::weak_ptr<bool> aliveWeak, bool complete);
+    // Catalog entry for a local edit; copies the catalog first if a loader
+    // still holds it as its snapshot
+    Extension* findCatalogEntryForEdit(const std::string& pkgName);
+    static std::set<std::string> getEnabledLanguages();
+    static bool isLanguageEnabled(const std::string& lang, const std::set<std::string>& filterLanguages);
+    static ExtensionLists categorizeExtensions(const ExtensionCatalog& catalog,
+                                               const std::set<std::string>& filterLanguages);
 
     // Search
     void showSearchDialog();
@@ -178,7 +201,6 @@ private:
     // Helpers
     void showError(const std::string& message);
     void showLoading(const std::string& message);
-    std::map<std::string, std::vector<Extension>> groupExtensionsByLanguage(const std::vector<Extension>& extensions);
     std::vector<std::string> getSortedLanguageKeys(const std::map<std::string, std::vector<Extension>>& grouped);
 
     // Trigger recycler refresh
@@ -210,8 +232,9 @@ private:
     std::vector<Extension> m_installed;
     std::vector<Extension> m_uninstalled;
 
-    // Cache
-    std::vector<Extension> m_cachedExtensions;
+    // Cache (persisted catalog, name-sorted and grouped by language). Shared
+    // read-only with the loader thread; edited on the UI thread only.
+    std::shared_ptr<ExtensionCatalog> m_catalog = std::make_shared<ExtensionCatalog>();
     std::map<std::string, std::vector<Extension>> m_cachedGrouped;
     std::vector<std::string> m_cachedSortedLanguages;
     bool m_cacheLoaded = false;
@@ -49,15 +49,23 @@ private:
     void loadCategories();
     void createCategoryTabs();
     void loadCategoryManga(int categoryId);
+    // Worker-side server fetch; schedules its own retries
+    void fetchCategoryMangaAttempt(int categoryId, int attempt, bool cacheEnabled, std::weak_ptr<bool> aliveWeak);
     void selectCategory(int categoryId);
     void onMangaSelected(const Manga& manga);
     void triggerLibraryUpdate();
     void pollUpdateProgress(int generation);
+    // Returns true while the update is still running
+    bool applyUpdateProgress(int generation, bool gotStatus, int pending, int running, bool isRunning);
+    void startUpdateSubscription(int generation);
+    void stopUpdateSubscription();
     void updateCategoryButtonStyles();
     void sortMangaList();
     void cycleSortMode();
     void showSortMenu();
     void updateSortButtonText();
+    void showSearchDialog();
+    void clearSearch(bool refilter);  // refilter re-runs sortMangaList with the full list
     void navigateToPreviousCategory();
     void navigateToNextCategory();
     void scrollToCategoryIndex(int index);
@@ -124,6 +132,8 @@ private:
     bool m_isUpdating = false;
     int m_updateTotalJobs = 0;        // Total jobs when update started
     int m_updatePollGeneration = 0;   // Generation counter to cancel stale polls
+    int m_updateSubscriptionId = -1;  // SubscriptionClient handle while an update runs
+    bool m_updateSubscriptionLive = false;  // Pushes arriving; polling paused
 
     // Category tabs row
     brls::Box* m_categoryTabsBox = nullptr;        // Outer container (clips)
@@ -140,6 +150,11 @@ private:
     brls::Button* m_updateBtn = nullptr;
     brls::Button* m_sortBtn = nullptr;
     brls::Image* m_sortIcon = nullptr;
+    brls::Button* m_searchBtn = nullptr;
+
+    // Offline library search (filters m_mangaList via LibrarySearchIndex)
+    std::string m_searchQuery;
+    std::string m_titleBeforeSearch;
 
     // Pull-to-refresh indicator (shown during swipe-down gesture on category tabs)
     brls::Label* m_pullIndicatorLabel = nullptr;
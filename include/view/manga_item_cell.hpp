@@ -26,6 +26,9 @@ public:
               brls::Style style, brls::FrameContext* ctx) override;
 
     int getCoverImage() const { return m_nvgCover; }
+    // For the batched cover draw: marks the cover as drawn for
+    // TextureResidency, and reloads it if it was evicted
+    int getCoverImageForDraw();
     int getCoverWidth() const { return m_coverW; }
     int getCoverHeight() const { return m_coverH; }
 
@@ -67,6 +70,7 @@ private:
     int m_nvgCover = 0;
     int m_coverW = 0;
     int m_coverH = 0;
+    bool m_coverEvicted = false;
     float m_drawX = 0;
     float m_drawY = 0;
     float m_drawW = 0;
@@ -82,6 +86,8 @@ private:
     std::string m_cachedTitle;
     bool m_titleCached = false;
     std::shared_ptr<bool> m_alive;
+
+    void releaseCover();
 };
 
 using MediaItemCell = MangaItemCell;
@@ -6,6 +6,8 @@
 #pragma once
 
 #include <borealis.hpp>
+#include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -32,6 +34,20 @@ public:
      */
     void setImageFromMem(const unsigned char* data, size_t size);
 
+    /**
+     * Take ownership of an image buffer. Tall uncompressed TGAs (as produced
+     * by ImageLoader) are uploaded as TILE_ROWS-row tiles spread across
+     * frames; anything else goes through setImageFromMem.
+     */
+    void setImageFromBuffer(std::vector<uint8_t>&& data);
+
+    /**
+     * Same for a buffer the caller keeps too (ImageLoader's page ring):
+     * tiles are cut from it in place, so it is never copied
+     */
+    using SharedBuffer = std::shared_ptr<const std::vector<uint8_t>>;
+    void setImageFromBuffer(SharedBuffer data);
+
     /**
      * Set image from file path
      */
@@ -42,6 +58,13 @@ public:
      */
     void clearImage();
 
+    /**
+     * Mark the textures as wanted without drawing them (prefetched pages),
+     * so TextureResidency evicts them after older pages but before any
+     * page on screen
+     */
+    void touchResidency();
+
     /**
      * Set rotation in degrees (0, 90, 180, 270)
      */
@@ -82,10 +105,44 @@ public:
      * Set image from multiple segments (for tall images auto-split to fit GPU texture limit).
      * Each segment is a TGA representing a horizontal slice of the original image.
      * The RotatableImage draws them stacked vertically, transparent to the caller.
+     *
+     * Nothing is uploaded here: segments are cut into TILE_ROWS-row tiles and
+     * uploaded by uploadPendingTiles() a few per frame, visible tiles first.
+     * Tiles that are not resident yet are drawn as a placeholder.
+     *
+     * A non-zero streamId opens a stream for a page that is still being
+     * decoded: segments may cover only the top of the image, and the rest
+     * arrives through appendStreamSegments(). Rows not delivered yet are
+     * drawn as a placeholder too.
      */
-    void setImageSegments(const std::vector<std::vector<uint8_t>>& segments,
+    void setImageSegments(std::vector<std::vector<uint8_t>> segments,
                           int origWidth, int origHeight,
-                          const std::vector<int>& segmentSrcHeights);
+                          const std::vector<int>& segmentSrcHeights,
+                          uint64_t streamId = 0);
+
+    /**
+     * Add the next segments of an open stream. Dropped if the image that
+     * opened it was cleared since (follows takeImageFrom). last closes it.
+     * Main thread only.
+     */
+    static void appendStreamSegments(uint64_t streamId, std::vector<std::vector<uint8_t>> segments,
+                                     const std::vector<int>& segmentSrcHeights, bool last);
+
+    /**
+     * Upload up to maxUploads pending tiles across all RotatableImages.
+     * Tiles that were on screen in the last drawn frame go first.
+     * Main thread only. Returns the number of tiles uploaded.
+     */
+    static int uploadPendingTiles(int maxUploads);
+
+    /**
+     * True while any RotatableImage still has tiles waiting for upload
+     */
+    static bool hasPendingTiles();
+
+    // Rows per uploaded tile. 512 rows of a 1280px-wide page is ~2.6MB,
+    // which keeps a single upload well inside one frame on Vita.
+    static constexpr int TILE_ROWS = 512;
 
     /**
      * Get image dimensions (returns original dimensions for segmented images)
@@ -96,7 +153,7 @@ public:
     /**
      * Check if image is loaded (single or segmented)
      */
-    bool hasImage() const { return m_nvgImage != 0 || !m_segmentNvgImages.empty(); }
+    bool hasImage() const { return m_nvgImage != 0 || !m_tiles.empty(); }
 
     /**
      * Set zoom level (1.0 = normal, >1.0 = zoomed in)
@@ -155,10 +212,32 @@ private:
 
     // Multi-segment support: tall images are auto-split into multiple GPU textures
     // to preserve width quality within the 2048x2048 texture size limit.
-    std::vector<int> m_segmentNvgImages;      // NVG handles for each segment
-    std::vector<int> m_segmentSrcHeights;     // Source pixel height of each segment
+    // Each segment is further cut into TILE_ROWS-row tiles that upload lazily.
+    struct Tile {
+        int nvgImage = 0;        // NVG handle (0 until uploaded)
+        bool uploaded = false;   // true once attempted (failed uploads stay blank)
+        int segment = 0;         // Index into m_segmentData
+        int rowStart = 0;        // First TGA row of the tile within its segment
+        int rows = 0;            // TGA rows in the tile
+        float srcHeight = 0.0f;  // Source pixel height this tile covers
+    };
+    std::vector<Tile> m_tiles;
+    std::vector<SharedBuffer> m_segmentData;  // Segment TGAs still being uploaded
+    std::vector<int> m_segmentTilesLeft;      // Pending tiles per segment (drops data at 0)
+    int m_pendingTiles = 0;
+    int m_visiblePendingTile = -1;  // First on-screen pending tile in the last draw
     int m_origWidth = 0;                       // Original full image width
     int m_origHeight = 0;                      // Original full image height
+    uint64_t m_streamId = 0;                   // Open segment stream (0 = none)
+    size_t m_residentBytes = 0;                // GPU bytes registered with TextureResidency
+
+    void addSegmentTiles(std::vector<std::vector<uint8_t>>& segments,
+                         const std::vector<int>& segmentSrcHeights);
+    void addSegmentTiles(std::vector<SharedBuffer> segments, const std::vector<int>& segmentSrcHeights);
+    void closeStream();
+    bool uploadTile(size_t index);
+    void addResidentBytes(size_t bytes);
+    int nextPendingTile() const;
 
     float m_rotationDegrees = 0.0f;
     float m_rotationRadians = 0.0f;
@@ -78,6 +78,13 @@ public:
      */
     void trimPagesFromEnd(int count);
 
+    /**
+     * Apply natural page sizes learned after the pages were set, keyed by
+     * image URL, so pages get their final height before their image loads.
+     * Pages that already loaded or failed are left alone.
+     */
+    void setPageSizes(const std::map<std::string, std::pair<int, int>>& sizes);
+
     /**
      * Scroll to a specific page index
      */
@@ -206,6 +213,14 @@ private:
     // Get total content size for current layout mode
     float getTotalContentSize() const;
 
+    // Layout height for a new page: exact when its size is known up front,
+    // otherwise a 2:3 estimate that is corrected when the image loads
+    float initialPageHeight(const Page& page, float availableWidth) const;
+
+    // Change a page's height, compensating scroll for pages above the
+    // reading position so visible content stays in place
+    void resizePage(int pageIndex, float newHeight);
+
     // Update current page based on scroll position
     void updateCurrentPage();
 
@@ -224,6 +239,10 @@ private:
     // Check if a page failed to load
     bool isFailedPage(int pageIndex) const;
 
+    // Estimated texture memory of a page at its current layout size
+    // (0 for transition/failed pages, which have no texture)
+    size_t estimatePageTextureBytes(int pageIndex) const;
+
     // Draw a transition page (chapter separator)
     void drawTransitionPage(NVGcontext* vg, int pageIndex, float x, float y, float width, float height);
 
@@ -308,14 +327,21 @@ private:
     // Alive flag for async callback safety (cleared in clearPages/destructor)
     std::shared_ptr<bool> m_alive = std::make_shared<bool>(true);
 
-    // Preload buffer - how many pages ahead/behind to load
-    // Higher values mean smoother scrolling but more VRAM usage.
-    // 4 pages gives ~2 screens of lookahead at typical webtoon image heights.
-    static constexpr int PRELOAD_PAGES = 4;
-
-    // Unload buffer - pages beyond this distance from visible area get their images freed
-    // Reduced from 8 to limit VRAM usage when tall images have multiple segment textures
-    static constexpr int UNLOAD_PAGES = 5;
+    // Adaptive prefetch window (see updateVisibleImages).
+    // Look-ahead covers the distance scrolled while a page loads (velocity x
+    // measured load latency), in the direction of travel only. Pages are
+    // added until the estimated texture memory of visible + prefetched pages
+    // reaches PREFETCH_BUDGET_SHARE of the platform's TextureResidency budget
+    // (48MB on Vita); pages behind the viewport are kept only with whatever
+    // is left over, and the rest of the budget stays free for covers.
+    static constexpr float PREFETCH_MIN_SCREENS = 1.0f;      // Look-ahead when idle / reading slowly
+    static constexpr float PREFETCH_MAX_SCREENS = 12.0f;     // Cap for very fast flings
+    static constexpr float PREFETCH_LATENCY_MARGIN = 1.5f;   // Slack over the measured load latency
+    static constexpr float PREFETCH_BUDGET_SHARE = 0.75f;    // Of TextureResidency's VRAM budget
+
+    // Last direction of travel: +1 towards the end, -1 towards the start.
+    // Sticky while idle so prefetch keeps following the reader.
+    int m_travelDirection = 1;
 
     // Momentum friction (per-frame at 60fps baseline; actual deceleration is time-based)
     static constexpr float MOMENTUM_FRICTION = 0.95f;
@@ -10,9 +10,14 @@
 #include "app/application.hpp"
 #include "app/suwayomi_client.hpp"
 #include "app/downloads_manager.hpp"
+#include "app/mutation_outbox.hpp"
 #include "utils/image_loader.hpp"
+#include "utils/library_cache.hpp"
+#include "utils/perf_overlay.hpp"
 #include "utils/async.hpp"
+#include "utils/timer_wheel.hpp"
 #include "view/webtoon_scroll_view.hpp"
+#include "platform/platform.hpp"
 
 #include <borealis.hpp>
 #include <algorithm>
@@ -34,6 +39,43 @@ namespace {
 
 namespace vitasuwayomi {
 
+// Page list for a server chapter: the LibraryCache copy when present (no
+// network round-trip), otherwise fetchChapterPages, caching the result so the
+// next open or preload of this chapter is free. fromCache reports which.
+static bool fetchChapterPagesCached(int mangaId, int chapterId, std::vector<Page>& pages,
+                                    bool* fromCache = nullptr) {
+    if (fromCache) *fromCache = false;
+    if (LibraryCache::getInstance().loadChapterPages(chapterId, pages)) {
+        brls::Logger::info("ReaderActivity: Page list for chapter {} from cache ({} pages)", chapterId, pages.size());
+        if (fromCache) *fromCache = true;
+        return true;
+    }
+
+    if (!Application::getInstance().isConnected()) {
+        return false;
+    }
+    if (!SuwayomiClient::getInstance().fetchChapterPages(mangaId, chapterId, pages)) {
+        return false;
+    }
+    LibraryCache::getInstance().saveChapterPages(chapterId, pages);
+    return true;
+}
+
+// Natural page sizes from the dimension cache, so a webtoon strip can be laid
+// out exactly before any page loads
+static void loadCachedPageSizes(int chapterId, std::vector<Page>& pages) {
+    std::vector<std::pair<int, int>> sizes;
+    if (!LibraryCache::getInstance().loadPageDimensions(chapterId, sizes)) return;
+    for (auto& page : pages) {
+        if (page.index < 0 || page.index >= static_cast<int>(sizes.size())) continue;
+        page.width = sizes[page.index].first;
+        page.height = sizes[page.index].second;
+    }
+}
+
+// Probed sizes are handed to the UI in batches of this many pages
+static constexpr size_t PAGE_SIZE_BATCH = 8;
+
 ReaderActivity::ReaderActivity(int mangaId, int chapterIndex, const std::string& mangaTitle)
     : m_mangaId(mangaId)
     , m_chapterIndex(chapterIndex)
@@ -268,6 +310,7 @@ void ReaderActivity::onContentAvailable() {
     // Set webtoon-specific settings
     m_settings.cropBorders = cropBorders;
     m_settings.webtoonSidePadding = webtoonSidePadding;
+    ImageLoader::setCropBorders(cropBorders);
 
     brls::Logger::debug("ReaderActivity: loaded settings - direction={}, rotation={}, scaleMode={}, cropBorders={}",
                         static_cast<int>(m_settings.direction),
@@ -1280,7 +1323,7 @@ void ReaderActivity::loadPages() {
     auto sharedTotalChapters = std::make_shared<int>(0);
     auto sharedLoadedFromLocal = std::make_shared<bool>(false);
 
-    vitasuwayomi::asyncTask<bool>([mangaId, chapterIndex,
+    vitasuwayomi::asyncTask<bool>([mangaId, chapterIndex, isWebtoonMode,
                                     sharedPages, sharedChapterName,
                                     sharedChapters, sharedTotalChapters,
                                     sharedLoadedFromLocal]() {
@@ -1351,9 +1394,10 @@ void ReaderActivity::loadPages() {
         }
 
         // Fall back to server if not available locally
+        bool pagesFromCache = false;
         if (!loadedFromLocal) {
             brls::Logger::info("ReaderActivity: Fetching chapter {} from server", chapterIndex);
-            if (!client.fetchChapterPages(mangaId, chapterIndex, rawPages)) {
+            if (!fetchChapterPagesCached(mangaId, chapterIndex, rawPages, &pagesFromCache)) {
                 brls::Logger::error("Failed to fetch chapter pages");
                 return false;
             }
@@ -1371,6 +1415,24 @@ void ReaderActivity::loadPages() {
             }
             client.fetchChapters(mangaId, *sharedChapters);
             *sharedTotalChapters = static_cast<int>(sharedChapters->size());
+
+            // The fresh chapter info is the server's invalidation signal for a
+            // cached page list (page count changed / chapter re-fetched)
+            if (pagesFromCache) {
+                for (const auto& ch : *sharedChapters) {
+                    if (ch.id != chapterIndex) continue;
+                    std::vector<Page> freshPages;
+                    if (LibraryCache::getInstance().validateChapterPages(ch) &&
+                        fetchChapterPagesCached(mangaId, chapterIndex, freshPages)) {
+                        *sharedPages = std::move(freshPages);
+                    }
+                    break;
+                }
+            }
+        }
+
+        if (isWebtoonMode) {
+            loadCachedPageSizes(chapterIndex, *sharedPages);
         }
 
         return true;
@@ -1501,6 +1563,7 @@ void ReaderActivity::loadPages() {
                 float viewW = webtoonScroll->getWidth();
                 if (viewW <= 0) viewW = container ? container->getWidth() : brls::Application::contentWidth;
                 webtoonScroll->setPages(m_pages, viewW, m_currentPage);
+                probePageSizes(m_chapterIndex, m_pages, m_pages[m_currentPage].index);
 
                 // Build chapter-boundary map so progress saves to the right chapter
                 initWebtoonSegments();
@@ -1569,6 +1632,17 @@ void ReaderActivity::loadPage(int index) {
 
     brls::Logger::debug("Loading page {} from: {}", index, imageUrl);
 
+    // Track reading direction for the page ring. Chapter changes reset the
+    // page index, so compare chapter positions first.
+    if (m_lastLoadedChapterPos >= 0 && m_chapterPosition != m_lastLoadedChapterPos) {
+        m_readDirection = (m_chapterPosition > m_lastLoadedChapterPos) ? 1 : -1;
+    } else if (m_lastLoadedPage >= 0 && index != m_lastLoadedPage) {
+        m_readDirection = (index > m_lastLoadedPage) ? 1 : -1;
+    }
+    m_lastLoadedPage = index;
+    m_lastLoadedChapterPos = m_chapterPosition;
+    m_turnStartTime = std::chrono::steady_clock::now();
+
     // Show page counter when navigating
     showPageCounter();
     schedulePageCounterHide();
@@ -1595,6 +1669,12 @@ void ReaderActivity::loadPage(int index) {
             if (index == currentPageAtLoad) {
                 brls::Logger::debug("ReaderActivity: Page {} loaded", index);
                 if (m_pageLoadGeneration == loadGen) {
+                    if (!m_pageLoadSucceeded) {
+                        float turnMs = std::chrono::duration<float, std::milli>(
+                            std::chrono::steady_clock::now() - m_turnStartTime).count();
+                        PerfOverlay::getInstance().recordPageTurn(turnMs);
+                        brls::Logger::debug("ReaderActivity: Page {} turn latency {:.1f}ms", index, turnMs);
+                    }
                     m_pageLoadSucceeded = true;
                 }
             }
@@ -1605,16 +1685,13 @@ void ReaderActivity::loadPage(int index) {
         // Set up a timeout: if page hasn't loaded after 15 seconds, show error
         // Only for server-streamed pages - local files load instantly from disk
         if (!m_loadedFromLocal) {
-            vitasuwayomi::asyncRun([this, aliveWeak, loadGen, index]() {
-                std::this_thread::sleep_for(std::chrono::seconds(15));
-                brls::sync([this, aliveWeak, loadGen, index]() {
-                    auto alive = aliveWeak.lock();
-                    if (!alive || !*alive) return;
-                    // Only show error if this is still the same load attempt and it hasn't succeeded
-                    if (m_pageLoadGeneration == loadGen && !m_pageLoadSucceeded) {
-                        showPageError("Failed to load page " + std::to_string(index + 1));
-                    }
-                });
+            vitasuwayomi::TimerWheel::getInstance().schedule(15000, [this, aliveWeak, loadGen, index]() {
+                auto alive = aliveWeak.lock();
+                if (!alive || !*alive) return;
+                // Only show error if this is still the same load attempt and it hasn't succeeded
+                if (m_pageLoadGeneration == loadGen && !m_pageLoadSucceeded) {
+                    showPageError("Failed to load page " + std::to_string(index + 1));
+                }
             });
         }
     }
@@ -1625,20 +1702,41 @@ void ReaderActivity::loadPage(int index) {
 }
 
 void ReaderActivity::preloadAdjacentPages() {
-    // Preload 2 pages ahead and 2 pages behind for smoother swiping in
-    // both directions. This prevents blank frames when swiping backward
-    // through previously-read pages. The Vita's 20MB LRU cache evicts
-    // the oldest entries, so this won't exceed memory limits.
-    for (int i = 1; i <= 2; i++) {
-        int nextIdx = m_currentPage + i;
-        if (nextIdx < static_cast<int>(m_pages.size()) && !isTransitionPage(nextIdx)) {
-            ImageLoader::preloadFullSize(m_pages[nextIdx].imageUrl);
-        }
-        int prevIdx = m_currentPage - i;
-        if (prevIdx >= 0 && !isTransitionPage(prevIdx)) {
-            ImageLoader::preloadFullSize(m_pages[prevIdx].imageUrl);
+    // Keep the current page plus PAGE_RING_AHEAD pages in reading direction
+    // and PAGE_RING_BEHIND pages behind decoded in ImageLoader's page ring,
+    // so page turns only pay the texture upload. Past a chapter edge the
+    // window continues into the preloaded next/previous chapter.
+    if (m_pages.empty()) return;
+    int count = static_cast<int>(m_pages.size());
+
+    std::vector<std::string> window;
+    if (m_currentPage >= 0 && m_currentPage < count && !isTransitionPage(m_currentPage)) {
+        window.push_back(m_pages[m_currentPage].imageUrl);
+    }
+
+    auto collect = [&](int step, int wanted) {
+        int idx = m_currentPage;
+        size_t spill = 0;  // Pages taken from the neighbouring chapter
+        for (int taken = 0; taken < wanted;) {
+            idx += step;
+            if (idx >= 0 && idx < count) {
+                if (isTransitionPage(idx)) continue;
+                window.push_back(m_pages[idx].imageUrl);
+                taken++;
+                continue;
+            }
+            const std::vector<Page>& other = (step > 0) ? m_nextChapterPages : m_prevChapterPages;
+            bool otherLoaded = (step > 0) ? m_nextChapterLoaded : m_prevChapterLoaded;
+            if (!otherLoaded || spill >= other.size()) break;
+            window.push_back(step > 0 ? other[spill].imageUrl : other[other.size() - 1 - spill].imageUrl);
+            spill++;
+            taken++;
         }
-    }
+    };
+    collect(m_readDirection, PAGE_RING_AHEAD);
+    collect(-m_readDirection, PAGE_RING_BEHIND);
+
+    ImageLoader::setPageRingWindow(window);
 }
 
 void ReaderActivity::updatePageDisplay() {
@@ -1769,11 +1867,9 @@ void ReaderActivity::flushPendingProgress() {
     m_pendingProgressChapterId = -1;
     m_lastProgressSaveTime = std::chrono::steady_clock::now();
 
-    if (Application::getInstance().isConnected()) {
-        vitasuwayomi::asyncRun([mangaId, chapterId, page]() {
-            SuwayomiClient::getInstance().updateChapterProgress(mangaId, chapterId, page);
-        });
-    } else {
+    // The outbox journals the write and sends it once the server is reachable
+    MutationOutbox::getInstance().setProgress(mangaId, chapterId, page);
+    if (!Application::getInstance().isConnected()) {
         DownloadsManager::getInstance().updateReadingProgress(mangaId, chapterId, page);
     }
 }
@@ -2065,42 +2161,35 @@ void ReaderActivity::markChapterAsRead() {
     // Always mark locally in downloads manager (works offline)
     DownloadsManager::getInstance().markChapterReadLocally(mangaId, chapterId);
 
+    // Queued durably; the outbox retries until the server has it
+    MutationOutbox::getInstance().setRead(mangaId, chapterId, true);
+
+    bool mangaCompleted = (chapterPos >= 0 && chapterPos == totalChapters - 1);
+    Application::getInstance().updateReadingStatistics(true, mangaCompleted);
+
     if (!Application::getInstance().isConnected()) {
         brls::Logger::info("ReaderActivity: offline, marked chapter read locally (will sync later)");
-        // Still update reading statistics locally
-        bool mangaCompleted = (chapterPos >= 0 && chapterPos == totalChapters - 1);
-        Application::getInstance().updateReadingStatistics(true, mangaCompleted);
         return;
     }
 
-    vitasuwayomi::asyncRun([mangaId, chapterId, chapterPos, totalChapters]() {
-        SuwayomiClient& client = SuwayomiClient::getInstance();
-        if (client.markChapterRead(mangaId, chapterId)) {
-            // Update reading statistics on the main thread
-            brls::sync([chapterPos, totalChapters]() {
-                // Check if this was the last chapter (manga completed)
-                bool mangaCompleted = (chapterPos == totalChapters - 1);
-                Application::getInstance().updateReadingStatistics(true, mangaCompleted);
-            });
+    // Delete downloaded chapter if deleteAfterRead is enabled
+    if (!Application::getInstance().getSettings().deleteAfterRead) return;
 
-            // Delete downloaded chapter if deleteAfterRead is enabled
-            if (Application::getInstance().getSettings().deleteAfterRead) {
-                brls::Logger::info("ReaderActivity: deleteAfterRead enabled, removing chapter download");
+    vitasuwayomi::asyncRun([mangaId, chapterId]() {
+        brls::Logger::info("ReaderActivity: deleteAfterRead enabled, removing chapter download");
 
-                // Delete from local downloads
-                DownloadsManager& dm = DownloadsManager::getInstance();
-                if (dm.deleteChapterDownload(mangaId, chapterId)) {
-                    brls::Logger::info("ReaderActivity: Deleted local chapter download (manga={}, chapter={})",
-                                      mangaId, chapterId);
-                }
-
-                // Also delete from server download queue
-                std::vector<int> chapterIds = {chapterId};
-                std::vector<int> chapterIndexes = {chapterId};
-                client.deleteChapterDownloads(chapterIds, mangaId, chapterIndexes);
-                brls::Logger::info("ReaderActivity: Requested server to delete chapter download (id={})", chapterId);
-            }
+        // Delete from local downloads
+        DownloadsManager& dm = DownloadsManager::getInstance();
+        if (dm.deleteChapterDownload(mangaId, chapterId)) {
+            brls::Logger::info("ReaderActivity: Deleted local chapter download (manga={}, chapter={})",
+                              mangaId, chapterId);
         }
+
+        // Also delete from server download queue
+        std::vector<int> chapterIds = {chapterId};
+        std::vector<int> chapterIndexes = {chapterId};
+        SuwayomiClient::getInstance().deleteChapterDownloads(chapterIds, mangaId, chapterIndexes);
+        brls::Logger::info("ReaderActivity: Requested server to delete chapter download (id={})", chapterId);
     });
 }
 
@@ -2190,16 +2279,13 @@ void ReaderActivity::schedulePageCounterHide() {
     int generation = ++m_pageCounterHideGeneration;
     std::weak_ptr<bool> aliveWeak = m_alive;
 
-    vitasuwayomi::asyncRun([this, aliveWeak, generation]() {
-        std::this_thread::sleep_for(std::chrono::seconds(2));
-        brls::sync([this, aliveWeak, generation]() {
-            auto alive = aliveWeak.lock();
-            if (!alive || !*alive) return;
-            // Only hide if no newer show/page-turn happened since we were scheduled
-            if (generation == m_pageCounterHideGeneration && !m_controlsVisible) {
-                hidePageCounter();
-            }
-        });
+    vitasuwayomi::TimerWheel::getInstance().schedule(2000, [this, aliveWeak, generation]() {
+        auto alive = aliveWeak.lock();
+        if (!alive || !*alive) return;
+        // Only hide if no newer show/page-turn happened since we were scheduled
+        if (generation == m_pageCounterHideGeneration && !m_controlsVisible) {
+            hidePageCounter();
+        }
     });
 }
 
@@ -2310,6 +2396,9 @@ void ReaderActivity::updateSettingsLabels() {
 }
 
 void ReaderActivity::applySettings() {
+    // Border cropping happens at decode time, so it takes effect as pages load
+    ImageLoader::setCropBorders(m_settings.cropBorders);
+
     if (!pageImage) return;
 
     // Map reader scale mode to image scale mode
@@ -3866,17 +3955,16 @@ void ReaderActivity::preloadNextChapter() {
                     page.originalIndex = static_cast<int>(i);
                     sharedNextPages->push_back(page);
                 }
+                loadCachedPageSizes(nextChapterIndex, *sharedNextPages);
                 return true;
             }
         }
 
-        // Fall back to server
-        if (!Application::getInstance().isConnected()) {
-            return false;
-        }
-        SuwayomiClient& client = SuwayomiClient::getInstance();
-        return client.fetchChapterPages(mangaId, nextChapterIndex, *sharedNextPages);
-    }, [this, aliveWeak, sharedNextPages](bool success) {
+        // Fall back to the cached page list, then the server
+        if (!fetchChapterPagesCached(mangaId, nextChapterIndex, *sharedNextPages)) return false;
+        loadCachedPageSizes(nextChapterIndex, *sharedNextPages);
+        return true;
+    }, [this, aliveWeak, nextChapterIndex, sharedNextPages](bool success) {
         auto alive = aliveWeak.lock();
         if (!alive || !*alive) return;
 
@@ -3886,8 +3974,14 @@ void ReaderActivity::preloadNextChapter() {
             brls::Logger::info("Next chapter preloaded: {} pages", m_nextChapterPages.size());
 
             // Preload first few images of next chapter (full size for manga reader)
-            for (size_t i = 0; i < std::min(size_t(2), m_nextChapterPages.size()); i++) {
-                ImageLoader::preloadFullSize(m_nextChapterPages[i].imageUrl);
+            if (m_continuousScrollMode) {
+                probePageSizes(nextChapterIndex, m_nextChapterPages);
+                for (size_t i = 0; i < std::min(size_t(2), m_nextChapterPages.size()); i++) {
+                    ImageLoader::preloadFullSize(m_nextChapterPages[i].imageUrl);
+                }
+            } else {
+                // Paged mode: let the decoded-page ring span the chapter edge
+                preloadAdjacentPages();
             }
         }
     });
@@ -3923,16 +4017,15 @@ void ReaderActivity::preloadPrevChapter() {
                     page.originalIndex = static_cast<int>(i);
                     sharedPrevPages->push_back(page);
                 }
+                loadCachedPageSizes(prevChapterId, *sharedPrevPages);
                 return true;
             }
         }
 
-        if (!Application::getInstance().isConnected()) {
-            return false;
-        }
-        SuwayomiClient& client = SuwayomiClient::getInstance();
-        return client.fetchChapterPages(mangaId, prevChapterId, *sharedPrevPages);
-    }, [this, aliveWeak, sharedPrevPages](bool success) {
+        if (!fetchChapterPagesCached(mangaId, prevChapterId, *sharedPrevPages)) return false;
+        loadCachedPageSizes(prevChapterId, *sharedPrevPages);
+        return true;
+    }, [this, aliveWeak, prevChapterId, sharedPrevPages](bool success) {
         auto alive = aliveWeak.lock();
         if (!alive || !*alive) return;
 
@@ -3946,10 +4039,90 @@ void ReaderActivity::preloadPrevChapter() {
             for (size_t i = (count > 2 ? count - 2 : 0); i < count; i++) {
                 ImageLoader::preloadFullSize(m_prevChapterPages[i].imageUrl);
             }
+
+            if (m_continuousScrollMode) {
+                probePageSizes(prevChapterId, m_prevChapterPages, static_cast<int>(count) - 1);
+            }
         }
     });
 }
 
+void ReaderActivity::probePageSizes(int chapterId, const std::vector<Page>& pages, int firstIndex) {
+    if (!m_sizeProbedChapters.insert(chapterId).second) return;
+
+    // Everything already known (from the dimension cache) is kept for the save
+    int pageCount = 0;
+    for (const auto& page : pages) {
+        pageCount = std::max(pageCount, page.index + 1);
+    }
+    std::vector<std::pair<int, int>> known(pageCount, {0, 0});
+    std::vector<Page> missing;
+    for (const auto& page : pages) {
+        if (page.index < 0 || page.imageUrl.compare(0, 13, "__transition:") == 0) continue;
+        if (page.width > 0 && page.height > 0) {
+            known[page.index] = {page.width, page.height};
+        } else {
+            missing.push_back(page);
+        }
+    }
+    if (missing.empty()) return;
+
+    // Reading position first, then onwards, then the pages before it
+    std::stable_partition(missing.begin(), missing.end(),
+                          [firstIndex](const Page& page) { return page.index >= firstIndex; });
+
+    brls::Logger::info("ReaderActivity: Probing sizes of {} pages of chapter {}", missing.size(), chapterId);
+
+    std::weak_ptr<bool> aliveWeak = m_alive;
+    vitasuwayomi::asyncRun([this, aliveWeak, chapterId, missing, known]() mutable {
+        std::map<std::string, std::pair<int, int>> batch;
+        auto publish = [&]() {
+            if (batch.empty()) return;
+            brls::sync([this, aliveWeak, batch]() {
+                auto alive = aliveWeak.lock();
+                if (!alive || !*alive) return;
+                applyPageSizes(batch);
+            });
+            batch.clear();
+        };
+
+        int failures = 0;
+        for (const Page& page : missing) {
+            if (aliveWeak.expired()) return;  // Reader closed
+            bool local = platform::isLocalPath(page.imageUrl);
+            if (!local && !Application::getInstance().isConnected()) continue;
+
+            int width = 0, height = 0, segments = 1;
+            if (!ImageLoader::getImageDimensions(page.imageUrl, width, height, segments)) {
+                // Server unreachable: leave the rest to the image loads
+                if (++failures >= 3) break;
+                continue;
+            }
+            failures = 0;
+            known[page.index] = {width, height};
+            batch[page.imageUrl] = {width, height};
+            if (batch.size() >= PAGE_SIZE_BATCH) publish();
+        }
+        publish();
+
+        LibraryCache::getInstance().savePageDimensions(chapterId, known);
+    }, TaskPriority::LOW);
+}
+
+void ReaderActivity::applyPageSizes(const std::map<std::string, std::pair<int, int>>& sizes) {
+    for (auto* list : {&m_pages, &m_nextChapterPages, &m_prevChapterPages}) {
+        for (auto& page : *list) {
+            auto it = sizes.find(page.imageUrl);
+            if (it == sizes.end()) continue;
+            page.width = it->second.first;
+            page.height = it->second.second;
+        }
+    }
+    if (webtoonScroll) {
+        webtoonScroll->setPageSizes(sizes);
+    }
+}
+
 void ReaderActivity::updateReaderMode() {
     // Determine if we should use continuous scroll mode
     // Continuous scroll is used for Webtoon format
@@ -5,6 +5,8 @@
 #include "app/application.hpp"
 #include "app/suwayomi_client.hpp"
 #include "app/downloads_manager.hpp"
+#include "app/endpoint_selector.hpp"
+#include "app/mutation_outbox.hpp"
 #include "utils/library_cache.hpp"
 #include "utils/image_loader.hpp"
 #include "utils/async.hpp"
@@ -13,6 +15,8 @@
 #include "activity/reader_activity.hpp"
 #include "view/media_detail_view.hpp"
 #include "utils/perf_overlay.hpp"
+#include "utils/perf_trace.hpp"
+#include "utils/timer_wheel.hpp"
 
 #include <borealis.hpp>
 #include <sstream>
@@ -25,9 +29,17 @@ namespace vitasuwayomi {
 
 // Settings path derived from platform data directory
 static std::string getSettingsPath() {
+    return platform::path("settings.bin");
+}
+
+// Written by older versions; imported once when settings.bin is missing
+static std::string getLegacySettingsPath() {
     return platform::path("settings.json");
 }
 
+// Coalescing window for saveSettings()
+static constexpr int SETTINGS_SAVE_DELAY_MS = 500;
+
 // Obfuscation helpers for storing sensitive fields (password, tokens) on disk.
 // Uses XOR with a static key + base64 encoding. This is NOT cryptographic security
 // (the key is in the binary), but prevents plain-text passwords in the config file.
@@ -135,6 +147,7 @@ bool Application::init() {
     applyTheme();
     applyLogLevel();
     PerfOverlay::getInstance().setEnabled(m_settings.showPerfOverlay);
+    PerfTrace::setThreadName("main");
 
     // Initialize library cache
     LibraryCache::getInstance().init();
@@ -159,6 +172,14 @@ void Application::run() {
     // Initialize downloads manager
     DownloadsManager::getInstance().init();
 
+    // Pick up chapter writes queued before the last exit
+    MutationOutbox::getInstance().init();
+
+    // Route between local and remote URLs by health and latency
+    EndpointSelector::getInstance().configure(m_settings.localServerUrl, m_settings.remoteServerUrl,
+                                              m_settings.useRemoteUrl, m_settings.autoSwitchOnFailure);
+    EndpointSelector::getInstance().start();
+
     // Check if we have saved server connection
     if (!m_serverUrl.empty()) {
         // Show login screen immediately while restoring connection in background.
@@ -349,6 +370,8 @@ void Application::run() {
 
                 // Transition to main activity on the UI thread
                 brls::sync([this]() {
+                    MutationOutbox::getInstance().flush();
+
                     // Sync offline reading progress to server in background
                     DownloadsManager& dm = DownloadsManager::getInstance();
                     if (!dm.getDownloads().empty()) {
@@ -401,6 +424,8 @@ void Application::run() {
 
 void Application::shutdown() {
     saveSettings();
+    flushSettings();
+    MutationOutbox::getInstance().flushJournal();
     m_initialized = false;
     brls::Logger::info("VitaSuwayomi shutting down");
 }
@@ -434,7 +459,14 @@ void Application::pushMangaDetailView(int mangaId) {
     brls::Logger::info("pushMangaDetailView: fetching manga {}", mangaId);
     auto& client = SuwayomiClient::getInstance();
     Manga manga;
-    if (!client.fetchMangaFull(mangaId, manga)) {
+    // A stale copy opens the view at once; it fetches its chapters itself
+    bool shown = false;
+    bool ok = client.fetchMangaFull(mangaId, manga, [&shown](const Manga& cached) {
+        brls::Application::pushActivity(new brls::Activity(new MangaDetailView(cached)));
+        shown = true;
+    });
+    if (shown) return;
+    if (!ok) {
         brls::Logger::error("pushMangaDetailView: failed to fetch manga {}", mangaId);
         return;
     }
@@ -1104,107 +1136,87 @@ std::string Application::getDownloadQualityString(DownloadQuality quality) {
 }
 
 bool Application::loadSettings() {
+    std::lock_guard<std::mutex> writeLock(m_settingsWriteMutex);
+    SettingsStore& store = m_settingsStore;
+
     std::string settingsPath = getSettingsPath();
     brls::Logger::debug("loadSettings: Opening {}", settingsPath);
 
-    auto fileData = platform::readFile(settingsPath);
-    if (fileData.empty()) {
-        brls::Logger::debug("No settings file found");
-        return false;
-    }
-    if (fileData.size() > 16384) {
-        brls::Logger::error("loadSettings: Invalid file size");
-        return false;
+    if (store.load(settingsPath)) {
+        brls::Logger::debug("loadSettings: Read {} keys", store.size());
+    } else {
+        // Older versions wrote settings.json; import it once and the next
+        // save writes the binary store
+        auto fileData = platform::readFile(getLegacySettingsPath());
+        if (fileData.empty()) {
+            brls::Logger::debug("No settings file found");
+            return false;
+        }
+        std::string content(reinterpret_cast<const char*>(fileData.data()), fileData.size());
+        if (!store.importJson(content)) {
+            brls::Logger::warning("loadSettings: settings.json is malformed, keeping what parsed");
+        }
+        brls::Logger::info("loadSettings: Imported {} keys from settings.json", store.size());
     }
 
-    std::string content(reinterpret_cast<const char*>(fileData.data()), fileData.size());
-
-    brls::Logger::debug("loadSettings: Read {} bytes", content.length());
-
-    // Simple JSON parsing for strings
-    auto extractString = [&content](const std::string& key) -> std::string {
-        std::string search = "\"" + key + "\":";
-        size_t pos = content.find(search);
-        if (pos == std::string::npos) return "";
-        pos += search.length();
-        while (pos < content.length() && (content[pos] == ' ' || content[pos] == '\t')) pos++;
-        if (pos >= content.length() || content[pos] != '"') return "";
-        pos++;
-        size_t end = content.find("\"", pos);
-        if (end == std::string::npos) return "";
-        return content.substr(pos, end - pos);
+    auto getInt = [&store](const std::string& key, int defaultVal = 0) -> int {
+        return static_cast<int>(store.getInt(key, defaultVal));
     };
-
-    // Parse integers
-    auto extractInt = [&content](const std::string& key) -> int {
-        std::string search = "\"" + key + "\":";
-        size_t pos = content.find(search);
-        if (pos == std::string::npos) return 0;
-        pos += search.length();
-        while (pos < content.length() && (content[pos] == ' ' || content[pos] == '\t')) pos++;
-        size_t end = content.find_first_of(",}\n", pos);
-        if (end == std::string::npos) return 0;
-        return atoi(content.substr(pos, end - pos).c_str());
+    auto getBool = [&store](const std::string& key, bool defaultVal = false) -> bool {
+        return store.getBool(key, defaultVal);
     };
-
-    // Parse booleans
-    auto extractBool = [&content](const std::string& key, bool defaultVal = false) -> bool {
-        std::string search = "\"" + key + "\":";
-        size_t pos = content.find(search);
-        if (pos == std::string::npos) return defaultVal;
-        pos += search.length();
-        while (pos < content.length() && (content[pos] == ' ' || content[pos] == '\t')) pos++;
-        return (content.substr(pos, 4) == "true");
+    auto getString = [&store](const std::string& key) -> std::string {
+        return store.getString(key);
     };
 
     // Load connection info
-    m_serverUrl = extractString("serverUrl");
-    m_currentCategoryId = extractInt("currentCategoryId");
+    m_serverUrl = getString("serverUrl");
+    m_currentCategoryId = getInt("currentCategoryId");
 
     brls::Logger::info("loadSettings: serverUrl={}",
                        m_serverUrl.empty() ? "(empty)" : m_serverUrl);
 
     // Load UI settings
-    m_settings.theme = static_cast<AppTheme>(extractInt("theme"));
+    m_settings.theme = static_cast<AppTheme>(getInt("theme"));
     if (static_cast<int>(m_settings.theme) < 0 || static_cast<int>(m_settings.theme) > 16) {
         m_settings.theme = AppTheme::DARK;
     }
-    m_settings.showClock = extractBool("showClock", true);
-    m_settings.debugLogging = extractBool("debugLogging", false);
-    m_settings.showPerfOverlay = extractBool("showPerfOverlay", false);
+    m_settings.showClock = getBool("showClock", true);
+    m_settings.debugLogging = getBool("debugLogging", false);
+    m_settings.showPerfOverlay = getBool("showPerfOverlay", false);
 
     // Load reader settings
-    m_settings.readingMode = static_cast<ReadingMode>(extractInt("readingMode"));
-    m_settings.pageScaleMode = static_cast<PageScaleMode>(extractInt("pageScaleMode"));
-    m_settings.readerBackground = static_cast<ReaderBackground>(extractInt("readerBackground"));
-    m_settings.imageRotation = extractInt("imageRotation");
+    m_settings.readingMode = static_cast<ReadingMode>(getInt("readingMode"));
+    m_settings.pageScaleMode = static_cast<PageScaleMode>(getInt("pageScaleMode"));
+    m_settings.readerBackground = static_cast<ReaderBackground>(getInt("readerBackground"));
+    m_settings.imageRotation = getInt("imageRotation");
     // Validate rotation (must be 0, 90, 180, or 270)
     if (m_settings.imageRotation != 0 && m_settings.imageRotation != 90 &&
         m_settings.imageRotation != 180 && m_settings.imageRotation != 270) {
         m_settings.imageRotation = 0;
     }
-    m_settings.keepScreenOn = extractBool("keepScreenOn", true);
-    m_settings.showPageNumber = extractBool("showPageNumber", true);
-    m_settings.tapToNavigate = extractBool("tapToNavigate", true);
-    m_settings.goToEndOnPrevChapter = extractBool("goToEndOnPrevChapter", true);
+    m_settings.keepScreenOn = getBool("keepScreenOn", true);
+    m_settings.showPageNumber = getBool("showPageNumber", true);
+    m_settings.tapToNavigate = getBool("tapToNavigate", true);
+    m_settings.goToEndOnPrevChapter = getBool("goToEndOnPrevChapter", true);
 
     // Load webtoon settings
-    m_settings.cropBorders = extractBool("cropBorders", false);
-    m_settings.webtoonDetection = extractBool("webtoonDetection", true);
-    m_settings.webtoonSidePadding = extractInt("webtoonSidePadding");
+    m_settings.cropBorders = getBool("cropBorders", false);
+    m_settings.webtoonDetection = getBool("webtoonDetection", true);
+    m_settings.webtoonSidePadding = getInt("webtoonSidePadding");
     if (m_settings.webtoonSidePadding < 0 || m_settings.webtoonSidePadding > 20) {
         m_settings.webtoonSidePadding = 0;
     }
-    m_settings.reverseMouseScroll = extractBool("reverseMouseScroll", true);
+    m_settings.reverseMouseScroll = getBool("reverseMouseScroll", true);
 
     // Load library settings
-    m_settings.updateOnStart = extractBool("updateOnStart", false);
-    m_settings.updateOnlyWifi = extractBool("updateOnlyWifi", true);
-    m_settings.defaultCategoryId = extractInt("defaultCategoryId");
+    m_settings.updateOnStart = getBool("updateOnStart", false);
+    m_settings.updateOnlyWifi = getBool("updateOnlyWifi", true);
+    m_settings.defaultCategoryId = getInt("defaultCategoryId");
 
     // Load hidden categories (comma-separated IDs)
     m_settings.hiddenCategoryIds.clear();
-    std::string hiddenCatsStr = extractString("hiddenCategoryIds");
+    std::string hiddenCatsStr = getString("hiddenCategoryIds");
     if (!hiddenCatsStr.empty()) {
         std::stringstream ss(hiddenCatsStr);
         std::string token;
@@ -1218,129 +1230,58 @@ bool Application::loadSettings() {
     }
 
     // Load cache settings
-    m_settings.cacheLibraryData = extractBool("cacheLibraryData", true);
-    m_settings.cacheCoverImages = extractBool("cacheCoverImages", true);
-    m_settings.downloadsOnlyMode = extractBool("downloadsOnlyMode", false);
-    m_settings.librarySortMode = extractInt("librarySortMode");
+    m_settings.cacheLibraryData = getBool("cacheLibraryData", true);
+    m_settings.cacheCoverImages = getBool("cacheCoverImages", true);
+    m_settings.downloadsOnlyMode = getBool("downloadsOnlyMode", false);
+    m_settings.librarySortMode = getInt("librarySortMode");
     if (m_settings.librarySortMode < 0 || m_settings.librarySortMode > 10) m_settings.librarySortMode = 0;
-    m_settings.chapterSortDescending = extractBool("chapterSortDescending", true);
+    m_settings.chapterSortDescending = getBool("chapterSortDescending", true);
 
     // Load download settings
-    int downloadModeInt = extractInt("downloadMode");
+    int downloadModeInt = getInt("downloadMode");
     m_settings.downloadMode = static_cast<DownloadMode>(downloadModeInt);
     brls::Logger::info("loadSettings: downloadMode = {} (0=Server, 1=Local, 2=Both)", downloadModeInt);
-    int downloadQualityInt = extractInt("downloadQuality");
+    int downloadQualityInt = getInt("downloadQuality");
     if (downloadQualityInt < 0 || downloadQualityInt > 3) downloadQualityInt = 0;
     m_settings.downloadQuality = static_cast<DownloadQuality>(downloadQualityInt);
     brls::Logger::info("loadSettings: downloadQuality = {} (0=Original, 1=High, 2=Medium, 3=Low)", downloadQualityInt);
-    m_settings.autoDownloadChapters = extractBool("autoDownloadChapters", false);
-    m_settings.deleteAfterRead = extractBool("deleteAfterRead", false);
-    m_settings.autoResumeDownloads = extractBool("autoResumeDownloads", true);
-    m_settings.pageCacheEnabled = extractBool("pageCacheEnabled", true);
+    m_settings.autoDownloadChapters = getBool("autoDownloadChapters", false);
+    m_settings.deleteAfterRead = getBool("deleteAfterRead", false);
+    m_settings.autoResumeDownloads = getBool("autoResumeDownloads", true);
+    m_settings.pageCacheEnabled = getBool("pageCacheEnabled", true);
 
     // Load browse/source settings
-    m_settings.showNsfwSources = extractBool("showNsfwSources", false);
+    m_settings.showNsfwSources = getBool("showNsfwSources", false);
     m_settings.enabledSourceLanguages.clear();
-    size_t langArrayPos = content.find("\"enabledSourceLanguages\"");
-    if (langArrayPos != std::string::npos) {
-        size_t arrayStart = content.find('[', langArrayPos);
-        size_t arrayEnd = content.find(']', arrayStart);
-        if (arrayStart != std::string::npos && arrayEnd != std::string::npos) {
-            std::string langArray = content.substr(arrayStart + 1, arrayEnd - arrayStart - 1);
-            // Parse language codes like "en", "multi", etc
-            size_t pos = 0;
-            while (pos < langArray.length()) {
-                size_t quoteStart = langArray.find('"', pos);
-                if (quoteStart == std::string::npos) break;
-                size_t quoteEnd = langArray.find('"', quoteStart + 1);
-                if (quoteEnd == std::string::npos) break;
-                std::string lang = langArray.substr(quoteStart + 1, quoteEnd - quoteStart - 1);
-                if (!lang.empty()) {
-                    m_settings.enabledSourceLanguages.insert(lang);
-                }
-                pos = quoteEnd + 1;
-            }
-        }
+    for (const auto& lang : store.getList("enabledSourceLanguages")) {
+        if (!lang.empty()) m_settings.enabledSourceLanguages.insert(lang);
     }
     brls::Logger::info("loadSettings: enabledSourceLanguages count = {}", m_settings.enabledSourceLanguages.size());
 
-    // Load source tags (sourceTags: { "sourceId": ["tag1", "tag2"], ... })
+    // Load source tags (sourceTags.<sourceId> = [tags])
     m_settings.sourceTags.clear();
-    size_t sourceTagsPos = content.find("\"sourceTags\"");
-    if (sourceTagsPos != std::string::npos) {
-        size_t objStart = content.find('{', sourceTagsPos + 12);
-        if (objStart != std::string::npos) {
-            // Find matching closing brace (handle nested arrays)
-            int depth = 1;
-            size_t objEnd = objStart + 1;
-            while (objEnd < content.size() && depth > 0) {
-                if (content[objEnd] == '{') depth++;
-                else if (content[objEnd] == '}') depth--;
-                objEnd++;
-            }
-            std::string tagsObj = content.substr(objStart + 1, objEnd - objStart - 2);
-
-            // Parse each "sourceId": ["tag1", "tag2"] entry
-            size_t searchPos = 0;
-            while (searchPos < tagsObj.size()) {
-                size_t keyStart = tagsObj.find('"', searchPos);
-                if (keyStart == std::string::npos) break;
-                size_t keyEnd = tagsObj.find('"', keyStart + 1);
-                if (keyEnd == std::string::npos) break;
-                std::string sourceId = tagsObj.substr(keyStart + 1, keyEnd - keyStart - 1);
-
-                size_t arrStart = tagsObj.find('[', keyEnd);
-                if (arrStart == std::string::npos) break;
-                size_t arrEnd = tagsObj.find(']', arrStart);
-                if (arrEnd == std::string::npos) break;
-
-                std::string arrStr = tagsObj.substr(arrStart + 1, arrEnd - arrStart - 1);
-                std::set<std::string> tags;
-                size_t tPos = 0;
-                while (tPos < arrStr.size()) {
-                    size_t tStart = arrStr.find('"', tPos);
-                    if (tStart == std::string::npos) break;
-                    size_t tEnd = arrStr.find('"', tStart + 1);
-                    if (tEnd == std::string::npos) break;
-                    std::string tag = arrStr.substr(tStart + 1, tEnd - tStart - 1);
-                    if (!tag.empty()) tags.insert(tag);
-                    tPos = tEnd + 1;
-                }
-                if (!tags.empty()) {
-                    m_settings.sourceTags[sourceId] = tags;
-                }
-                searchPos = arrEnd + 1;
-            }
+    for (const auto& sourceId : store.children("sourceTags")) {
+        std::set<std::string> tags;
+        for (const auto& tag : store.getList("sourceTags." + sourceId)) {
+            if (!tag.empty()) tags.insert(tag);
+        }
+        if (!tags.empty()) {
+            m_settings.sourceTags[sourceId] = tags;
         }
     }
 
     // Load selected source tag filters
     m_settings.selectedSourceTagFilters.clear();
-    size_t tagFilterPos = content.find("\"selectedSourceTagFilters\"");
-    if (tagFilterPos != std::string::npos) {
-        size_t arrStart = content.find('[', tagFilterPos);
-        size_t arrEnd = content.find(']', arrStart);
-        if (arrStart != std::string::npos && arrEnd != std::string::npos) {
-            std::string arrStr = content.substr(arrStart + 1, arrEnd - arrStart - 1);
-            size_t tPos = 0;
-            while (tPos < arrStr.size()) {
-                size_t tStart = arrStr.find('"', tPos);
-                if (tStart == std::string::npos) break;
-                size_t tEnd = arrStr.find('"', tStart + 1);
-                if (tEnd == std::string::npos) break;
-                std::string tag = arrStr.substr(tStart + 1, tEnd - tStart - 1);
-                if (!tag.empty()) m_settings.selectedSourceTagFilters.insert(tag);
-                tPos = tEnd + 1;
-            }
-        }
+    for (const auto& tag : store.getList("selectedSourceTagFilters")) {
+        if (!tag.empty()) m_settings.selectedSourceTagFilters.insert(tag);
     }
 
     // Load network settings
-    m_settings.localServerUrl = extractString("localServerUrl");
-    m_settings.remoteServerUrl = extractString("remoteServerUrl");
-    m_settings.useRemoteUrl = extractBool("useRemoteUrl", false);
-    m_settings.autoSwitchOnFailure = extractBool("autoSwitchOnFailure", false);
-    m_settings.connectionTimeout = extractInt("connectionTimeout");
+    m_settings.localServerUrl = getString("localServerUrl");
+    m_settings.remoteServerUrl = getString("remoteServerUrl");
+    m_settings.useRemoteUrl = getBool("useRemoteUrl", false);
+    m_settings.autoSwitchOnFailure = getBool("autoSwitchOnFailure", false);
+    m_settings.connectionTimeout = getInt("connectionTimeout");
     if (m_settings.connectionTimeout <= 0) m_settings.connectionTimeout = 30;
 
     brls::Logger::info("loadSettings: localUrl={}, remoteUrl={}, useRemote={}, autoSwitch={}",
@@ -1350,287 +1291,108 @@ bool Application::loadSettings() {
                        m_settings.autoSwitchOnFailure ? "true" : "false");
 
     // Load display settings
-    m_settings.showUnreadBadge = extractBool("showUnreadBadge", true);
+    m_settings.showUnreadBadge = getBool("showUnreadBadge", true);
 
     // Load server image settings flag
-    m_settings.serverImageSettingsApplied = extractBool("serverImageSettingsApplied", false);
+    m_settings.serverImageSettingsApplied = getBool("serverImageSettingsApplied", false);
 
     // Load library grid customization
-    int displayModeInt = extractInt("libraryDisplayMode");
+    int displayModeInt = getInt("libraryDisplayMode");
     if (displayModeInt >= 0 && displayModeInt <= 2) {
         m_settings.libraryDisplayMode = static_cast<LibraryDisplayMode>(displayModeInt);
     }
-    int gridSizeInt = extractInt("libraryGridSize");
+    int gridSizeInt = getInt("libraryGridSize");
     if (gridSizeInt >= 0 && gridSizeInt <= 2) {
         m_settings.libraryGridSize = static_cast<LibraryGridSize>(gridSizeInt);
     }
-    int listRowSizeInt = extractInt("listRowSize");
+    int listRowSizeInt = getInt("listRowSize");
     if (listRowSizeInt >= 0 && listRowSizeInt <= 3) {
         m_settings.listRowSize = static_cast<ListRowSize>(listRowSizeInt);
     }
-    int defaultSortInt = extractInt("defaultLibrarySortMode");
+    int defaultSortInt = getInt("defaultLibrarySortMode");
     if (defaultSortInt >= 0 && defaultSortInt <= 10) {
         m_settings.defaultLibrarySortMode = defaultSortInt;
     }
-    int groupModeInt = extractInt("libraryGroupMode");
+    int groupModeInt = getInt("libraryGroupMode");
     if (groupModeInt >= 0 && groupModeInt <= 2) {
         m_settings.libraryGroupMode = static_cast<LibraryGroupMode>(groupModeInt);
     }
     brls::Logger::info("loadSettings: libraryDisplayMode={}, libraryGridSize={}, listRowSize={}, defaultSort={}, groupMode={}",
                        displayModeInt, gridSizeInt, listRowSizeInt, defaultSortInt, groupModeInt);
 
-    // Load per-category sort modes
+    // Load per-category sort modes (categorySortModes.<categoryId> = sortMode)
     m_settings.categorySortModes.clear();
-    size_t catSortPos = content.find("\"categorySortModes\"");
-    if (catSortPos != std::string::npos) {
-        size_t openBrace = content.find('{', catSortPos);
-        if (openBrace != std::string::npos) {
-            size_t closeBrace = content.find('}', openBrace);
-            if (closeBrace != std::string::npos) {
-                std::string catSortJson = content.substr(openBrace + 1, closeBrace - openBrace - 1);
-                // Parse each entry: "categoryId": sortMode
-                size_t searchPos = 0;
-                while (searchPos < catSortJson.length()) {
-                    size_t quoteStart = catSortJson.find('"', searchPos);
-                    if (quoteStart == std::string::npos) break;
-                    size_t quoteEnd = catSortJson.find('"', quoteStart + 1);
-                    if (quoteEnd == std::string::npos) break;
-                    std::string catIdStr = catSortJson.substr(quoteStart + 1, quoteEnd - quoteStart - 1);
-                    int categoryId = atoi(catIdStr.c_str());
-                    size_t colonPos = catSortJson.find(':', quoteEnd);
-                    if (colonPos != std::string::npos) {
-                        int sortMode = atoi(catSortJson.c_str() + colonPos + 1);
-                        if (sortMode >= -1 && sortMode <= 10) {
-                            m_settings.categorySortModes[categoryId] = sortMode;
-                        }
-                    }
-                    searchPos = quoteEnd + 1;
-                }
-                brls::Logger::debug("Loaded {} per-category sort modes", m_settings.categorySortModes.size());
-            }
+    for (const auto& catIdStr : store.children("categorySortModes")) {
+        int sortMode = getInt("categorySortModes." + catIdStr, -2);
+        if (sortMode >= -1 && sortMode <= 10) {
+            m_settings.categorySortModes[atoi(catIdStr.c_str())] = sortMode;
         }
     }
+    brls::Logger::debug("Loaded {} per-category sort modes", m_settings.categorySortModes.size());
 
     // Load search history settings
-    m_settings.maxSearchHistory = extractInt("maxSearchHistory");
+    m_settings.maxSearchHistory = getInt("maxSearchHistory");
     if (m_settings.maxSearchHistory <= 0 || m_settings.maxSearchHistory > 100) {
         m_settings.maxSearchHistory = 20;
     }
     m_settings.searchHistory.clear();
-    size_t histArrayPos = content.find("\"searchHistory\"");
-    if (histArrayPos != std::string::npos) {
-        size_t arrayStart = content.find('[', histArrayPos);
-        size_t arrayEnd = content.find(']', arrayStart);
-        if (arrayStart != std::string::npos && arrayEnd != std::string::npos) {
-            std::string histArray = content.substr(arrayStart + 1, arrayEnd - arrayStart - 1);
-            // Parse search queries
-            size_t pos = 0;
-            while (pos < histArray.length()) {
-                size_t quoteStart = histArray.find('"', pos);
-                if (quoteStart == std::string::npos) break;
-                // Find end quote, accounting for escaped quotes
-                size_t quoteEnd = quoteStart + 1;
-                while (quoteEnd < histArray.length()) {
-                    if (histArray[quoteEnd] == '"' && histArray[quoteEnd - 1] != '\\') break;
-                    quoteEnd++;
-                }
-                if (quoteEnd >= histArray.length()) break;
-                std::string query = histArray.substr(quoteStart + 1, quoteEnd - quoteStart - 1);
-                // Unescape
-                std::string unescaped;
-                for (size_t i = 0; i < query.length(); i++) {
-                    if (query[i] == '\\' && i + 1 < query.length()) {
-                        if (query[i + 1] == '"' || query[i + 1] == '\\') {
-                            unescaped += query[i + 1];
-                            i++;
-                            continue;
-                        }
-                    }
-                    unescaped += query[i];
-                }
-                if (!unescaped.empty()) {
-                    m_settings.searchHistory.push_back(unescaped);
-                }
-                pos = quoteEnd + 1;
-            }
-        }
+    for (const auto& query : store.getList("searchHistory")) {
+        if (!query.empty()) m_settings.searchHistory.push_back(query);
     }
     brls::Logger::debug("Loaded {} search history entries", m_settings.searchHistory.size());
 
     // Load reading statistics
-    m_settings.totalChaptersRead = extractInt("totalChaptersRead");
-    m_settings.totalMangaCompleted = extractInt("totalMangaCompleted");
-    m_settings.currentStreak = extractInt("currentStreak");
-    m_settings.longestStreak = extractInt("longestStreak");
-
-    // Extract int64 for timestamps - need special handling
-    auto extractInt64 = [&content](const std::string& key) -> int64_t {
-        std::string search = "\"" + key + "\":";
-        size_t pos = content.find(search);
-        if (pos == std::string::npos) return 0;
-        pos += search.length();
-        while (pos < content.length() && (content[pos] == ' ' || content[pos] == '\t')) pos++;
-        size_t end = content.find_first_of(",}\n", pos);
-        if (end == std::string::npos) return 0;
-        return std::stoll(content.substr(pos, end - pos));
-    };
-
-    m_settings.lastReadDate = extractInt64("lastReadDate");
-    m_settings.totalReadingTime = extractInt64("totalReadingTime");
+    m_settings.totalChaptersRead = getInt("totalChaptersRead");
+    m_settings.totalMangaCompleted = getInt("totalMangaCompleted");
+    m_settings.currentStreak = getInt("currentStreak");
+    m_settings.longestStreak = getInt("longestStreak");
+    m_settings.lastReadDate = store.getInt("lastReadDate");
+    m_settings.totalReadingTime = store.getInt("totalReadingTime");
 
     // Load SyncYomi settings
-    m_settings.syncYomiEnabled = extractBool("syncYomiEnabled", false);
-    m_settings.syncYomiHost = extractString("syncYomiHost");
-    m_settings.syncYomiApiKey = deobfuscate(extractString("syncYomiApiKey"));
-    m_settings.syncDataManga = extractBool("syncDataManga", true);
-    m_settings.syncDataChapters = extractBool("syncDataChapters", true);
-    m_settings.syncDataTracking = extractBool("syncDataTracking", true);
-    m_settings.syncDataHistory = extractBool("syncDataHistory", true);
-    m_settings.syncDataCategories = extractBool("syncDataCategories", true);
-
-    // Load per-manga reader settings
+    m_settings.syncYomiEnabled = getBool("syncYomiEnabled", false);
+    m_settings.syncYomiHost = getString("syncYomiHost");
+    m_settings.syncYomiApiKey = deobfuscate(getString("syncYomiApiKey"));
+    m_settings.syncDataManga = getBool("syncDataManga", true);
+    m_settings.syncDataChapters = getBool("syncDataChapters", true);
+    m_settings.syncDataTracking = getBool("syncDataTracking", true);
+    m_settings.syncDataHistory = getBool("syncDataHistory", true);
+    m_settings.syncDataCategories = getBool("syncDataCategories", true);
+
+    // Load per-manga reader settings (mangaReaderSettings.<mangaId>.<field>)
     m_settings.mangaReaderSettings.clear();
-    size_t mangaSettingsPos = content.find("\"mangaReaderSettings\"");
-    if (mangaSettingsPos != std::string::npos) {
-        size_t openBrace = content.find('{', mangaSettingsPos + 21);
-        if (openBrace != std::string::npos) {
-            // Find matching close brace
-            int braceCount = 1;
-            size_t pos = openBrace + 1;
-            size_t closeBrace = std::string::npos;
-            while (pos < content.length() && braceCount > 0) {
-                if (content[pos] == '{') braceCount++;
-                else if (content[pos] == '}') braceCount--;
-                if (braceCount == 0) closeBrace = pos;
-                pos++;
-            }
-
-            if (closeBrace != std::string::npos) {
-                std::string mangaJson = content.substr(openBrace + 1, closeBrace - openBrace - 1);
-
-                // Parse each manga entry: "123": {...}
-                size_t searchPos = 0;
-                while (searchPos < mangaJson.length()) {
-                    size_t quoteStart = mangaJson.find('"', searchPos);
-                    if (quoteStart == std::string::npos) break;
-
-                    size_t quoteEnd = mangaJson.find('"', quoteStart + 1);
-                    if (quoteEnd == std::string::npos) break;
-
-                    std::string mangaIdStr = mangaJson.substr(quoteStart + 1, quoteEnd - quoteStart - 1);
-                    int mangaId = atoi(mangaIdStr.c_str());
-
-                    if (mangaId > 0) {
-                        size_t entryBrace = mangaJson.find('{', quoteEnd);
-                        size_t entryEnd = mangaJson.find('}', entryBrace);
-                        if (entryBrace != std::string::npos && entryEnd != std::string::npos) {
-                            std::string entryJson = mangaJson.substr(entryBrace, entryEnd - entryBrace + 1);
-
-                            MangaReaderSettings settings;
-
-                            // Extract readingMode
-                            size_t rmPos = entryJson.find("\"readingMode\"");
-                            if (rmPos != std::string::npos) {
-                                size_t colonPos = entryJson.find(':', rmPos);
-                                if (colonPos != std::string::npos) {
-                                    int val = atoi(entryJson.c_str() + colonPos + 1);
-                                    settings.readingMode = static_cast<ReadingMode>(val);
-                                }
-                            }
-
-                            // Extract pageScaleMode
-                            size_t psPos = entryJson.find("\"pageScaleMode\"");
-                            if (psPos != std::string::npos) {
-                                size_t colonPos = entryJson.find(':', psPos);
-                                if (colonPos != std::string::npos) {
-                                    int val = atoi(entryJson.c_str() + colonPos + 1);
-                                    settings.pageScaleMode = static_cast<PageScaleMode>(val);
-                                }
-                            }
-
-                            // Extract imageRotation
-                            size_t irPos = entryJson.find("\"imageRotation\"");
-                            if (irPos != std::string::npos) {
-                                size_t colonPos = entryJson.find(':', irPos);
-                                if (colonPos != std::string::npos) {
-                                    settings.imageRotation = atoi(entryJson.c_str() + colonPos + 1);
-                                }
-                            }
-
-                            // Extract cropBorders
-                            size_t cbPos = entryJson.find("\"cropBorders\"");
-                            if (cbPos != std::string::npos) {
-                                size_t colonPos = entryJson.find(':', cbPos);
-                                if (colonPos != std::string::npos) {
-                                    size_t valueStart = colonPos + 1;
-                                    while (valueStart < entryJson.length() &&
-                                           (entryJson[valueStart] == ' ' || entryJson[valueStart] == '\t')) {
-                                        valueStart++;
-                                    }
-                                    settings.cropBorders = (entryJson.substr(valueStart, 4) == "true");
-                                }
-                            }
-
-                            // Extract webtoonSidePadding
-                            size_t wspPos = entryJson.find("\"webtoonSidePadding\"");
-                            if (wspPos != std::string::npos) {
-                                size_t colonPos = entryJson.find(':', wspPos);
-                                if (colonPos != std::string::npos) {
-                                    settings.webtoonSidePadding = atoi(entryJson.c_str() + colonPos + 1);
-                                    if (settings.webtoonSidePadding < 0 || settings.webtoonSidePadding > 20) {
-                                        settings.webtoonSidePadding = 0;
-                                    }
-                                }
-                            }
-
-                            // Extract isWebtoonFormat
-                            size_t iwfPos = entryJson.find("\"isWebtoonFormat\"");
-                            if (iwfPos != std::string::npos) {
-                                size_t colonPos = entryJson.find(':', iwfPos);
-                                if (colonPos != std::string::npos) {
-                                    size_t valueStart = colonPos + 1;
-                                    while (valueStart < entryJson.length() &&
-                                           (entryJson[valueStart] == ' ' || entryJson[valueStart] == '\t')) {
-                                        valueStart++;
-                                    }
-                                    settings.isWebtoonFormat = (entryJson.substr(valueStart, 4) == "true");
-                                }
-                            }
-
-                            // Extract readerBackground
-                            size_t rbPos = entryJson.find("\"readerBackground\"");
-                            if (rbPos != std::string::npos) {
-                                size_t colonPos = entryJson.find(':', rbPos);
-                                if (colonPos != std::string::npos) {
-                                    int val = atoi(entryJson.c_str() + colonPos + 1);
-                                    if (val >= 0 && val <= 2) {
-                                        settings.readerBackground = static_cast<ReaderBackground>(val);
-                                    }
-                                }
-                            }
-
-                            m_settings.mangaReaderSettings[mangaId] = settings;
-                            searchPos = entryEnd + 1;
-                        } else {
-                            break;
-                        }
-                    } else {
-                        searchPos = quoteEnd + 1;
-                    }
-                }
-
-                brls::Logger::debug("Loaded {} per-manga reader settings", m_settings.mangaReaderSettings.size());
-            }
+    for (const auto& mangaIdStr : store.children("mangaReaderSettings")) {
+        int mangaId = atoi(mangaIdStr.c_str());
+        if (mangaId <= 0) continue;
+
+        std::string prefix = "mangaReaderSettings." + mangaIdStr + ".";
+        MangaReaderSettings settings;
+        settings.readingMode = static_cast<ReadingMode>(
+            getInt(prefix + "readingMode", static_cast<int>(settings.readingMode)));
+        settings.pageScaleMode = static_cast<PageScaleMode>(
+            getInt(prefix + "pageScaleMode", static_cast<int>(settings.pageScaleMode)));
+        settings.imageRotation = getInt(prefix + "imageRotation", settings.imageRotation);
+        settings.cropBorders = getBool(prefix + "cropBorders", settings.cropBorders);
+        settings.webtoonSidePadding = getInt(prefix + "webtoonSidePadding", settings.webtoonSidePadding);
+        if (settings.webtoonSidePadding < 0 || settings.webtoonSidePadding > 20) {
+            settings.webtoonSidePadding = 0;
+        }
+        settings.isWebtoonFormat = getBool(prefix + "isWebtoonFormat", settings.isWebtoonFormat);
+        int background = getInt(prefix + "readerBackground", static_cast<int>(settings.readerBackground));
+        if (background >= 0 && background <= 2) {
+            settings.readerBackground = static_cast<ReaderBackground>(background);
         }
+        m_settings.mangaReaderSettings[mangaId] = settings;
     }
+    brls::Logger::debug("Loaded {} per-manga reader settings", m_settings.mangaReaderSettings.size());
 
     // Load auth credentials (deobfuscate sensitive fields; handles legacy plain text)
-    m_authUsername = extractString("authUsername");
-    m_authPassword = deobfuscate(extractString("authPassword"));
-    m_settings.authMode = extractInt("authMode");
-    m_settings.accessToken = deobfuscate(extractString("accessToken"));
-    m_settings.refreshToken = deobfuscate(extractString("refreshToken"));
-    m_settings.sessionCookie = deobfuscate(extractString("sessionCookie"));
+    m_authUsername = getString("authUsername");
+    m_authPassword = deobfuscate(getString("authPassword"));
+    m_settings.authMode = getInt("authMode");
+    m_settings.accessToken = deobfuscate(getString("accessToken"));
+    m_settings.refreshToken = deobfuscate(getString("refreshToken"));
+    m_settings.sessionCookie = deobfuscate(getString("sessionCookie"));
 
     // Apply auth credentials and mode to SuwayomiClient
     SuwayomiClient& client = SuwayomiClient::getInstance();
@@ -1657,218 +1419,207 @@ bool Application::loadSettings() {
     return true;  // Return true if we successfully read the file
 }
 
-bool Application::saveSettings() {
-    brls::Logger::info("saveSettings: Saving to {}", getSettingsPath());
-    brls::Logger::debug("saveSettings: serverUrl={}",
-                        m_serverUrl.empty() ? "(empty)" : m_serverUrl);
-
-    // Create JSON content
-    std::string json = "{\n";
+// Copy a snapshot into the store. Keys that are not set again (a removed
+// per-category sort mode, say) are dropped by endSnapshot().
+static void fillSettingsStore(SettingsStore& store, const AppSettings& s, const std::string& serverUrl,
+                              int currentCategoryId, const std::string& authUsername,
+                              const std::string& authPassword) {
+    store.beginSnapshot();
 
     // Connection info
-    json += "  \"serverUrl\": \"" + m_serverUrl + "\",\n";
-    json += "  \"currentCategoryId\": " + std::to_string(m_currentCategoryId) + ",\n";
+    store.setString("serverUrl", serverUrl);
+    store.setInt("currentCategoryId", currentCategoryId);
 
     // Auth credentials (obfuscated for security - not stored as plain text)
-    json += "  \"authUsername\": \"" + m_authUsername + "\",\n";
-    json += "  \"authPassword\": \"" + obfuscate(m_authPassword) + "\",\n";
-    json += "  \"authMode\": " + std::to_string(m_settings.authMode) + ",\n";
-    json += "  \"accessToken\": \"" + obfuscate(m_settings.accessToken) + "\",\n";
-    json += "  \"refreshToken\": \"" + obfuscate(m_settings.refreshToken) + "\",\n";
-    json += "  \"sessionCookie\": \"" + obfuscate(m_settings.sessionCookie) + "\",\n";
+    store.setString("authUsername", authUsername);
+    store.setString("authPassword", obfuscate(authPassword));
+    store.setInt("authMode", s.authMode);
+    store.setString("accessToken", obfuscate(s.accessToken));
+    store.setString("refreshToken", obfuscate(s.refreshToken));
+    store.setString("sessionCookie", obfuscate(s.sessionCookie));
 
     // UI settings
-    json += "  \"theme\": " + std::to_string(static_cast<int>(m_settings.theme)) + ",\n";
-    json += "  \"showClock\": " + std::string(m_settings.showClock ? "true" : "false") + ",\n";
-    json += "  \"debugLogging\": " + std::string(m_settings.debugLogging ? "true" : "false") + ",\n";
-    json += "  \"showPerfOverlay\": " + std::string(m_settings.showPerfOverlay ? "true" : "false") + ",\n";
+    store.setInt("theme", static_cast<int>(s.theme));
+    store.setBool("showClock", s.showClock);
+    store.setBool("debugLogging", s.debugLogging);
+    store.setBool("showPerfOverlay", s.showPerfOverlay);
 
     // Reader settings
-    json += "  \"readingMode\": " + std::to_string(static_cast<int>(m_settings.readingMode)) + ",\n";
-    json += "  \"pageScaleMode\": " + std::to_string(static_cast<int>(m_settings.pageScaleMode)) + ",\n";
-    json += "  \"readerBackground\": " + std::to_string(static_cast<int>(m_settings.readerBackground)) + ",\n";
-    json += "  \"imageRotation\": " + std::to_string(m_settings.imageRotation) + ",\n";
-    json += "  \"keepScreenOn\": " + std::string(m_settings.keepScreenOn ? "true" : "false") + ",\n";
-    json += "  \"showPageNumber\": " + std::string(m_settings.showPageNumber ? "true" : "false") + ",\n";
-    json += "  \"tapToNavigate\": " + std::string(m_settings.tapToNavigate ? "true" : "false") + ",\n";
-    json += "  \"goToEndOnPrevChapter\": " + std::string(m_settings.goToEndOnPrevChapter ? "true" : "false") + ",\n";
+    store.setInt("readingMode", static_cast<int>(s.readingMode));
+    store.setInt("pageScaleMode", static_cast<int>(s.pageScaleMode));
+    store.setInt("readerBackground", static_cast<int>(s.readerBackground));
+    store.setInt("imageRotation", s.imageRotation);
+    store.setBool("keepScreenOn", s.keepScreenOn);
+    store.setBool("showPageNumber", s.showPageNumber);
+    store.setBool("tapToNavigate", s.tapToNavigate);
+    store.setBool("goToEndOnPrevChapter", s.goToEndOnPrevChapter);
 
     // Webtoon settings
-    json += "  \"cropBorders\": " + std::string(m_settings.cropBorders ? "true" : "false") + ",\n";
-    json += "  \"webtoonDetection\": " + std::string(m_settings.webtoonDetection ? "true" : "false") + ",\n";
-    json += "  \"webtoonSidePadding\": " + std::to_string(m_settings.webtoonSidePadding) + ",\n";
-    json += "  \"reverseMouseScroll\": " + std::string(m_settings.reverseMouseScroll ? "true" : "false") + ",\n";
+    store.setBool("cropBorders", s.cropBorders);
+    store.setBool("webtoonDetection", s.webtoonDetection);
+    store.setInt("webtoonSidePadding", s.webtoonSidePadding);
+    store.setBool("reverseMouseScroll", s.reverseMouseScroll);
 
     // Library settings
-    json += "  \"updateOnStart\": " + std::string(m_settings.updateOnStart ? "true" : "false") + ",\n";
-    json += "  \"updateOnlyWifi\": " + std::string(m_settings.updateOnlyWifi ? "true" : "false") + ",\n";
-    json += "  \"defaultCategoryId\": " + std::to_string(m_settings.defaultCategoryId) + ",\n";
+    store.setBool("updateOnStart", s.updateOnStart);
+    store.setBool("updateOnlyWifi", s.updateOnlyWifi);
+    store.setInt("defaultCategoryId", s.defaultCategoryId);
 
     // Hidden categories (stored as comma-separated IDs)
     std::string hiddenCatsStr;
-    for (int catId : m_settings.hiddenCategoryIds) {
+    for (int catId : s.hiddenCategoryIds) {
         if (!hiddenCatsStr.empty()) hiddenCatsStr += ",";
         hiddenCatsStr += std::to_string(catId);
     }
-    json += "  \"hiddenCategoryIds\": \"" + hiddenCatsStr + "\",\n";
+    store.setString("hiddenCategoryIds", hiddenCatsStr);
 
     // Cache settings
-    json += "  \"cacheLibraryData\": " + std::string(m_settings.cacheLibraryData ? "true" : "false") + ",\n";
-    json += "  \"cacheCoverImages\": " + std::string(m_settings.cacheCoverImages ? "true" : "false") + ",\n";
-    json += "  \"downloadsOnlyMode\": " + std::string(m_settings.downloadsOnlyMode ? "true" : "false") + ",\n";
-    json += "  \"librarySortMode\": " + std::to_string(m_settings.librarySortMode) + ",\n";
-    json += "  \"chapterSortDescending\": " + std::string(m_settings.chapterSortDescending ? "true" : "false") + ",\n";
+    store.setBool("cacheLibraryData", s.cacheLibraryData);
+    store.setBool("cacheCoverImages", s.cacheCoverImages);
+    store.setBool("downloadsOnlyMode", s.downloadsOnlyMode);
+    store.setInt("librarySortMode", s.librarySortMode);
+    store.setBool("chapterSortDescending", s.chapterSortDescending);
 
     // Download settings
-    json += "  \"downloadMode\": " + std::to_string(static_cast<int>(m_settings.downloadMode)) + ",\n";
-    json += "  \"downloadQuality\": " + std::to_string(static_cast<int>(m_settings.downloadQuality)) + ",\n";
-    json += "  \"autoDownloadChapters\": " + std::string(m_settings.autoDownloadChapters ? "true" : "false") + ",\n";
-    json += "  \"deleteAfterRead\": " + std::string(m_settings.deleteAfterRead ? "true" : "false") + ",\n";
-    json += "  \"autoResumeDownloads\": " + std::string(m_settings.autoResumeDownloads ? "true" : "false") + ",\n";
-    json += "  \"pageCacheEnabled\": " + std::string(m_settings.pageCacheEnabled ? "true" : "false") + ",\n";
+    store.setInt("downloadMode", static_cast<int>(s.downloadMode));
+    store.setInt("downloadQuality", static_cast<int>(s.downloadQuality));
+    store.setBool("autoDownloadChapters", s.autoDownloadChapters);
+    store.setBool("deleteAfterRead", s.deleteAfterRead);
+    store.setBool("autoResumeDownloads", s.autoResumeDownloads);
+    store.setBool("pageCacheEnabled", s.pageCacheEnabled);
 
     // Browse/Source settings
-    json += "  \"showNsfwSources\": " + std::string(m_settings.showNsfwSources ? "true" : "false") + ",\n";
-    json += "  \"enabledSourceLanguages\": [";
-    {
-        bool first = true;
-        for (const auto& lang : m_settings.enabledSourceLanguages) {
-            if (!first) json += ", ";
-            first = false;
-            json += "\"" + lang + "\"";
-        }
-    }
-    json += "],\n";
-
-    // Source tags
-    json += "  \"sourceTags\": {";
-    {
-        bool firstSource = true;
-        for (const auto& [sourceId, tags] : m_settings.sourceTags) {
-            if (tags.empty()) continue;
-            if (!firstSource) json += ", ";
-            firstSource = false;
-            json += "\"" + sourceId + "\": [";
-            bool firstTag = true;
-            for (const auto& tag : tags) {
-                if (!firstTag) json += ", ";
-                firstTag = false;
-                json += "\"" + tag + "\"";
-            }
-            json += "]";
-        }
-    }
-    json += "},\n";
-
-    // Selected source tag filters
-    json += "  \"selectedSourceTagFilters\": [";
-    {
-        bool first = true;
-        for (const auto& tag : m_settings.selectedSourceTagFilters) {
-            if (!first) json += ", ";
-            first = false;
-            json += "\"" + tag + "\"";
-        }
+    store.setBool("showNsfwSources", s.showNsfwSources);
+    store.setList("enabledSourceLanguages",
+                  std::vector<std::string>(s.enabledSourceLanguages.begin(), s.enabledSourceLanguages.end()));
+    for (const auto& [sourceId, tags] : s.sourceTags) {
+        if (tags.empty()) continue;
+        store.setList("sourceTags." + sourceId, std::vector<std::string>(tags.begin(), tags.end()));
     }
-    json += "],\n";
+    store.setList("selectedSourceTagFilters",
+                  std::vector<std::string>(s.selectedSourceTagFilters.begin(), s.selectedSourceTagFilters.end()));
 
     // Network settings
-    json += "  \"localServerUrl\": \"" + m_settings.localServerUrl + "\",\n";
-    json += "  \"remoteServerUrl\": \"" + m_settings.remoteServerUrl + "\",\n";
-    json += "  \"useRemoteUrl\": " + std::string(m_settings.useRemoteUrl ? "true" : "false") + ",\n";
-    json += "  \"autoSwitchOnFailure\": " + std::string(m_settings.autoSwitchOnFailure ? "true" : "false") + ",\n";
-    json += "  \"connectionTimeout\": " + std::to_string(m_settings.connectionTimeout) + ",\n";
+    store.setString("localServerUrl", s.localServerUrl);
+    store.setString("remoteServerUrl", s.remoteServerUrl);
+    store.setBool("useRemoteUrl", s.useRemoteUrl);
+    store.setBool("autoSwitchOnFailure", s.autoSwitchOnFailure);
+    store.setInt("connectionTimeout", s.connectionTimeout);
 
     // Display settings
-    json += "  \"showUnreadBadge\": " + std::string(m_settings.showUnreadBadge ? "true" : "false") + ",\n";
+    store.setBool("showUnreadBadge", s.showUnreadBadge);
 
     // Server image settings flag
-    json += "  \"serverImageSettingsApplied\": " + std::string(m_settings.serverImageSettingsApplied ? "true" : "false") + ",\n";
+    store.setBool("serverImageSettingsApplied", s.serverImageSettingsApplied);
 
     // Library grid customization
-    json += "  \"libraryDisplayMode\": " + std::to_string(static_cast<int>(m_settings.libraryDisplayMode)) + ",\n";
-    json += "  \"libraryGridSize\": " + std::to_string(static_cast<int>(m_settings.libraryGridSize)) + ",\n";
-    json += "  \"listRowSize\": " + std::to_string(static_cast<int>(m_settings.listRowSize)) + ",\n";
-    json += "  \"defaultLibrarySortMode\": " + std::to_string(m_settings.defaultLibrarySortMode) + ",\n";
-    json += "  \"libraryGroupMode\": " + std::to_string(static_cast<int>(m_settings.libraryGroupMode)) + ",\n";
+    store.setInt("libraryDisplayMode", static_cast<int>(s.libraryDisplayMode));
+    store.setInt("libraryGridSize", static_cast<int>(s.libraryGridSize));
+    store.setInt("listRowSize", static_cast<int>(s.listRowSize));
+    store.setInt("defaultLibrarySortMode", s.defaultLibrarySortMode);
+    store.setInt("libraryGroupMode", static_cast<int>(s.libraryGroupMode));
 
     // Per-category sort modes
-    json += "  \"categorySortModes\": {";
-    bool firstCatSort = true;
-    for (const auto& pair : m_settings.categorySortModes) {
-        if (!firstCatSort) json += ",";
-        firstCatSort = false;
-        json += "\"" + std::to_string(pair.first) + "\": " + std::to_string(pair.second);
+    for (const auto& pair : s.categorySortModes) {
+        store.setInt("categorySortModes." + std::to_string(pair.first), pair.second);
     }
-    json += "},\n";
 
     // Search history
-    json += "  \"maxSearchHistory\": " + std::to_string(m_settings.maxSearchHistory) + ",\n";
-    json += "  \"searchHistory\": [";
-    {
-        bool first = true;
-        for (const auto& query : m_settings.searchHistory) {
-            if (!first) json += ", ";
-            first = false;
-            // Escape any quotes in search queries
-            std::string escaped;
-            for (char c : query) {
-                if (c == '"') escaped += "\\\"";
-                else if (c == '\\') escaped += "\\\\";
-                else escaped += c;
-            }
-            json += "\"" + escaped + "\"";
-        }
-    }
-    json += "],\n";
+    store.setInt("maxSearchHistory", s.maxSearchHistory);
+    store.setList("searchHistory", s.searchHistory);
 
     // Reading statistics
-    json += "  \"totalChaptersRead\": " + std::to_string(m_settings.totalChaptersRead) + ",\n";
-    json += "  \"totalMangaCompleted\": " + std::to_string(m_settings.totalMangaCompleted) + ",\n";
-    json += "  \"currentStreak\": " + std::to_string(m_settings.currentStreak) + ",\n";
-    json += "  \"longestStreak\": " + std::to_string(m_settings.longestStreak) + ",\n";
-    json += "  \"lastReadDate\": " + std::to_string(m_settings.lastReadDate) + ",\n";
-    json += "  \"totalReadingTime\": " + std::to_string(m_settings.totalReadingTime) + ",\n";
+    store.setInt("totalChaptersRead", s.totalChaptersRead);
+    store.setInt("totalMangaCompleted", s.totalMangaCompleted);
+    store.setInt("currentStreak", s.currentStreak);
+    store.setInt("longestStreak", s.longestStreak);
+    store.setInt("lastReadDate", s.lastReadDate);
+    store.setInt("totalReadingTime", s.totalReadingTime);
 
     // SyncYomi settings (cached locally from server)
-    json += "  \"syncYomiEnabled\": " + std::string(m_settings.syncYomiEnabled ? "true" : "false") + ",\n";
-    json += "  \"syncYomiHost\": \"" + m_settings.syncYomiHost + "\",\n";
-    json += "  \"syncYomiApiKey\": \"" + obfuscate(m_settings.syncYomiApiKey) + "\",\n";
-    json += "  \"syncDataManga\": " + std::string(m_settings.syncDataManga ? "true" : "false") + ",\n";
-    json += "  \"syncDataChapters\": " + std::string(m_settings.syncDataChapters ? "true" : "false") + ",\n";
-    json += "  \"syncDataTracking\": " + std::string(m_settings.syncDataTracking ? "true" : "false") + ",\n";
-    json += "  \"syncDataHistory\": " + std::string(m_settings.syncDataHistory ? "true" : "false") + ",\n";
-    json += "  \"syncDataCategories\": " + std::string(m_settings.syncDataCategories ? "true" : "false") + ",\n";
+    store.setBool("syncYomiEnabled", s.syncYomiEnabled);
+    store.setString("syncYomiHost", s.syncYomiHost);
+    store.setString("syncYomiApiKey", obfuscate(s.syncYomiApiKey));
+    store.setBool("syncDataManga", s.syncDataManga);
+    store.setBool("syncDataChapters", s.syncDataChapters);
+    store.setBool("syncDataTracking", s.syncDataTracking);
+    store.setBool("syncDataHistory", s.syncDataHistory);
+    store.setBool("syncDataCategories", s.syncDataCategories);
 
     // Per-manga reader settings
-    json += "  \"mangaReaderSettings\": {";
-    bool firstManga = true;
-    for (const auto& pair : m_settings.mangaReaderSettings) {
-        if (!firstManga) json += ",";
-        firstManga = false;
-        json += "\n    \"" + std::to_string(pair.first) + "\": {";
-        json += "\"readingMode\": " + std::to_string(static_cast<int>(pair.second.readingMode)) + ", ";
-        json += "\"pageScaleMode\": " + std::to_string(static_cast<int>(pair.second.pageScaleMode)) + ", ";
-        json += "\"imageRotation\": " + std::to_string(pair.second.imageRotation) + ", ";
-        json += "\"cropBorders\": " + std::string(pair.second.cropBorders ? "true" : "false") + ", ";
-        json += "\"webtoonSidePadding\": " + std::to_string(pair.second.webtoonSidePadding) + ", ";
-        json += "\"isWebtoonFormat\": " + std::string(pair.second.isWebtoonFormat ? "true" : "false") + ", ";
-        json += "\"readerBackground\": " + std::to_string(static_cast<int>(pair.second.readerBackground)) + "}";
+    for (const auto& pair : s.mangaReaderSettings) {
+        std::string prefix = "mangaReaderSettings." + std::to_string(pair.first) + ".";
+        const MangaReaderSettings& m = pair.second;
+        store.setInt(prefix + "readingMode", static_cast<int>(m.readingMode));
+        store.setInt(prefix + "pageScaleMode", static_cast<int>(m.pageScaleMode));
+        store.setInt(prefix + "imageRotation", m.imageRotation);
+        store.setBool(prefix + "cropBorders", m.cropBorders);
+        store.setInt(prefix + "webtoonSidePadding", m.webtoonSidePadding);
+        store.setBool(prefix + "isWebtoonFormat", m.isWebtoonFormat);
+        store.setInt(prefix + "readerBackground", static_cast<int>(m.readerBackground));
     }
-    if (!m_settings.mangaReaderSettings.empty()) json += "\n  ";
-    json += "}\n";
 
-    json += "}\n";
+    store.endSnapshot();
+}
 
-    if (platform::writeFile(getSettingsPath(), json)) {
-        brls::Logger::info("Settings saved successfully ({} bytes)", json.length());
-        return true;
+bool Application::saveSettings() {
+    // Called from settings toggles on the main thread: only copy the values
+    // here. Saves within SETTINGS_SAVE_DELAY_MS share one background write.
+    auto snapshot = std::make_unique<SettingsSnapshot>();
+    snapshot->settings = m_settings;
+    snapshot->serverUrl = m_serverUrl;
+    snapshot->authUsername = m_authUsername;
+    snapshot->authPassword = m_authPassword;
+    snapshot->currentCategoryId = m_currentCategoryId;
+
+    EndpointSelector::getInstance().configure(m_settings.localServerUrl, m_settings.remoteServerUrl,
+                                              m_settings.useRemoteUrl, m_settings.autoSwitchOnFailure);
+
+    std::lock_guard<std::mutex> lock(m_settingsSaveMutex);
+    m_pendingSettings = std::move(snapshot);
+    if (m_settingsSaveTimer == 0) {
+        m_settingsSaveTimer = TimerWheel::getInstance().schedule(SETTINGS_SAVE_DELAY_MS, [this]() {
+            writePendingSettings();
+        }, TimerDispatch::WORKER);
+    }
+    return true;
+}
+
+void Application::writePendingSettings() {
+    std::lock_guard<std::mutex> writeLock(m_settingsWriteMutex);
+
+    std::unique_ptr<SettingsSnapshot> snapshot;
+    {
+        std::lock_guard<std::mutex> lock(m_settingsSaveMutex);
+        snapshot = std::move(m_pendingSettings);
+        m_settingsSaveTimer = 0;
+    }
+    if (!snapshot) return;
+
+    fillSettingsStore(m_settingsStore, snapshot->settings, snapshot->serverUrl,
+                      snapshot->currentCategoryId, snapshot->authUsername, snapshot->authPassword);
+    if (!m_settingsStore.isDirty()) {
+        brls::Logger::debug("saveSettings: No changes");
+        return;
+    }
+
+    if (m_settingsStore.save(getSettingsPath())) {
+        brls::Logger::info("Settings saved successfully ({} keys)", m_settingsStore.size());
     } else {
         brls::Logger::error("Failed to write settings file");
-        return false;
     }
 }
 
+void Application::flushSettings() {
+    uint64_t timerId = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_settingsSaveMutex);
+        timerId = m_settingsSaveTimer;
+    }
+    if (timerId != 0) TimerWheel::getInstance().cancel(timerId);
+    writePendingSettings();
+}
+
 std::string Application::getActiveServerUrl() const {
     if (m_settings.useRemoteUrl && !m_settings.remoteServerUrl.empty()) {
         return m_settings.remoteServerUrl;
@@ -1952,6 +1703,14 @@ void Application::switchToRemoteUrl() {
     }
 }
 
+void Application::routeToServerUrl(bool remote) {
+    const std::string& url = remote ? m_settings.remoteServerUrl : m_settings.localServerUrl;
+    if (url.empty() || url == m_serverUrl) return;
+    m_serverUrl = url;
+    SuwayomiClient::getInstance().setServerUrl(m_serverUrl);
+    brls::Logger::info("Routed to {} URL for this session: {}", remote ? "remote" : "local", m_serverUrl);
+}
+
 void Application::updateReadingStatistics(bool chapterCompleted, bool mangaCompleted) {
     // Get current date (days since epoch for streak calculation)
     int64_t currentTime = static_cast<int64_t>(std::time(nullptr));
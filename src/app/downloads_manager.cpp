@@ -8,6 +8,7 @@
 #include "app/suwayomi_client.hpp"
 #include "utils/http_client.hpp"
 #include "utils/image_loader.hpp"
+#include "utils/perf_trace.hpp"
 
 #include <borealis.hpp>
 #include <sstream>
@@ -303,6 +304,7 @@ void DownloadsManager::startDownloads() {
     // the larger stack that curl+mbedTLS requires on Switch)
     platform::launchThread([this]() {
         m_downloadThreadActive.store(true);
+        PerfTrace::setThreadName("downloads");
         while (m_downloading.load()) {
             DownloadedChapter* nextChapter = nullptr;
             int mangaId = 0;
@@ -1573,6 +1575,7 @@ int64_t DownloadsManager::getTotalDownloadSize() const {
 }
 
 void DownloadsManager::downloadChapter(int mangaId, DownloadedChapter& chapter) {
+    PERF_TRACE_SCOPE("download_chapter");
     // Copy critical fields up front.  The 'chapter' reference lives inside a
     // std::deque element inside m_downloads (a std::vector).  If another thread
     // calls queueChapterDownload() while we are downloading, m_downloads may
@@ -1814,6 +1817,7 @@ void DownloadsManager::downloadChapter(int mangaId, DownloadedChapter& chapter)
 
 bool DownloadsManager::downloadPage(int mangaId, int chapterIndex, int pageIndex,
                                      const std::string& imageUrl, std::string& localPath) {
+    PERF_TRACE_SCOPE("download_page");
     if (imageUrl.empty()) {
         brls::Logger::error("DownloadsManager: Empty URL for page {}", pageIndex);
         return false;
@@ -1904,6 +1908,12 @@ bool DownloadsManager::processImageQuality(const std::string& filePath) {
             return true;
     }
 
+    return recompressImage(filePath, maxWidth, jpegQuality);
+}
+
+bool DownloadsManager::recompressImage(const std::string& filePath, int maxWidth, int jpegQuality) {
+    PERF_TRACE_SCOPE("download_requality");
+
     // Load the image
     int w, h, channels;
     unsigned char* data = stbi_load(filePath.c_str(), &w, &h, &channels, 3);
@@ -2006,6 +2016,7 @@ bool DownloadsManager::convertWebPToJpeg(const std::string& filePath) {
 
 void DownloadsManager::preConvertToPageCache(int mangaId, int chapterIndex, int pageIndex,
                                               std::string& filePath) {
+    PERF_TRACE_SCOPE("download_page_cache");
     // Load the downloaded JPEG image
     int w, h, channels;
     unsigned char* rgba = stbi_load(filePath.c_str(), &w, &h, &channels, 4);
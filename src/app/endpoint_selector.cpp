@@ -0,0 +1,209 @@
+/**
+ * VitaSuwayomi - Endpoint Selector implementation
+ */
+
+#include "app/endpoint_selector.hpp"
+#include "app/application.hpp"
+#include "utils/http_client.hpp"
+#include "utils/timer_wheel.hpp"
+
+#include <borealis.hpp>
+
+namespace vitasuwayomi {
+
+static constexpr int PROBE_INTERVAL_MS = 30 * 1000;
+static constexpr int FIRST_PROBE_DELAY_MS = 3000;
+// A failed request asks for a probe right away, but not more often than this
+static constexpr int MIN_REPROBE_MS = 5000;
+static constexpr int PROBE_TIMEOUT_S = 3;
+
+// Weight of the newest sample in the smoothed RTT
+static constexpr float RTT_SMOOTHING = 0.3f;
+// Both healthy: only move when the other endpoint is clearly faster, so
+// jitter does not flip routing (each switch costs warm connections and caches)
+static constexpr float SWITCH_RTT_RATIO = 0.75f;
+static constexpr float SWITCH_MIN_GAIN_MS = 20.0f;
+
+EndpointSelector& EndpointSelector::getInstance() {
+    static EndpointSelector instance;
+    return instance;
+}
+
+std::string EndpointSelector::normalize(const std::string& url) {
+    std::string out = url;
+    while (!out.empty() && out.back() == '/') {
+        out.pop_back();
+    }
+    return out;
+}
+
+void EndpointSelector::configure(const std::string& localUrl, const std::string& remoteUrl,
+                                 bool useRemote, bool autoSwitch) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::string bases[2] = {normalize(localUrl), normalize(remoteUrl)};
+    for (int i = 0; i < 2; i++) {
+        if (m_endpoints[i].baseUrl != bases[i]) {
+            m_endpoints[i] = Endpoint();
+            m_endpoints[i].baseUrl = bases[i];
+        }
+    }
+    // Routing is per session: saving unrelated settings must not undo it,
+    // only a change of the saved choice does
+    if (!m_configured || useRemote != m_preferRemote) {
+        m_active = useRemote ? 1 : 0;
+    }
+    m_configured = true;
+    m_preferRemote = useRemote;
+    m_autoSwitch = autoSwitch;
+}
+
+void EndpointSelector::start() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_started) return;
+    m_started = true;
+
+    TimerWheel::getInstance().schedulePeriodic(PROBE_INTERVAL_MS, []() {
+        EndpointSelector::getInstance().probe();
+    }, TimerDispatch::WORKER);
+    m_soonTimer = TimerWheel::getInstance().schedule(FIRST_PROBE_DELAY_MS, []() {
+        EndpointSelector::getInstance().probe();
+    }, TimerDispatch::WORKER);
+}
+
+bool EndpointSelector::enabledLocked() const {
+    return m_autoSwitch && !m_endpoints[0].baseUrl.empty() && !m_endpoints[1].baseUrl.empty();
+}
+
+int EndpointSelector::endpointForUrlLocked(const std::string& url) const {
+    int match = -1;
+    size_t matchLen = 0;
+    for (int i = 0; i < 2; i++) {
+        const std::string& base = m_endpoints[i].baseUrl;
+        if (base.empty() || base.size() < matchLen) continue;
+        if (url.compare(0, base.size(), base) != 0) continue;
+        if (url.size() > base.size() && url[base.size()] != '/' && url[base.size()] != '?') continue;
+        match = i;
+        matchLen = base.size();
+    }
+    return match;
+}
+
+std::string EndpointSelector::failoverUrl(const std::string& url) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!enabledLocked()) return "";
+
+    int failed = endpointForUrlLocked(url);
+    if (failed < 0) return "";
+
+    // Let the prober decide whether to move everything over
+    m_endpoints[failed].healthy = false;
+    requestProbeLocked();
+
+    const Endpoint& other = m_endpoints[1 - failed];
+    if (other.probed && !other.healthy) return "";
+    return other.baseUrl + url.substr(m_endpoints[failed].baseUrl.size());
+}
+
+std::string EndpointSelector::serverIdentity(const std::string& url) {
+    std::string base = normalize(url);
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (endpointForUrlLocked(base) < 0) return base;
+    return m_endpoints[0].baseUrl.empty() ? m_endpoints[1].baseUrl : m_endpoints[0].baseUrl;
+}
+
+int EndpointSelector::getRttMs(bool remote) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const Endpoint& ep = m_endpoints[remote ? 1 : 0];
+    if (!ep.probed || !ep.healthy) return -1;
+    return static_cast<int>(ep.rttMs);
+}
+
+void EndpointSelector::requestProbeLocked() {
+    if (!m_started || m_probing || m_soonTimer != 0) return;
+    auto sinceLast = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - m_lastProbe).count();
+    int delayMs = sinceLast >= MIN_REPROBE_MS ? 0 : static_cast<int>(MIN_REPROBE_MS - sinceLast);
+
+    m_soonTimer = TimerWheel::getInstance().schedule(delayMs, []() {
+        EndpointSelector::getInstance().probe();
+    }, TimerDispatch::WORKER);
+}
+
+bool EndpointSelector::probeEndpoint(const std::string& baseUrl, int& rttMs) {
+    // Unauthenticated on purpose: any answer from the server (even 401)
+    // proves the route works. 5xx is a proxy in front of a dead server.
+    HttpClient http;
+    http.setTimeout(PROBE_TIMEOUT_S);
+
+    auto start = std::chrono::steady_clock::now();
+    HttpResponse response = http.get(baseUrl + "/api/v1/settings/about");
+    rttMs = static_cast<int>(std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start).count());
+
+    return response.statusCode > 0 && response.statusCode < 500;
+}
+
+void EndpointSelector::probe() {
+    std::string bases[2];
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_soonTimer = 0;
+        if (m_probing || !enabledLocked()) return;
+        m_probing = true;
+        m_lastProbe = std::chrono::steady_clock::now();
+        bases[0] = m_endpoints[0].baseUrl;
+        bases[1] = m_endpoints[1].baseUrl;
+    }
+
+    bool ok[2];
+    int rtt[2] = {0, 0};
+    for (int i = 0; i < 2; i++) {
+        ok[i] = probeEndpoint(bases[i], rtt[i]);
+    }
+
+    int switchTo = -1;
+    float activeRtt = 0.0f;
+    float otherRtt = 0.0f;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_probing = false;
+
+        for (int i = 0; i < 2; i++) {
+            Endpoint& ep = m_endpoints[i];
+            if (ep.baseUrl != bases[i]) continue;  // Reconfigured while probing
+            if (ok[i]) {
+                bool hasHistory = ep.probed && ep.healthy;
+                ep.rttMs = hasHistory ? ep.rttMs + RTT_SMOOTHING * (rtt[i] - ep.rttMs)
+                                      : static_cast<float>(rtt[i]);
+            }
+            ep.healthy = ok[i];
+            ep.probed = true;
+        }
+
+        const Endpoint& active = m_endpoints[m_active];
+        const Endpoint& other = m_endpoints[1 - m_active];
+        activeRtt = active.rttMs;
+        otherRtt = other.rttMs;
+        if (other.healthy &&
+            (!active.healthy || (other.rttMs < active.rttMs * SWITCH_RTT_RATIO &&
+                                 active.rttMs - other.rttMs > SWITCH_MIN_GAIN_MS))) {
+            switchTo = 1 - m_active;
+            m_active = switchTo;
+        }
+
+        brls::Logger::debug("EndpointSelector: local {} {}ms, remote {} {}ms",
+                            m_endpoints[0].healthy ? "up" : "down", static_cast<int>(m_endpoints[0].rttMs),
+                            m_endpoints[1].healthy ? "up" : "down", static_cast<int>(m_endpoints[1].rttMs));
+    }
+
+    if (switchTo < 0) return;
+
+    brls::Logger::info("EndpointSelector: Routing to {} URL ({}ms, was {}ms)",
+                       switchTo == 1 ? "remote" : "local", static_cast<int>(otherRtt),
+                       static_cast<int>(activeRtt));
+    brls::sync([switchTo]() {
+        Application::getInstance().routeToServerUrl(switchTo == 1);
+    });
+}
+
+} // namespace vitasuwayomi
@@ -0,0 +1,318 @@
+/**
+ * VitaSuwayomi - Mutation Outbox implementation
+ */
+
+#include "app/mutation_outbox.hpp"
+#include "app/application.hpp"
+#include "app/suwayomi_client.hpp"
+#include "utils/timer_wheel.hpp"
+
+#include <borealis.hpp>
+#include <algorithm>
+#include <cstring>
+
+#include "platform/platform.hpp"
+
+namespace vitasuwayomi {
+
+static const char OUTBOX_MAGIC[4] = {'O', 'B', 'X', '1'};
+
+// chapterId, mangaId, lastPageRead (int32 each), read (int8), check byte.
+// Each record carries the chapter's whole pending state, so the last one wins.
+static constexpr size_t RECORD_SIZE = 14;
+
+static constexpr int REPLAY_DELAY_MS = 1000;  // Lets a burst of page turns coalesce
+static constexpr int JOURNAL_WRITE_DELAY_MS = 200;  // Queued records share one append
+static constexpr int MIN_BACKOFF_MS = 2000;
+static constexpr int MAX_BACKOFF_MS = 5 * 60 * 1000;
+static constexpr size_t BATCH_SIZE = 25;
+// A write the server keeps rejecting while others go through (e.g. the
+// chapter was deleted) is dropped after this many replays
+static constexpr int MAX_FAILURES = 8;
+
+MutationOutbox& MutationOutbox::getInstance() {
+    static MutationOutbox instance;
+    return instance;
+}
+
+std::string MutationOutbox::getJournalPath() {
+    return platform::path("outbox.bin");
+}
+
+static void encodeRecord(char* out, int chapterId, int mangaId, int lastPageRead, int read) {
+    int32_t fields[3] = {chapterId, mangaId, lastPageRead};
+    std::memcpy(out, fields, sizeof(fields));
+    out[12] = static_cast<char>(static_cast<int8_t>(read));
+    uint8_t check = 0x5A;
+    for (size_t i = 0; i < RECORD_SIZE - 1; i++) check ^= static_cast<uint8_t>(out[i]);
+    out[13] = static_cast<char>(check);
+}
+
+bool MutationOutbox::loadJournalLocked(const std::vector<uint8_t>& data) {
+    if (data.size() < 4 || std::memcmp(data.data(), OUTBOX_MAGIC, 4) != 0) return false;
+
+    for (size_t offset = 4; offset + RECORD_SIZE <= data.size(); offset += RECORD_SIZE) {
+        const uint8_t* rec = data.data() + offset;
+        uint8_t check = 0x5A;
+        for (size_t i = 0; i < RECORD_SIZE - 1; i++) check ^= rec[i];
+        if (check != rec[RECORD_SIZE - 1]) break;  // Torn tail from a crash mid-append
+
+        int32_t fields[3];
+        std::memcpy(fields, rec, sizeof(fields));
+        Pending& entry = m_pending[fields[0]];
+        entry.mangaId = fields[1];
+        entry.lastPageRead = fields[2];
+        entry.read = static_cast<int8_t>(rec[12]);
+        entry.version = ++m_version;
+    }
+    return true;
+}
+
+void MutationOutbox::init() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    // Where the rename cannot overwrite, a rewrite removes the journal first;
+    // a crash in between leaves only the temp copy
+    std::string path = getJournalPath();
+    if (!loadJournalLocked(platform::readFile(path)) &&
+        loadJournalLocked(platform::readFile(path + ".tmp"))) {
+        brls::Logger::warning("MutationOutbox: recovered {} from temp file", path);
+    }
+
+    // Start from a journal without superseded records or a torn tail
+    lock.unlock();
+    writeJournal(true);
+    lock.lock();
+
+    if (!m_pending.empty()) {
+        brls::Logger::info("MutationOutbox: {} chapter writes pending from last run", m_pending.size());
+        scheduleReplayLocked(REPLAY_DELAY_MS);
+    }
+}
+
+void MutationOutbox::setProgress(int mangaId, int chapterId, int lastPageRead) {
+    record(mangaId, chapterId, std::max(0, lastPageRead), -1);
+}
+
+void MutationOutbox::setRead(int mangaId, int chapterId, bool read) {
+    record(mangaId, chapterId, -1, read ? 1 : 0);
+}
+
+void MutationOutbox::record(int mangaId, int chapterId, int lastPageRead, int read) {
+    if (chapterId <= 0) return;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Pending& entry = m_pending[chapterId];
+    entry.mangaId = mangaId;
+    if (lastPageRead >= 0) entry.lastPageRead = lastPageRead;
+    if (read >= 0) entry.read = read;
+    entry.version = ++m_version;
+    entry.failures = 0;
+
+    queueRecordLocked(chapterId, entry);
+    scheduleReplayLocked(REPLAY_DELAY_MS);
+}
+
+void MutationOutbox::queueRecordLocked(int chapterId, const Pending& entry) {
+    // Callers are page turns on the UI thread; the file write goes to a worker
+    char rec[RECORD_SIZE];
+    encodeRecord(rec, chapterId, entry.mangaId, entry.lastPageRead, entry.read);
+    m_unwritten.append(rec, RECORD_SIZE);
+    if (m_journalTimer != 0) return;
+
+    m_journalTimer = TimerWheel::getInstance().schedule(JOURNAL_WRITE_DELAY_MS, []() {
+        MutationOutbox::getInstance().writeJournal(false);
+    }, TimerDispatch::WORKER);
+}
+
+void MutationOutbox::writeJournal(bool rewrite) {
+    std::lock_guard<std::mutex> writeLock(m_journalMutex);
+
+    std::string out;
+    size_t records = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!rewrite) m_journalTimer = 0;
+        // Offline reading keeps appending; fold the journal once it is mostly
+        // superseded records
+        size_t queued = m_unwritten.size() / RECORD_SIZE;
+        if (m_journalRecords + queued > 4 * m_pending.size() + 64) rewrite = true;
+
+        if (rewrite) {
+            // Holds every pending chapter's latest state, queued records included
+            out.assign(OUTBOX_MAGIC, 4);
+            out.reserve(4 + m_pending.size() * RECORD_SIZE);
+            for (const auto& pair : m_pending) {
+                char rec[RECORD_SIZE];
+                encodeRecord(rec, pair.first, pair.second.mangaId, pair.second.lastPageRead, pair.second.read);
+                out.append(rec, RECORD_SIZE);
+            }
+            records = m_pending.size();
+            m_unwritten.clear();
+        } else {
+            out.swap(m_unwritten);
+            records = queued;
+        }
+    }
+    if (!rewrite && out.empty()) return;
+
+    bool ok;
+    if (rewrite) {
+        // Write aside and rename so a crash keeps the previous journal
+        std::string path = getJournalPath();
+        std::string tmpPath = path + ".tmp";
+        ok = platform::writeFile(tmpPath, out) && platform::renameFile(tmpPath, path);
+    } else {
+        ok = platform::appendFile(getJournalPath(), out.data(), out.size());
+    }
+    if (!ok) {
+        brls::Logger::warning("MutationOutbox: Failed to {} journal", rewrite ? "rewrite" : "append to");
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_journalRecords = rewrite ? records : m_journalRecords + records;
+}
+
+void MutationOutbox::flushJournal() {
+    uint64_t timerId = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        timerId = m_journalTimer;
+    }
+    if (timerId != 0) TimerWheel::getInstance().cancel(timerId);
+    writeJournal(false);
+}
+
+void MutationOutbox::scheduleReplayLocked(int delayMs) {
+    // A running replay reschedules itself for whatever is left when it ends
+    if (m_replaying || m_replayTimer != 0) return;
+
+    m_replayTimer = TimerWheel::getInstance().schedule(delayMs, []() {
+        MutationOutbox::getInstance().replay();
+    }, TimerDispatch::WORKER);
+}
+
+void MutationOutbox::flush() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_replayTimer != 0) {
+        TimerWheel::getInstance().cancel(m_replayTimer);
+        m_replayTimer = 0;
+    }
+    m_backoffMs = 0;
+    if (!m_pending.empty()) scheduleReplayLocked(0);
+}
+
+size_t MutationOutbox::pendingCount() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_pending.size();
+}
+
+void MutationOutbox::replay() {
+    // Nothing goes out before it is in the journal
+    writeJournal(false);
+
+    std::vector<std::pair<int, Pending>> sent;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_replayTimer = 0;
+        if (m_replaying || m_pending.empty()) return;
+        // Waits for flush() from the reconnect paths
+        if (!Application::getInstance().isConnected()) return;
+        m_replaying = true;
+        sent.assign(m_pending.begin(), m_pending.end());
+    }
+
+    SuwayomiClient& client = SuwayomiClient::getInstance();
+    std::vector<std::pair<int, uint64_t>> acked;  // Chapter ID, version sent
+    std::vector<int> rejected;
+    bool reachable = false;
+
+    for (size_t start = 0; start < sent.size(); start += BATCH_SIZE) {
+        size_t end = std::min(sent.size(), start + BATCH_SIZE);
+
+        std::vector<ChapterPatch> patches;
+        for (size_t i = start; i < end; i++) {
+            ChapterPatch patch;
+            patch.chapterId = sent[i].first;
+            patch.lastPageRead = sent[i].second.lastPageRead;
+            patch.isRead = sent[i].second.read;
+            patches.push_back(patch);
+        }
+
+        if (client.applyChapterPatches(patches)) {
+            reachable = true;
+            for (size_t i = start; i < end; i++) acked.push_back({sent[i].first, sent[i].second.version});
+            continue;
+        }
+
+        // One rejected chapter fails the whole batch, so send these one by one
+        // through the regular calls (which also have REST fallbacks). Stop at
+        // the first failure if nothing has gone through yet: likely offline.
+        for (size_t i = start; i < end; i++) {
+            int chapterId = sent[i].first;
+            const Pending& entry = sent[i].second;
+            bool ok = true;
+            if (entry.lastPageRead >= 0) {
+                ok = client.updateChapterProgress(entry.mangaId, chapterId, entry.lastPageRead);
+            }
+            if (ok && entry.read >= 0) {
+                ok = entry.read ? client.markChapterRead(entry.mangaId, chapterId)
+                                : client.markChapterUnread(entry.mangaId, chapterId);
+            }
+            if (ok) {
+                reachable = true;
+                acked.push_back({chapterId, entry.version});
+            } else {
+                rejected.push_back(chapterId);
+                if (!reachable) break;
+            }
+        }
+        if (!reachable) break;
+    }
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_replaying = false;
+
+    bool changed = false;
+    for (const auto& ack : acked) {
+        auto it = m_pending.find(ack.first);
+        // A newer write queued during the replay stays for the next one
+        if (it != m_pending.end() && it->second.version == ack.second) {
+            m_pending.erase(it);
+            changed = true;
+        }
+    }
+    if (reachable) {
+        for (int chapterId : rejected) {
+            auto it = m_pending.find(chapterId);
+            if (it != m_pending.end() && ++it->second.failures >= MAX_FAILURES) {
+                brls::Logger::warning("MutationOutbox: Dropping write for chapter {} after {} rejections",
+                                      chapterId, MAX_FAILURES);
+                m_pending.erase(it);
+                changed = true;
+            }
+        }
+    }
+
+    brls::Logger::info("MutationOutbox: Replayed {}/{} chapter writes, {} pending",
+                       acked.size(), sent.size(), m_pending.size());
+
+    if (m_pending.empty()) {
+        m_backoffMs = 0;
+    } else if (acked.size() == sent.size()) {
+        // Only writes queued during the replay are left
+        m_backoffMs = 0;
+        scheduleReplayLocked(REPLAY_DELAY_MS);
+    } else {
+        m_backoffMs = m_backoffMs > 0 ? std::min(m_backoffMs * 2, MAX_BACKOFF_MS) : MIN_BACKOFF_MS;
+        scheduleReplayLocked(m_backoffMs);
+    }
+
+    if (changed) {
+        lock.unlock();
+        writeJournal(true);
+    }
+}
+
+} // namespace vitasuwayomi
@@ -4,8 +4,10 @@
 
 #include "app/suwayomi_client.hpp"
 #include "app/application.hpp"
+#include "app/endpoint_selector.hpp"
 #include "utils/http_client.hpp"
 #include "utils/image_loader.hpp"
+#include "utils/perf_trace.hpp"
 
 #include <borealis.hpp>
 #include <cstring>
@@ -24,6 +26,22 @@ SuwayomiClient& SuwayomiClient::getInstance() {
     return instance;
 }
 
+// Wraps a typed stale-data callback for cachedRequest, which deals in raw
+// bodies. No callback means no parse of the stale body.
+template<typename T, typename Parse>
+static std::function<void(const std::string&)> staleAdapter(const std::function<void(const T&)>& onStale,
+                                                           Parse parse) {
+    if (!onStale) return nullptr;
+    return [onStale, parse](const std::string& body) {
+        T cached;
+        if (parse(body, cached)) onStale(cached);
+    };
+}
+
+std::string SuwayomiClient::getServerIdentity() const {
+    return EndpointSelector::getInstance().serverIdentity(getServerUrl());
+}
+
 std::string SuwayomiClient::buildApiUrl(const std::string& endpoint) {
     std::lock_guard<std::recursive_mutex> lock(m_mutex);
     std::string url = m_serverUrl;
@@ -59,6 +77,7 @@ std::string SuwayomiClient::executeGraphQL(const std::string& query, const std::
 }
 
 std::string SuwayomiClient::executeGraphQLInternal(const std::string& query, const std::string& variables, bool allowRetry) {
+    PERF_TRACE_SCOPE("graphql_request");
     vitasuwayomi::HttpClient http = createHttpClient();
     http.setDefaultHeader("Content-Type", "application/json");
 
@@ -95,7 +114,21 @@ std::string SuwayomiClient::executeGraphQLInternal(const std::string& query, con
 
     brls::Logger::debug("GraphQL request to {}: {}", url, body.substr(0, 200));
 
+    uint64_t sentUs = PerfTrace::nowUs();
     vitasuwayomi::HttpResponse response = http.post(url, body);
+    m_apiRequests.fetch_add(1, std::memory_order_relaxed);
+
+    // Endpoint unreachable: retry once on the other server URL
+    if (!response.success && response.statusCode == 0) {
+        std::string alternateUrl = EndpointSelector::getInstance().failoverUrl(url);
+        if (!alternateUrl.empty()) {
+            brls::Logger::info("GraphQL: {} unreachable, retrying on {}", url, alternateUrl);
+            response = http.post(alternateUrl, body);
+            m_apiRequests.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    m_apiNetworkUs.fetch_add(PerfTrace::nowUs() - sentUs, std::memory_order_relaxed);
+    m_apiResponseBytes.fetch_add(response.body.size(), std::memory_order_relaxed);
 
     // Handle 401 Unauthorized - try to refresh token and retry
     if (response.statusCode == 401 && allowRetry) {
@@ -137,6 +170,114 @@ std::string SuwayomiClient::executeGraphQLInternal(const std::string& query, con
     return response.body;
 }
 
+std::string SuwayomiClient::cachedRequest(CachedOp op, const std::string& variables,
+                                          const std::function<std::string()>& fetch,
+                                          const std::function<void(const std::string&)>& onStale) {
+    std::string scope = getServerIdentity();
+
+    std::string cached;
+    ResponseCache::Freshness freshness = m_responseCache.lookup(op, scope, variables, cached);
+    if (freshness == ResponseCache::Freshness::FRESH) {
+        brls::Logger::debug("ResponseCache: {} hit", ResponseCache::policy(op).name);
+        return cached;
+    }
+    if (freshness == ResponseCache::Freshness::STALE && onStale) {
+        onStale(cached);
+    }
+
+    // A mutation finishing while the request is in flight makes its body stale
+    uint64_t generation = m_responseCache.generation(op);
+    std::string body = fetch();
+    if (!body.empty()) {
+        m_responseCache.store(op, scope, variables, body, generation);
+    }
+    return body;
+}
+
+void SuwayomiClient::clearResponseCache() {
+    m_responseCache.clear();
+}
+
+SuwayomiClient::ApiStats SuwayomiClient::getApiStats() const {
+    ApiStats stats;
+    stats.requests = m_apiRequests.load(std::memory_order_relaxed);
+    stats.responseBytes = m_apiResponseBytes.load(std::memory_order_relaxed);
+    stats.networkUs = m_apiNetworkUs.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void SuwayomiClient::resetApiStats() {
+    m_apiRequests.store(0, std::memory_order_relaxed);
+    m_apiResponseBytes.store(0, std::memory_order_relaxed);
+    m_apiNetworkUs.store(0, std::memory_order_relaxed);
+}
+
+// ============================================================================
+// Coalesced reads
+// ============================================================================
+
+// Screen transitions ask for the same data from several places at once (the
+// detail view and reader both preload chapters, the library loads categories
+// from several paths). These share one request per key via m_inFlight.
+
+bool SuwayomiClient::fetchManga(int mangaId, Manga& manga) {
+    return m_inFlight.run<Manga>("manga:" + std::to_string(mangaId), manga, [&](Manga& out) {
+        return fetchMangaInternal(mangaId, out);
+    });
+}
+
+bool SuwayomiClient::fetchMangaFull(int mangaId, Manga& manga,
+                                    const std::function<void(const Manga&)>& onStale) {
+    return m_inFlight.run<Manga>("mangaFull:" + std::to_string(mangaId), manga, [&](Manga& out) {
+        return fetchMangaFullInternal(mangaId, out, onStale);
+    });
+}
+
+bool SuwayomiClient::fetchChapters(int mangaId, std::vector<Chapter>& chapters) {
+    return m_inFlight.run<std::vector<Chapter>>("chapters:" + std::to_string(mangaId), chapters,
+                                                [&](std::vector<Chapter>& out) {
+        return fetchChaptersInternal(mangaId, out);
+    });
+}
+
+bool SuwayomiClient::fetchMangaWithChapters(int mangaId, Manga& manga, std::vector<Chapter>& chapters) {
+    using Combined = std::pair<Manga, std::vector<Chapter>>;
+    Combined result;
+    bool ok = m_inFlight.run<Combined>("mangaWithChapters:" + std::to_string(mangaId), result,
+                                       [&](Combined& out) {
+        return fetchMangaWithChaptersInternal(mangaId, out.first, out.second);
+    });
+    if (ok) {
+        manga = std::move(result.first);
+        chapters = std::move(result.second);
+    }
+    return ok;
+}
+
+bool SuwayomiClient::fetchChapterPages(int mangaId, int chapterId, std::vector<Page>& pages) {
+    return m_inFlight.run<std::vector<Page>>("pages:" + std::to_string(chapterId), pages,
+                                             [&](std::vector<Page>& out) {
+        return fetchChapterPagesInternal(mangaId, chapterId, out);
+    });
+}
+
+bool SuwayomiClient::fetchCategories(std::vector<Category>& categories,
+                                     const std::function<void(const std::vector<Category>&)>& onStale) {
+    // A caller that joins a running fetch gets the fresh list only, not the
+    // stale copy
+    return m_inFlight.run<std::vector<Category>>("categories", categories, [&](std::vector<Category>& out) {
+        return fetchCategoriesInternal(out, onStale);
+    });
+}
+
+bool SuwayomiClient::fetchCategoryManga(int categoryId, std::vector<Manga>& manga, MangaProjection projection) {
+    std::string key = "categoryManga:" + std::to_string(categoryId) + ":" +
+                      std::to_string(static_cast<int>(projection));
+    return m_inFlight.run<std::vector<Manga>>(key, manga, [&](std::vector<Manga>& out) {
+        return fetchCategoryMangaInternal(categoryId, out, projection);
+    });
+}
+
 // Helper for Base64 encoding
 static std::string base64Encode(const std::string& input) {
     static const char* b64chars = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
@@ -607,19 +748,27 @@ TrackRecord SuwayomiClient::parseTrackRecord(const std::string& json) {
 // GraphQL-specific parsers (field names differ from REST API)
 // ============================================================================
 
-Manga SuwayomiClient::parseMangaFromGraphQL(const std::string& json) {
+Manga SuwayomiClient::parseMangaFromGraphQL(const std::string& json, MangaProjection projection) {
     Manga manga;
 
     manga.id = extractJsonInt(json, "id");
     manga.title = extractJsonValue(json, "title");
     manga.thumbnailUrl = extractJsonValue(json, "thumbnailUrl");
-    manga.artist = extractJsonValue(json, "artist");
     manga.author = extractJsonValue(json, "author");
-    manga.description = extractJsonValue(json, "description");
     manga.inLibrary = extractJsonBool(json, "inLibrary");
+
+    // Each lookup scans the node, so don't look for fields the query left out
+    if (projection == MangaProjection::GRID) return manga;
+
+    manga.artist = extractJsonValue(json, "artist");
     manga.inLibraryAt = extractJsonInt64(json, "inLibraryAt");
-    manga.initialized = extractJsonBool(json, "initialized");
-    manga.url = extractJsonValue(json, "url");
+    manga.lastFetchedAt = extractJsonInt64(json, "lastFetchedAt");
+    manga.chaptersLastFetchedAt = extractJsonInt64(json, "chaptersLastFetchedAt");
+    if (projection == MangaProjection::DETAIL) {
+        manga.description = extractJsonValue(json, "description");
+        manga.initialized = extractJsonBool(json, "initialized");
+        manga.url = extractJsonValue(json, "url");
+    }
 
     // Parse status (GraphQL uses enum string)
     std::string statusStr = extractJsonValue(json, "status");
@@ -695,6 +844,7 @@ Chapter SuwayomiClient::parseChapterFromGraphQL(const std::string& json) {
     ch.pageCount = extractJsonInt(json, "pageCount");
     ch.lastPageRead = extractJsonInt(json, "lastPageRead");
     ch.lastReadAt = extractJsonInt64(json, "lastReadAt");
+    ch.fetchedAt = extractJsonInt64(json, "fetchedAt");  // LongString, seconds
     ch.index = extractJsonInt(json, "sourceOrder");
 
     // GraphQL uses isRead, isDownloaded, isBookmarked
@@ -780,7 +930,8 @@ bool SuwayomiClient::fetchServerInfoGraphQL(ServerInfo& info) {
     return true;
 }
 
-bool SuwayomiClient::fetchSourceListGraphQL(std::vector<Source>& sources) {
+bool SuwayomiClient::fetchSourceListGraphQL(std::vector<Source>& sources,
+                                            const std::function<void(const std::vector<Source>&)>& onStale) {
     const char* query = R"(
         query {
             sources {
@@ -798,7 +949,18 @@ bool SuwayomiClient::fetchSourceListGraphQL(std::vector<Source>& sources) {
         }
     )";
 
-    std::string response = executeGraphQL(query);
+    std::string response = cachedRequest(CachedOp::SOURCES, "", [&]() {
+        return executeGraphQL(query);
+    }, staleAdapter<std::vector<Source>>(onStale, [this](const std::string& body, std::vector<Source>& out) {
+        return parseSourceListResponse(body, out);
+    }));
+    if (!parseSourceListResponse(response, sources)) return false;
+
+    brls::Logger::debug("GraphQL: Fetched {} sources", sources.size());
+    return true;
+}
+
+bool SuwayomiClient::parseSourceListResponse(const std::string& response, std::vector<Source>& sources) {
     if (response.empty()) return false;
 
     std::string data = extractJsonObject(response, "data");
@@ -815,29 +977,71 @@ bool SuwayomiClient::fetchSourceListGraphQL(std::vector<Source>& sources) {
     for (const auto& item : items) {
         sources.push_back(parseSourceFromGraphQL(item));
     }
-
-    brls::Logger::debug("GraphQL: Fetched {} sources", sources.size());
     return true;
 }
 
+// Field sets behind MangaProjection, as a MangaFields fragment that list
+// queries spread into their manga selection
+static std::string mangaFragment(MangaProjection projection) {
+    std::string fields = R"(
+        id
+        title
+        thumbnailUrl
+        author
+        inLibrary
+    )";
+    if (projection != MangaProjection::GRID) {
+        fields += R"(
+        artist
+        genre
+        status
+        inLibraryAt
+        lastFetchedAt
+        chaptersLastFetchedAt
+        unreadCount
+        downloadCount
+        source {
+            displayName
+        }
+        chapters {
+            totalCount
+        }
+        lastReadChapter {
+            lastReadAt
+        }
+        latestUploadedChapter {
+            uploadDate
+        }
+        categories {
+            nodes {
+                id
+            }
+        }
+    )";
+    }
+    if (projection == MangaProjection::DETAIL) {
+        fields += R"(
+        description
+        url
+        initialized
+    )";
+    }
+    return "\n    fragment MangaFields on MangaType {" + fields + "}\n";
+}
+
 bool SuwayomiClient::fetchPopularMangaGraphQL(int64_t sourceId, int page,
-                                               std::vector<Manga>& manga, bool& hasNextPage) {
-    const char* query = R"(
+                                               std::vector<Manga>& manga, bool& hasNextPage,
+                                               MangaProjection projection) {
+    std::string query = std::string(R"(
         mutation GetPopular($sourceId: LongString!, $page: Int!) {
             fetchSourceManga(input: { source: $sourceId, type: POPULAR, page: $page }) {
                 mangas {
-                    id
-                    title
-                    thumbnailUrl
-                    author
-                    artist
-                    description
-                    inLibrary
+                    ...MangaFields
                 }
                 hasNextPage
             }
         }
-    )";
+    )") + mangaFragment(projection);
 
     std::string variables = "{\"sourceId\":\"" + std::to_string(sourceId) + "\",\"page\":" + std::to_string(page) + "}";
 
@@ -856,7 +1060,7 @@ bool SuwayomiClient::fetchPopularMangaGraphQL(int64_t sourceId, int page,
     manga.clear();
     std::vector<std::string> items = splitJsonArray(mangasJson);
     for (const auto& item : items) {
-        manga.push_back(parseMangaFromGraphQL(item));
+        manga.push_back(parseMangaFromGraphQL(item, projection));
     }
 
     brls::Logger::debug("GraphQL: Fetched {} popular manga (hasNext: {})", manga.size(), hasNextPage);
@@ -864,23 +1068,18 @@ bool SuwayomiClient::fetchPopularMangaGraphQL(int64_t sourceId, int page,
 }
 
 bool SuwayomiClient::fetchLatestMangaGraphQL(int64_t sourceId, int page,
-                                              std::vector<Manga>& manga, bool& hasNextPage) {
-    const char* query = R"(
+                                              std::vector<Manga>& manga, bool& hasNextPage,
+                                              MangaProjection projection) {
+    std::string query = std::string(R"(
         mutation GetLatest($sourceId: LongString!, $page: Int!) {
             fetchSourceManga(input: { source: $sourceId, type: LATEST, page: $page }) {
                 mangas {
-                    id
-                    title
-                    thumbnailUrl
-                    author
-                    artist
-                    description
-                    inLibrary
+                    ...MangaFields
                 }
                 hasNextPage
             }
         }
-    )";
+    )") + mangaFragment(projection);
 
     std::string variables = "{\"sourceId\":\"" + std::to_string(sourceId) + "\",\"page\":" + std::to_string(page) + "}";
 
@@ -899,7 +1098,7 @@ bool SuwayomiClient::fetchLatestMangaGraphQL(int64_t sourceId, int page,
     manga.clear();
     std::vector<std::string> items = splitJsonArray(mangasJson);
     for (const auto& item : items) {
-        manga.push_back(parseMangaFromGraphQL(item));
+        manga.push_back(parseMangaFromGraphQL(item, projection));
     }
 
     brls::Logger::debug("GraphQL: Fetched {} latest manga (hasNext: {})", manga.size(), hasNextPage);
@@ -907,23 +1106,18 @@ bool SuwayomiClient::fetchLatestMangaGraphQL(int64_t sourceId, int page,
 }
 
 bool SuwayomiClient::searchMangaGraphQL(int64_t sourceId, const std::string& searchQuery, int page,
-                                         std::vector<Manga>& manga, bool& hasNextPage) {
-    const char* query = R"(
+                                         std::vector<Manga>& manga, bool& hasNextPage,
+                                         MangaProjection projection) {
+    std::string query = std::string(R"(
         mutation SearchSource($sourceId: LongString!, $searchTerm: String!, $page: Int!) {
             fetchSourceManga(input: { source: $sourceId, type: SEARCH, query: $searchTerm, page: $page }) {
                 mangas {
-                    id
-                    title
-                    thumbnailUrl
-                    author
-                    artist
-                    description
-                    inLibrary
+                    ...MangaFields
                 }
                 hasNextPage
             }
         }
-    )";
+    )") + mangaFragment(projection);
 
     // Escape the search query for JSON
     std::string escapedQuery;
@@ -954,15 +1148,16 @@ bool SuwayomiClient::searchMangaGraphQL(int64_t sourceId, const std::string& sea
     manga.clear();
     std::vector<std::string> items = splitJsonArray(mangasJson);
     for (const auto& item : items) {
-        manga.push_back(parseMangaFromGraphQL(item));
+        manga.push_back(parseMangaFromGraphQL(item, projection));
     }
 
     brls::Logger::debug("GraphQL: Searched {} manga (hasNext: {})", manga.size(), hasNextPage);
     return true;
 }
 
-bool SuwayomiClient::fetchLibraryMangaGraphQL(std::vector<Manga>& manga) {
-    const char* query = R"(
+bool SuwayomiClient::fetchLibraryMangaGraphQL(std::vector<Manga>& manga, MangaProjection projection) {
+    PERF_TRACE_SCOPE("fetch_library");
+    std::string query = std::string(R"(
         query GetLibraryManga {
             mangas(
                 condition: { inLibrary: true }
@@ -970,39 +1165,12 @@ bool SuwayomiClient::fetchLibraryMangaGraphQL(std::vector<Manga>& manga) {
                 order: [{ by: TITLE }]
             ) {
                 nodes {
-                    id
-                    title
-                    thumbnailUrl
-                    author
-                    artist
-                    description
-                    genre
-                    status
-                    inLibrary
-                    inLibraryAt
-                    unreadCount
-                    lastReadChapter {
-                        lastReadAt
-                    }
-                    chapters {
-                        totalCount
-                    }
-                    latestUploadedChapter {
-                        uploadDate
-                    }
-                    source {
-                        displayName
-                    }
-                    categories {
-                        nodes {
-                            id
-                        }
-                    }
+                    ...MangaFields
                 }
                 totalCount
             }
         }
-    )";
+    )") + mangaFragment(projection);
 
     std::string response = executeGraphQL(query);
     if (response.empty()) return false;
@@ -1017,14 +1185,15 @@ bool SuwayomiClient::fetchLibraryMangaGraphQL(std::vector<Manga>& manga) {
     manga.clear();
     std::vector<std::string> items = splitJsonArray(nodesJson);
     for (const auto& item : items) {
-        manga.push_back(parseMangaFromGraphQL(item));
+        manga.push_back(parseMangaFromGraphQL(item, projection));
     }
 
     brls::Logger::debug("GraphQL: Fetched {} library manga", manga.size());
     return true;
 }
 
-bool SuwayomiClient::fetchCategoriesGraphQL(std::vector<Category>& categories) {
+bool SuwayomiClient::fetchCategoriesGraphQL(std::vector<Category>& categories,
+                                            const std::function<void(const std::vector<Category>&)>& onStale) {
     const char* query = R"(
         query {
             categories {
@@ -1040,7 +1209,18 @@ bool SuwayomiClient::fetchCategoriesGraphQL(std::vector<Category>& categories) {
         }
     )";
 
-    std::string response = executeGraphQL(query);
+    std::string response = cachedRequest(CachedOp::CATEGORIES, "", [&]() {
+        return executeGraphQL(query);
+    }, staleAdapter<std::vector<Category>>(onStale, [this](const std::string& body, std::vector<Category>& out) {
+        return parseCategoriesResponse(body, out);
+    }));
+    if (!parseCategoriesResponse(response, categories)) return false;
+
+    brls::Logger::debug("GraphQL: Fetched {} categories", categories.size());
+    return true;
+}
+
+bool SuwayomiClient::parseCategoriesResponse(const std::string& response, std::vector<Category>& categories) {
     if (response.empty()) return false;
 
     std::string data = extractJsonObject(response, "data");
@@ -1055,12 +1235,11 @@ bool SuwayomiClient::fetchCategoriesGraphQL(std::vector<Category>& categories) {
     for (const auto& item : items) {
         categories.push_back(parseCategoryFromGraphQL(item));
     }
-
-    brls::Logger::debug("GraphQL: Fetched {} categories", categories.size());
     return true;
 }
 
 bool SuwayomiClient::fetchChaptersGraphQL(int mangaId, std::vector<Chapter>& chapters) {
+    PERF_TRACE_SCOPE("fetch_chapters");
     const char* query = R"(
         query GetChapters($mangaId: Int!) {
             chapters(
@@ -1080,6 +1259,7 @@ bool SuwayomiClient::fetchChaptersGraphQL(int mangaId, std::vector<Chapter>& cha
                     pageCount
                     lastPageRead
                     lastReadAt
+                    fetchedAt
                     sourceOrder
                 }
                 totalCount
@@ -1112,26 +1292,13 @@ bool SuwayomiClient::fetchChaptersGraphQL(int mangaId, std::vector<Chapter>& cha
 }
 
 bool SuwayomiClient::fetchMangaGraphQL(int mangaId, Manga& manga) {
-    const char* query = R"(
+    std::string query = std::string(R"(
         query GetManga($id: Int!) {
             manga(id: $id) {
-                id
-                title
-                thumbnailUrl
-                author
-                artist
-                description
-                genre
-                status
-                url
-                inLibrary
-                initialized
-                source {
-                    displayName
-                }
+                ...MangaFields
             }
         }
-    )";
+    )") + mangaFragment(MangaProjection::DETAIL);
 
     std::string variables = "{\"id\":" + std::to_string(mangaId) + "}";
 
@@ -1261,6 +1428,7 @@ bool SuwayomiClient::updateChapterProgressGraphQL(int chapterId, int lastPageRea
 }
 
 bool SuwayomiClient::fetchChapterPagesGraphQL(int chapterId, std::vector<Page>& pages) {
+    PERF_TRACE_SCOPE("fetch_pages");
     brls::Logger::info("GraphQL: Fetching pages for chapter id={}", chapterId);
 
     const char* query = R"(
@@ -1390,20 +1558,16 @@ bool SuwayomiClient::fetchReadingHistoryGraphQL(int offset, int limit, std::vect
 }
 
 bool SuwayomiClient::globalSearchGraphQL(const std::string& query, std::vector<GlobalSearchResult>& results) {
-    const char* gqlQuery = R"(
+    std::string gqlQuery = std::string(R"(
         mutation GlobalSearch($searchTerm: String!) {
             fetchSourceManga(input: { type: SEARCH, query: $searchTerm }) {
                 mangas {
-                    id
-                    title
-                    thumbnailUrl
-                    author
-                    inLibrary
+                    ...MangaFields
                 }
                 hasNextPage
             }
         }
-    )";
+    )") + mangaFragment(MangaProjection::GRID);
 
     // Escape the search query for JSON
     std::string escapedQuery;
@@ -1433,7 +1597,7 @@ bool SuwayomiClient::globalSearchGraphQL(const std::string& query, std::vector<G
     std::string mangasJson = extractJsonArray(fetchResult, "mangas");
     std::vector<std::string> items = splitJsonArray(mangasJson);
     for (const auto& item : items) {
-        result.manga.push_back(parseMangaFromGraphQL(item));
+        result.manga.push_back(parseMangaFromGraphQL(item, MangaProjection::GRID));
     }
 
     if (!result.manga.empty()) {
@@ -1632,6 +1796,7 @@ bool SuwayomiClient::fetchMangaMeta(int mangaId, std::map<std::string, std::stri
 }
 
 bool SuwayomiClient::setMangaMeta(int mangaId, const std::string& key, const std::string& value) {
+    ResponseCache::InvalidateOnExit invalidateManga(m_responseCache, CachedOp::MANGA_FULL);
     // Try GraphQL first
     if (setMangaMetaGraphQL(mangaId, key, value)) {
         return true;
@@ -1656,6 +1821,7 @@ bool SuwayomiClient::setMangaMeta(int mangaId, const std::string& key, const std
 }
 
 bool SuwayomiClient::deleteMangaMeta(int mangaId, const std::string& key) {
+    ResponseCache::InvalidateOnExit invalidateManga(m_responseCache, CachedOp::MANGA_FULL);
     // Try GraphQL first
     if (deleteMangaMetaGraphQL(mangaId, key)) {
         return true;
@@ -1667,10 +1833,11 @@ bool SuwayomiClient::deleteMangaMeta(int mangaId, const std::string& key) {
     return false;
 }
 
-bool SuwayomiClient::fetchCategoryMangaGraphQL(int categoryId, std::vector<Manga>& manga) {
+bool SuwayomiClient::fetchCategoryMangaGraphQL(int categoryId, std::vector<Manga>& manga,
+                                               MangaProjection projection) {
     // Use mangas query with categoryId filter - this correctly filters manga by category
     // The category(id).mangas approach returns ALL library manga unfiltered
-    const char* query = R"(
+    std::string query = std::string(R"(
         query GetMangasByCategory($categoryId: Int!) {
             mangas(
                 filter: {
@@ -1679,39 +1846,11 @@ bool SuwayomiClient::fetchCategoryMangaGraphQL(int categoryId, std::vector<Manga
                 }
             ) {
                 nodes {
-                    id
-                    title
-                    thumbnailUrl
-                    author
-                    artist
-                    description
-                    genre
-                    status
-                    inLibrary
-                    inLibraryAt
-                    unreadCount
-                    downloadCount
-                    source {
-                        displayName
-                    }
-                    chapters {
-                        totalCount
-                    }
-                    lastReadChapter {
-                        lastReadAt
-                    }
-                    latestUploadedChapter {
-                        uploadDate
-                    }
-                    categories {
-                        nodes {
-                            id
-                        }
-                    }
+                    ...MangaFields
                 }
             }
         }
-    )";
+    )") + mangaFragment(projection);
 
     std::string variables = "{\"categoryId\":" + std::to_string(categoryId) + "}";
 
@@ -1720,26 +1859,26 @@ bool SuwayomiClient::fetchCategoryMangaGraphQL(int categoryId, std::vector<Manga
     std::string response = executeGraphQL(query, variables);
     if (response.empty()) {
         brls::Logger::warning("GraphQL filter query failed, trying fallback...");
-        return fetchCategoryMangaGraphQLFallback(categoryId, manga);
+        return fetchCategoryMangaGraphQLFallback(categoryId, manga, projection);
     }
 
     std::string data = extractJsonObject(response, "data");
     if (data.empty()) {
         brls::Logger::warning("GraphQL: No data in response, trying fallback...");
-        return fetchCategoryMangaGraphQLFallback(categoryId, manga);
+        return fetchCategoryMangaGraphQLFallback(categoryId, manga, projection);
     }
 
     std::string mangasObj = extractJsonObject(data, "mangas");
     if (mangasObj.empty()) {
         brls::Logger::warning("GraphQL: No mangas object, trying fallback...");
-        return fetchCategoryMangaGraphQLFallback(categoryId, manga);
+        return fetchCategoryMangaGraphQLFallback(categoryId, manga, projection);
     }
 
     std::string nodesJson = extractJsonArray(mangasObj, "nodes");
     manga.clear();
     std::vector<std::string> items = splitJsonArray(nodesJson);
     for (const auto& item : items) {
-        manga.push_back(parseMangaFromGraphQL(item));
+        manga.push_back(parseMangaFromGraphQL(item, projection));
     }
 
     // If filter returned 0 results for the default category (id=0),
@@ -1747,7 +1886,7 @@ bool SuwayomiClient::fetchCategoryMangaGraphQL(int categoryId, std::vector<Manga
     // Fall back to category(id) query which works for the default category.
     if (manga.empty() && categoryId == 0) {
         brls::Logger::info("GraphQL: Filter returned 0 for default category, trying fallback...");
-        return fetchCategoryMangaGraphQLFallback(categoryId, manga);
+        return fetchCategoryMangaGraphQLFallback(categoryId, manga, projection);
     }
 
     brls::Logger::info("GraphQL: Fetched {} manga for category {} (filter method)", manga.size(), categoryId);
@@ -1756,48 +1895,21 @@ bool SuwayomiClient::fetchCategoryMangaGraphQL(int categoryId, std::vector<Manga
 
 // Fallback method using category(id).mangas query
 // Only reliable for the default category (id=0); for other categories this may return all library manga
-bool SuwayomiClient::fetchCategoryMangaGraphQLFallback(int categoryId, std::vector<Manga>& manga) {
-    const char* query = R"(
+bool SuwayomiClient::fetchCategoryMangaGraphQLFallback(int categoryId, std::vector<Manga>& manga,
+                                                       MangaProjection projection) {
+    std::string query = std::string(R"(
         query GetCategoryManga($categoryId: Int!) {
             category(id: $categoryId) {
                 id
                 name
                 mangas {
                     nodes {
-                        id
-                        title
-                        thumbnailUrl
-                        author
-                        artist
-                        description
-                        genre
-                        status
-                        inLibrary
-                        inLibraryAt
-                        unreadCount
-                        downloadCount
-                        source {
-                            displayName
-                        }
-                        chapters {
-                            totalCount
-                        }
-                        lastReadChapter {
-                            lastReadAt
-                        }
-                        latestUploadedChapter {
-                            uploadDate
-                        }
-                        categories {
-                            nodes {
-                                id
-                            }
-                        }
+                        ...MangaFields
                     }
                 }
             }
         }
-    )";
+    )") + mangaFragment(projection);
 
     std::string variables = "{\"categoryId\":" + std::to_string(categoryId) + "}";
 
@@ -1817,7 +1929,7 @@ bool SuwayomiClient::fetchCategoryMangaGraphQLFallback(int categoryId, std::vect
     manga.clear();
     std::vector<std::string> items = splitJsonArray(nodesJson);
     for (const auto& item : items) {
-        manga.push_back(parseMangaFromGraphQL(item));
+        manga.push_back(parseMangaFromGraphQL(item, projection));
     }
 
     brls::Logger::info("GraphQL fallback: Fetched {} manga for category {}", manga.size(), categoryId);
@@ -1828,8 +1940,163 @@ bool SuwayomiClient::fetchCategoryMangaGraphQLFallback(int categoryId, std::vect
 // Combined/Parallel GraphQL queries
 // ============================================================================
 
+// Timestamps are seconds on some server fields and milliseconds on others.
+// Re-read about a minute before the watermark either way so writes that
+// landed out of order around it are not missed.
+static int64_t rewindWatermark(int64_t value) {
+    int64_t overlap = value > 100000000000LL ? 60000 : 60;
+    return value > overlap ? value - overlap : 0;
+}
+
+LibrarySyncWatermark LibrarySyncWatermark::fromManga(const std::vector<Manga>& manga) {
+    LibrarySyncWatermark mark;
+    for (const auto& m : manga) {
+        mark.fetchedAt = std::max({mark.fetchedAt, m.lastFetchedAt, m.chaptersLastFetchedAt});
+        mark.lastReadAt = std::max(mark.lastReadAt, m.lastReadAt);
+    }
+    return mark;
+}
+
+bool SuwayomiClient::fetchCategoryMangaDelta(int categoryId, const LibrarySyncWatermark& since,
+                                             const std::vector<int>& knownIds, CategoryMangaDelta& delta) {
+    if (!since.isValid()) return false;
+
+    // One round trip for membership, manga refreshed since the watermark and
+    // chapters read since it (reading changes unreadCount but no manga timestamp).
+    // Reads are limited to the manga the caller has; new members are fetched
+    // in full below anyway.
+    std::string query = std::string(R"(
+        query CategoryMangaDelta($categoryId: Int!, $fetchedSince: LongString!, $readSince: LongString!,
+                                 $knownIds: [Int!]!) {
+            members: mangas(
+                filter: {
+                    inLibrary: { equalTo: true }
+                    categoryId: { equalTo: $categoryId }
+                }
+            ) {
+                nodes {
+                    id
+                }
+            }
+            changed: mangas(
+                filter: {
+                    inLibrary: { equalTo: true }
+                    categoryId: { equalTo: $categoryId }
+                    or: [
+                        { lastFetchedAt: { greaterThan: $fetchedSince } }
+                        { chaptersLastFetchedAt: { greaterThan: $fetchedSince } }
+                    ]
+                }
+            ) {
+                nodes {
+                    ...MangaFields
+                }
+            }
+            reads: chapters(
+                filter: {
+                    mangaId: { in: $knownIds }
+                    lastReadAt: { greaterThan: $readSince }
+                }
+            ) {
+                nodes {
+                    mangaId
+                    lastReadAt
+                }
+            }
+        }
+    )") + mangaFragment(MangaProjection::LIST);
+
+    std::string knownIdList;
+    for (int id : knownIds) {
+        if (!knownIdList.empty()) knownIdList += ",";
+        knownIdList += std::to_string(id);
+    }
+    std::string variables = "{\"categoryId\":" + std::to_string(categoryId) +
+                            ",\"fetchedSince\":\"" + std::to_string(rewindWatermark(since.fetchedAt)) +
+                            "\",\"readSince\":\"" + std::to_string(rewindWatermark(since.lastReadAt)) +
+                            "\",\"knownIds\":[" + knownIdList + "]}";
+
+    std::string response = executeGraphQL(query, variables);
+    if (response.empty()) return false;
+
+    std::string data = extractJsonObject(response, "data");
+    std::string membersObj = extractJsonObject(data, "members");
+    std::string changedObj = extractJsonObject(data, "changed");
+    if (membersObj.empty() || changedObj.empty()) return false;
+
+    delta.memberIds.clear();
+    delta.changed.clear();
+    delta.watermark = since;
+
+    std::set<int> members;
+    for (const auto& item : splitJsonArray(extractJsonArray(membersObj, "nodes"))) {
+        int id = extractJsonInt(item, "id");
+        if (id > 0 && members.insert(id).second) delta.memberIds.push_back(id);
+    }
+
+    // Same quirk as fetchCategoryMangaGraphQL: the default category may not
+    // filter by categoryId. Let a full fetch decide whether it is really empty.
+    if (delta.memberIds.empty() && !knownIds.empty()) return false;
+
+    std::set<int> have;
+    for (const auto& item : splitJsonArray(extractJsonArray(changedObj, "nodes"))) {
+        Manga m = parseMangaFromGraphQL(item, MangaProjection::LIST);
+        have.insert(m.id);
+        delta.changed.push_back(std::move(m));
+    }
+
+    // Members the caller lacks, plus members read since the watermark, are
+    // fetched in full by ID
+    std::set<int> known(knownIds.begin(), knownIds.end());
+    std::set<int> wanted;
+    for (int id : delta.memberIds) {
+        if (!known.count(id) && !have.count(id)) wanted.insert(id);
+    }
+    std::string readsObj = extractJsonObject(data, "reads");
+    for (const auto& item : splitJsonArray(extractJsonArray(readsObj, "nodes"))) {
+        int mangaId = extractJsonInt(item, "mangaId");
+        delta.watermark.lastReadAt = std::max(delta.watermark.lastReadAt,
+                                              extractJsonInt64(item, "lastReadAt"));
+        if (members.count(mangaId) && !have.count(mangaId)) wanted.insert(mangaId);
+    }
+
+    if (!wanted.empty()) {
+        std::string byIdQuery = std::string(R"(
+            query LibraryMangaByIds($ids: [Int!]!) {
+                mangas(filter: { id: { in: $ids } }) {
+                    nodes {
+                        ...MangaFields
+                    }
+                }
+            }
+        )") + mangaFragment(MangaProjection::LIST);
+
+        std::string ids;
+        for (int id : wanted) {
+            if (!ids.empty()) ids += ",";
+            ids += std::to_string(id);
+        }
+
+        std::string byIdResponse = executeGraphQL(byIdQuery, "{\"ids\":[" + ids + "]}");
+        std::string byIdMangas = extractJsonObject(extractJsonObject(byIdResponse, "data"), "mangas");
+        if (byIdMangas.empty()) return false;
+
+        for (const auto& item : splitJsonArray(extractJsonArray(byIdMangas, "nodes"))) {
+            delta.changed.push_back(parseMangaFromGraphQL(item, MangaProjection::LIST));
+        }
+    }
+
+    LibrarySyncWatermark seen = LibrarySyncWatermark::fromManga(delta.changed);
+    delta.watermark.fetchedAt = std::max(delta.watermark.fetchedAt, seen.fetchedAt);
+    delta.watermark.lastReadAt = std::max(delta.watermark.lastReadAt, seen.lastReadAt);
+
+    brls::Logger::info("GraphQL: Delta for category {}: {} members, {} changed ({} by ID)",
+                       categoryId, delta.memberIds.size(), delta.changed.size(), wanted.size());
+    return true;
+}
+
 bool SuwayomiClient::fetchCategoriesWithMangaGraphQL(std::vector<Category>& categories, int categoryId, std::vector<Manga>& manga) {
-    const char* query = R"(
+    std::string query = std::string(R"(
         query GetCategoriesAndManga($categoryId: Int!) {
             categories {
                 nodes {
@@ -1848,39 +2115,11 @@ bool SuwayomiClient::fetchCategoriesWithMangaGraphQL(std::vector<Category>& cate
                 }
             ) {
                 nodes {
-                    id
-                    title
-                    thumbnailUrl
-                    author
-                    artist
-                    description
-                    genre
-                    status
-                    inLibrary
-                    inLibraryAt
-                    unreadCount
-                    downloadCount
-                    source {
-                        displayName
-                    }
-                    chapters {
-                        totalCount
-                    }
-                    lastReadChapter {
-                        lastReadAt
-                    }
-                    latestUploadedChapter {
-                        uploadDate
-                    }
-                    categories {
-                        nodes {
-                            id
-                        }
-                    }
+                    ...MangaFields
                 }
             }
         }
-    )";
+    )") + mangaFragment(MangaProjection::LIST);
 
     std::string variables = "{\"categoryId\":" + std::to_string(categoryId) + "}";
     brls::Logger::info("GraphQL: Fetching categories + manga for category {} in single request", categoryId);
@@ -1910,7 +2149,7 @@ bool SuwayomiClient::fetchCategoriesWithMangaGraphQL(std::vector<Category>& cate
         manga.clear();
         std::vector<std::string> items = splitJsonArray(nodesJson);
         for (const auto& item : items) {
-            manga.push_back(parseMangaFromGraphQL(item));
+            manga.push_back(parseMangaFromGraphQL(item, MangaProjection::LIST));
         }
         brls::Logger::debug("GraphQL combined: Fetched {} manga for category {}", manga.size(), categoryId);
     }
@@ -1968,6 +2207,7 @@ bool SuwayomiClient::fetchMangaWithChaptersGraphQL(int mangaId, Manga& manga, st
                     pageCount
                     lastPageRead
                     lastReadAt
+                    fetchedAt
                     sourceOrder
                 }
                 totalCount
@@ -2053,7 +2293,7 @@ bool SuwayomiClient::fetchMangaWithChaptersGraphQL(int mangaId, Manga& manga, st
     return manga.id > 0;
 }
 
-bool SuwayomiClient::fetchMangaWithChapters(int mangaId, Manga& manga, std::vector<Chapter>& chapters) {
+bool SuwayomiClient::fetchMangaWithChaptersInternal(int mangaId, Manga& manga, std::vector<Chapter>& chapters) {
     if (fetchMangaWithChaptersGraphQL(mangaId, manga, chapters)) {
         return true;
     }
@@ -2070,14 +2310,14 @@ bool SuwayomiClient::fetchMangaWithChapters(int mangaId, Manga& manga, std::vect
 // ============================================================================
 
 bool SuwayomiClient::connectToServer(const std::string& url) {
-    m_serverUrl = url;
-
     // Remove trailing slash
-    while (!m_serverUrl.empty() && m_serverUrl.back() == '/') {
-        m_serverUrl.pop_back();
+    std::string base = url;
+    while (!base.empty() && base.back() == '/') {
+        base.pop_back();
     }
+    setServerUrl(base);
 
-    brls::Logger::info("Connecting to Suwayomi server: {}", m_serverUrl);
+    brls::Logger::info("Connecting to Suwayomi server: {}", base);
 
     // Test connection by fetching server info
     ServerInfo info;
@@ -2092,8 +2332,9 @@ bool SuwayomiClient::connectToServer(const std::string& url) {
     Application& app = Application::getInstance();
     if (app.tryAlternateUrl()) {
         // Successfully switched to alternate URL, update our server URL
-        m_serverUrl = app.getActiveServerUrl();
-        brls::Logger::info("Auto-switched to: {}", m_serverUrl);
+        std::string switched = app.getActiveServerUrl();
+        setServerUrl(switched);
+        brls::Logger::info("Auto-switched to: {}", switched);
 
         // Try connection with new URL
         if (fetchServerInfo(info)) {
@@ -2281,9 +2522,10 @@ bool SuwayomiClient::fetchServerInfo(ServerInfo& info) {
     // REST fallback
     brls::Logger::info("GraphQL failed, falling back to REST API...");
     vitasuwayomi::HttpClient http = createHttpClient();
+    std::string serverUrl = getServerUrl();
 
     // Try /api/v1/settings/about endpoint (standard Suwayomi endpoint)
-    std::string url = m_serverUrl + "/api/v1/settings/about";
+    std::string url = serverUrl + "/api/v1/settings/about";
     brls::Logger::info("Fetching server info from: {}", url);
     vitasuwayomi::HttpResponse response = http.get(url);
 
@@ -2291,7 +2533,7 @@ bool SuwayomiClient::fetchServerInfo(ServerInfo& info) {
         brls::Logger::warning("REST about endpoint failed ({}), trying source list...", response.statusCode);
 
         // Fallback: Try to fetch source list as connection test
-        url = m_serverUrl + "/api/v1/source/list";
+        url = serverUrl + "/api/v1/source/list";
         response = http.get(url);
 
         if (!response.success || response.statusCode != 200) {
@@ -2426,6 +2668,8 @@ void SuwayomiClient::logout() {
     // Clear ImageLoader auth state
     ImageLoader::setAccessToken("");
     ImageLoader::setSessionCookie("");
+    // Cached responses belong to the session being ended
+    m_responseCache.clear();
     // Keep username/password for re-login if needed
 }
 
@@ -2578,7 +2822,7 @@ bool SuwayomiClient::loginSimpleREST(const std::string& username, const std::str
         http.setTimeout(timeout);
     }
 
-    std::string url = m_serverUrl + "/login.html";
+    std::string url = getServerUrl() + "/login.html";
 
     // Build form-encoded body with server's expected param names
     std::string body = "user=" + vitasuwayomi::HttpClient::urlEncode(username) +
@@ -2801,6 +3045,8 @@ bool SuwayomiClient::fetchExtensionList(std::vector<Extension>& extensions) {
 }
 
 bool SuwayomiClient::installExtension(const std::string& pkgName) {
+    ResponseCache::InvalidateOnExit invalidateSources(m_responseCache, CachedOp::SOURCES);
+    ResponseCache::InvalidateOnExit invalidateFilters(m_responseCache, CachedOp::SOURCE_FILTERS);
     const int maxRetries = 3;
 
     for (int attempt = 1; attempt <= maxRetries; attempt++) {
@@ -2834,6 +3080,8 @@ bool SuwayomiClient::installExtension(const std::string& pkgName) {
 }
 
 bool SuwayomiClient::updateExtension(const std::string& pkgName) {
+    ResponseCache::InvalidateOnExit invalidateSources(m_responseCache, CachedOp::SOURCES);
+    ResponseCache::InvalidateOnExit invalidateFilters(m_responseCache, CachedOp::SOURCE_FILTERS);
     const int maxRetries = 3;
 
     for (int attempt = 1; attempt <= maxRetries; attempt++) {
@@ -2867,6 +3115,8 @@ bool SuwayomiClient::updateExtension(const std::string& pkgName) {
 }
 
 bool SuwayomiClient::uninstallExtension(const std::string& pkgName) {
+    ResponseCache::InvalidateOnExit invalidateSources(m_responseCache, CachedOp::SOURCES);
+    ResponseCache::InvalidateOnExit invalidateFilters(m_responseCache, CachedOp::SOURCE_FILTERS);
     const int maxRetries = 3;
 
     for (int attempt = 1; attempt <= maxRetries; attempt++) {
@@ -3203,9 +3453,10 @@ bool SuwayomiClient::triggerSync(std::string& result) {
 // Source Management
 // ============================================================================
 
-bool SuwayomiClient::fetchSourceList(std::vector<Source>& sources) {
+bool SuwayomiClient::fetchSourceList(std::vector<Source>& sources,
+                                     const std::function<void(const std::vector<Source>&)>& onStale) {
     // Try GraphQL first (primary API)
-    if (fetchSourceListGraphQL(sources)) {
+    if (fetchSourceListGraphQL(sources, onStale)) {
         return true;
     }
 
@@ -3252,9 +3503,10 @@ bool SuwayomiClient::fetchSource(int64_t sourceId, Source& source) {
     return true;
 }
 
-bool SuwayomiClient::fetchSourceFilters(int64_t sourceId, std::vector<SourceFilter>& filters) {
+bool SuwayomiClient::fetchSourceFilters(int64_t sourceId, std::vector<SourceFilter>& filters,
+                                        const std::function<void(const std::vector<SourceFilter>&)>& onStale) {
     // Try GraphQL first
-    if (fetchSourceFiltersGraphQL(sourceId, filters)) {
+    if (fetchSourceFiltersGraphQL(sourceId, filters, onStale)) {
         return true;
     }
 
@@ -3368,7 +3620,8 @@ bool SuwayomiClient::fetchSourceFilters(int64_t sourceId, std::vector<SourceFilt
     return true;
 }
 
-bool SuwayomiClient::fetchSourceFiltersGraphQL(int64_t sourceId, std::vector<SourceFilter>& filters) {
+bool SuwayomiClient::fetchSourceFiltersGraphQL(int64_t sourceId, std::vector<SourceFilter>& filters,
+                                               const std::function<void(const std::vector<SourceFilter>&)>& onStale) {
     const char* query = R"(
         query GetSourceFilters($sourceId: LongString!) {
             source(id: $sourceId) {
@@ -3398,7 +3651,15 @@ bool SuwayomiClient::fetchSourceFiltersGraphQL(int64_t sourceId, std::vector<Sou
     )";
 
     std::string variables = "{\"sourceId\":\"" + std::to_string(sourceId) + "\"}";
-    std::string response = executeGraphQL(query, variables);
+    std::string response = cachedRequest(CachedOp::SOURCE_FILTERS, variables, [&]() {
+        return executeGraphQL(query, variables);
+    }, staleAdapter<std::vector<SourceFilter>>(onStale, [this](const std::string& body, std::vector<SourceFilter>& out) {
+        return parseSourceFiltersResponse(body, out);
+    }));
+    return parseSourceFiltersResponse(response, filters);
+}
+
+bool SuwayomiClient::parseSourceFiltersResponse(const std::string& response, std::vector<SourceFilter>& filters) {
     if (response.empty()) return false;
 
     std::string data = extractJsonObject(response, "data");
@@ -3642,13 +3903,15 @@ std::string SuwayomiClient::buildFilterChangesJson(const std::vector<SourceFilte
 
 bool SuwayomiClient::searchMangaWithFilters(int64_t sourceId, const std::string& query, int page,
                                              const std::vector<SourceFilter>& filters,
-                                             std::vector<Manga>& manga, bool& hasNextPage) {
-    return searchMangaWithFiltersGraphQL(sourceId, query, page, filters, manga, hasNextPage);
+                                             std::vector<Manga>& manga, bool& hasNextPage,
+                                             MangaProjection projection) {
+    return searchMangaWithFiltersGraphQL(sourceId, query, page, filters, manga, hasNextPage, projection);
 }
 
 bool SuwayomiClient::searchMangaWithFiltersGraphQL(int64_t sourceId, const std::string& query, int page,
                                                      const std::vector<SourceFilter>& filters,
-                                                     std::vector<Manga>& manga, bool& hasNextPage) {
+                                                     std::vector<Manga>& manga, bool& hasNextPage,
+                                                     MangaProjection projection) {
     // Build the filter changes JSON
     std::string filterChangesJson = buildFilterChangesJson(filters);
 
@@ -3672,18 +3935,12 @@ bool SuwayomiClient::searchMangaWithFiltersGraphQL(int64_t sourceId, const std::
                 filters: )" + filterChangesJson + R"(
             }) {
                 mangas {
-                    id
-                    title
-                    thumbnailUrl
-                    author
-                    artist
-                    description
-                    inLibrary
+                    ...MangaFields
                 }
                 hasNextPage
             }
         }
-    )";
+    )" + mangaFragment(projection);
 
     std::string variables = "{\"sourceId\":\"" + std::to_string(sourceId) + "\",\"page\":" + std::to_string(page) + "}";
 
@@ -3702,7 +3959,7 @@ bool SuwayomiClient::searchMangaWithFiltersGraphQL(int64_t sourceId, const std::
     manga.clear();
     std::vector<std::string> items = splitJsonArray(mangasJson);
     for (const auto& item : items) {
-        manga.push_back(parseMangaFromGraphQL(item));
+        manga.push_back(parseMangaFromGraphQL(item, projection));
     }
 
     brls::Logger::debug("GraphQL: Fetched {} manga with filters (hasNext: {})", manga.size(), hasNextPage);
@@ -3720,9 +3977,10 @@ bool SuwayomiClient::setSourceFilters(int64_t sourceId, const std::vector<Source
 // ============================================================================
 
 bool SuwayomiClient::fetchPopularManga(int64_t sourceId, int page,
-                                        std::vector<Manga>& manga, bool& hasNextPage) {
+                                        std::vector<Manga>& manga, bool& hasNextPage,
+                                        MangaProjection projection) {
     // Try GraphQL first (primary API)
-    if (fetchPopularMangaGraphQL(sourceId, page, manga, hasNextPage)) {
+    if (fetchPopularMangaGraphQL(sourceId, page, manga, hasNextPage, projection)) {
         return true;
     }
 
@@ -3759,9 +4017,10 @@ bool SuwayomiClient::fetchPopularManga(int64_t sourceId, int page,
 }
 
 bool SuwayomiClient::fetchLatestManga(int64_t sourceId, int page,
-                                       std::vector<Manga>& manga, bool& hasNextPage) {
+                                       std::vector<Manga>& manga, bool& hasNextPage,
+                                       MangaProjection projection) {
     // Try GraphQL first (primary API)
-    if (fetchLatestMangaGraphQL(sourceId, page, manga, hasNextPage)) {
+    if (fetchLatestMangaGraphQL(sourceId, page, manga, hasNextPage, projection)) {
         return true;
     }
 
@@ -3798,9 +4057,10 @@ bool SuwayomiClient::fetchLatestManga(int64_t sourceId, int page,
 }
 
 bool SuwayomiClient::searchManga(int64_t sourceId, const std::string& query, int page,
-                                  std::vector<Manga>& manga, bool& hasNextPage) {
+                                  std::vector<Manga>& manga, bool& hasNextPage,
+                                  MangaProjection projection) {
     // Try GraphQL first (primary API)
-    if (searchMangaGraphQL(sourceId, query, page, manga, hasNextPage)) {
+    if (searchMangaGraphQL(sourceId, query, page, manga, hasNextPage, projection)) {
         return true;
     }
 
@@ -3862,7 +4122,7 @@ bool SuwayomiClient::quickSearchManga(int64_t sourceId, const std::string& query
 // Manga Operations
 // ============================================================================
 
-bool SuwayomiClient::fetchManga(int mangaId, Manga& manga) {
+bool SuwayomiClient::fetchMangaInternal(int mangaId, Manga& manga) {
     // Try GraphQL first (primary API)
     if (fetchMangaGraphQL(mangaId, manga)) {
         return true;
@@ -3884,21 +4144,26 @@ bool SuwayomiClient::fetchManga(int mangaId, Manga& manga) {
     return true;
 }
 
-bool SuwayomiClient::fetchMangaFull(int mangaId, Manga& manga) {
-    vitasuwayomi::HttpClient http = createHttpClient();
-
+bool SuwayomiClient::fetchMangaFullInternal(int mangaId, Manga& manga,
+                                            const std::function<void(const Manga&)>& onStale) {
     std::string url = buildApiUrl("/manga/" + std::to_string(mangaId) + "/full");
-    vitasuwayomi::HttpResponse response = http.get(url);
-
-    if (!response.success || response.statusCode != 200) {
-        return false;
-    }
+    std::string body = cachedRequest(CachedOp::MANGA_FULL, std::to_string(mangaId), [&]() -> std::string {
+        vitasuwayomi::HttpClient http = createHttpClient();
+        vitasuwayomi::HttpResponse response = http.get(url);
+        if (!response.success || response.statusCode != 200) return "";
+        return response.body;
+    }, staleAdapter<Manga>(onStale, [this](const std::string& cached, Manga& out) {
+        out = parseManga(cached);
+        return true;
+    }));
+    if (body.empty()) return false;
 
-    manga = parseManga(response.body);
+    manga = parseManga(body);
     return true;
 }
 
 bool SuwayomiClient::refreshManga(int mangaId, Manga& manga) {
+    ResponseCache::InvalidateOnExit invalidateManga(m_responseCache, CachedOp::MANGA_FULL);
     vitasuwayomi::HttpClient http = createHttpClient();
 
     std::string url = buildApiUrl("/manga/" + std::to_string(mangaId) + "?onlineFetch=true");
@@ -3913,6 +4178,8 @@ bool SuwayomiClient::refreshManga(int mangaId, Manga& manga) {
 }
 
 bool SuwayomiClient::addMangaToLibrary(int mangaId) {
+    ResponseCache::InvalidateOnExit invalidateCategories(m_responseCache, CachedOp::CATEGORIES);
+    ResponseCache::InvalidateOnExit invalidateManga(m_responseCache, CachedOp::MANGA_FULL);
     // Try GraphQL first (primary API)
     if (addMangaToLibraryGraphQL(mangaId)) {
         return true;
@@ -3929,6 +4196,8 @@ bool SuwayomiClient::addMangaToLibrary(int mangaId) {
 }
 
 bool SuwayomiClient::removeMangaFromLibrary(int mangaId) {
+    ResponseCache::InvalidateOnExit invalidateCategories(m_responseCache, CachedOp::CATEGORIES);
+    ResponseCache::InvalidateOnExit invalidateManga(m_responseCache, CachedOp::MANGA_FULL);
     // Try GraphQL first (primary API)
     if (removeMangaFromLibraryGraphQL(mangaId)) {
         return true;
@@ -3952,7 +4221,7 @@ std::string SuwayomiClient::getMangaThumbnailUrl(int mangaId) {
 // Chapter Operations
 // ============================================================================
 
-bool SuwayomiClient::fetchChapters(int mangaId, std::vector<Chapter>& chapters) {
+bool SuwayomiClient::fetchChaptersInternal(int mangaId, std::vector<Chapter>& chapters) {
     // Try GraphQL first (primary API)
     if (fetchChaptersGraphQL(mangaId, chapters)) {
         // If 0 chapters, the server may not have fetched from source yet.
@@ -4006,6 +4275,7 @@ bool SuwayomiClient::fetchChapter(int mangaId, int chapterIndex, Chapter& chapte
 }
 
 bool SuwayomiClient::updateChapter(int mangaId, int chapterIndex, bool read, bool bookmarked) {
+    ResponseCache::InvalidateOnExit invalidateManga(m_responseCache, CachedOp::MANGA_FULL);
     vitasuwayomi::HttpClient http = createHttpClient();
 
     std::string url = buildApiUrl("/manga/" + std::to_string(mangaId) +
@@ -4026,6 +4296,7 @@ bool SuwayomiClient::updateChapter(int mangaId, int chapterIndex, bool read, boo
 }
 
 bool SuwayomiClient::markChapterRead(int mangaId, int chapterId) {
+    ResponseCache::InvalidateOnExit invalidateManga(m_responseCache, CachedOp::MANGA_FULL);
     // Try GraphQL first (uses chapter ID correctly)
     if (markChapterReadGraphQL(chapterId, true)) {
         brls::Logger::debug("Marked chapter {} as read via GraphQL", chapterId);
@@ -4038,6 +4309,7 @@ bool SuwayomiClient::markChapterRead(int mangaId, int chapterId) {
 }
 
 bool SuwayomiClient::markChapterUnread(int mangaId, int chapterId) {
+    ResponseCache::InvalidateOnExit invalidateManga(m_responseCache, CachedOp::MANGA_FULL);
     // Try GraphQL first (uses chapter ID correctly)
     if (markChapterReadGraphQL(chapterId, false)) {
         brls::Logger::debug("Marked chapter {} as unread via GraphQL", chapterId);
@@ -4050,6 +4322,7 @@ bool SuwayomiClient::markChapterUnread(int mangaId, int chapterId) {
 }
 
 bool SuwayomiClient::markChaptersRead(int mangaId, const std::vector<int>& chapterIndexes) {
+    ResponseCache::InvalidateOnExit invalidateManga(m_responseCache, CachedOp::MANGA_FULL);
     vitasuwayomi::HttpClient http = createHttpClient();
     http.setDefaultHeader("Content-Type", "application/json");
 
@@ -4068,6 +4341,7 @@ bool SuwayomiClient::markChaptersRead(int mangaId, const std::vector<int>& chapt
 }
 
 bool SuwayomiClient::markChaptersUnread(int mangaId, const std::vector<int>& chapterIndexes) {
+    ResponseCache::InvalidateOnExit invalidateManga(m_responseCache, CachedOp::MANGA_FULL);
     vitasuwayomi::HttpClient http = createHttpClient();
     http.setDefaultHeader("Content-Type", "application/json");
 
@@ -4086,6 +4360,7 @@ bool SuwayomiClient::markChaptersUnread(int mangaId, const std::vector<int>& cha
 }
 
 bool SuwayomiClient::markAllChaptersRead(int mangaId) {
+    ResponseCache::InvalidateOnExit invalidateManga(m_responseCache, CachedOp::MANGA_FULL);
     // Fetch all chapters, then mark them all read and clear progress via GraphQL
     std::vector<Chapter> chapters;
     if (!fetchChapters(mangaId, chapters)) return false;
@@ -4122,6 +4397,7 @@ bool SuwayomiClient::markAllChaptersRead(int mangaId) {
 }
 
 bool SuwayomiClient::markAllChaptersUnread(int mangaId) {
+    ResponseCache::InvalidateOnExit invalidateManga(m_responseCache, CachedOp::MANGA_FULL);
     // Fetch all chapters, then mark them all unread and clear progress via GraphQL
     std::vector<Chapter> chapters;
     if (!fetchChapters(mangaId, chapters)) return false;
@@ -4158,6 +4434,7 @@ bool SuwayomiClient::markAllChaptersUnread(int mangaId) {
 }
 
 bool SuwayomiClient::updateChapterProgress(int mangaId, int chapterId, int lastPageRead) {
+    ResponseCache::InvalidateOnExit invalidateManga(m_responseCache, CachedOp::MANGA_FULL);
     // Try GraphQL first (uses chapter ID correctly)
     if (updateChapterProgressGraphQL(chapterId, lastPageRead)) {
         brls::Logger::debug("Updated chapter progress via GraphQL: chapter={}, page={}", chapterId, lastPageRead);
@@ -4171,17 +4448,48 @@ bool SuwayomiClient::updateChapterProgress(int mangaId, int chapterId, int lastP
     return false;
 }
 
+bool SuwayomiClient::applyChapterPatches(const std::vector<ChapterPatch>& patches) {
+    if (patches.empty()) return true;
+    ResponseCache::InvalidateOnExit invalidateManga(m_responseCache, CachedOp::MANGA_FULL);
+
+    // One aliased updateChapter per chapter, since each carries its own page
+    std::string query = "mutation ApplyChapterPatches {";
+    int count = 0;
+    for (size_t i = 0; i < patches.size(); i++) {
+        const ChapterPatch& patch = patches[i];
+        std::string fields;
+        if (patch.lastPageRead >= 0) fields += "lastPageRead: " + std::to_string(patch.lastPageRead);
+        if (patch.isRead >= 0) {
+            if (!fields.empty()) fields += ", ";
+            fields += patch.isRead ? "isRead: true" : "isRead: false";
+        }
+        if (fields.empty()) continue;
+        query += "\n    c" + std::to_string(i) + ": updateChapter(input: { id: " +
+                 std::to_string(patch.chapterId) + ", patch: { " + fields + " } }) { chapter { id } }";
+        count++;
+    }
+    if (count == 0) return true;
+    query += "\n}";
+
+    std::string response = executeGraphQL(query);
+    if (response.empty()) return false;
+
+    brls::Logger::debug("GraphQL: Applied {} chapter patches", patches.size());
+    return true;
+}
+
 // ============================================================================
 // Page Operations
 // ============================================================================
 
-bool SuwayomiClient::fetchChapterPages(int mangaId, int chapterId, std::vector<Page>& pages) {
+bool SuwayomiClient::fetchChapterPagesInternal(int mangaId, int chapterId, std::vector<Page>& pages) {
     // Try GraphQL first (uses chapter ID)
     if (fetchChapterPagesGraphQL(chapterId, pages)) {
         // GraphQL returns relative URLs, convert to full URLs
+        std::string serverUrl = getServerUrl();
         for (auto& page : pages) {
             if (!page.imageUrl.empty() && page.imageUrl[0] == '/') {
-                page.imageUrl = m_serverUrl + page.imageUrl;
+                page.imageUrl = serverUrl + page.imageUrl;
             }
         }
         return true;
@@ -4203,9 +4511,10 @@ std::string SuwayomiClient::getPageImageUrl(int chapterId, int pageIndex) {
 // Category Management
 // ============================================================================
 
-bool SuwayomiClient::fetchCategories(std::vector<Category>& categories) {
+bool SuwayomiClient::fetchCategoriesInternal(std::vector<Category>& categories,
+                                             const std::function<void(const std::vector<Category>&)>& onStale) {
     // Try GraphQL first (primary API)
-    if (fetchCategoriesGraphQL(categories)) {
+    if (fetchCategoriesGraphQL(categories, onStale)) {
         return true;
     }
 
@@ -4232,6 +4541,7 @@ bool SuwayomiClient::fetchCategories(std::vector<Category>& categories) {
 }
 
 bool SuwayomiClient::createCategory(const std::string& name) {
+    ResponseCache::InvalidateOnExit invalidateCategories(m_responseCache, CachedOp::CATEGORIES);
     // Try GraphQL first (primary API)
     if (createCategoryGraphQL(name)) {
         return true;
@@ -4250,6 +4560,7 @@ bool SuwayomiClient::createCategory(const std::string& name) {
 }
 
 bool SuwayomiClient::deleteCategory(int categoryId) {
+    ResponseCache::InvalidateOnExit invalidateCategories(m_responseCache, CachedOp::CATEGORIES);
     // Try GraphQL first (primary API)
     if (deleteCategoryGraphQL(categoryId)) {
         return true;
@@ -4266,6 +4577,7 @@ bool SuwayomiClient::deleteCategory(int categoryId) {
 }
 
 bool SuwayomiClient::updateCategory(int categoryId, const std::string& name, bool isDefault) {
+    ResponseCache::InvalidateOnExit invalidateCategories(m_responseCache, CachedOp::CATEGORIES);
     // Try GraphQL first (primary API)
     if (updateCategoryGraphQL(categoryId, name, isDefault)) {
         return true;
@@ -4290,6 +4602,7 @@ bool SuwayomiClient::updateCategory(int categoryId, const std::string& name, boo
 }
 
 bool SuwayomiClient::reorderCategories(const std::vector<int>& categoryIds) {
+    ResponseCache::InvalidateOnExit invalidateCategories(m_responseCache, CachedOp::CATEGORIES);
     // GraphQL primary: set each category's position to its index in the desired
     // order. The REST /category/reorder route only accepts a single {from,to}
     // move (form params), so a whole-array reorder can't be sent in one call.
@@ -4303,6 +4616,7 @@ bool SuwayomiClient::reorderCategories(const std::vector<int>& categoryIds) {
 }
 
 bool SuwayomiClient::moveCategoryOrder(int categoryId, int newPosition) {
+    ResponseCache::InvalidateOnExit invalidateCategories(m_responseCache, CachedOp::CATEGORIES);
     // Try GraphQL first (primary API)
     if (updateCategoryOrderGraphQL(categoryId, newPosition)) {
         return true;
@@ -4357,6 +4671,8 @@ bool SuwayomiClient::moveCategoryOrder(int categoryId, int newPosition) {
 }
 
 bool SuwayomiClient::addMangaToCategory(int mangaId, int categoryId) {
+    ResponseCache::InvalidateOnExit invalidateCategories(m_responseCache, CachedOp::CATEGORIES);
+    ResponseCache::InvalidateOnExit invalidateManga(m_responseCache, CachedOp::MANGA_FULL);
     vitasuwayomi::HttpClient http = createHttpClient();
 
     std::string url = buildApiUrl("/manga/" + std::to_string(mangaId) +
@@ -4367,6 +4683,8 @@ bool SuwayomiClient::addMangaToCategory(int mangaId, int categoryId) {
 }
 
 bool SuwayomiClient::removeMangaFromCategory(int mangaId, int categoryId) {
+    ResponseCache::InvalidateOnExit invalidateCategories(m_responseCache, CachedOp::CATEGORIES);
+    ResponseCache::InvalidateOnExit invalidateManga(m_responseCache, CachedOp::MANGA_FULL);
     vitasuwayomi::HttpClient http = createHttpClient();
 
     std::string url = buildApiUrl("/manga/" + std::to_string(mangaId) +
@@ -4376,9 +4694,10 @@ bool SuwayomiClient::removeMangaFromCategory(int mangaId, int categoryId) {
     return response.success && response.statusCode == 200;
 }
 
-bool SuwayomiClient::fetchCategoryManga(int categoryId, std::vector<Manga>& manga) {
+bool SuwayomiClient::fetchCategoryMangaInternal(int categoryId, std::vector<Manga>& manga,
+                                                MangaProjection projection) {
     // Try GraphQL first (primary API)
-    if (fetchCategoryMangaGraphQL(categoryId, manga)) {
+    if (fetchCategoryMangaGraphQL(categoryId, manga, projection)) {
         return true;
     }
 
@@ -4411,19 +4730,20 @@ bool SuwayomiClient::fetchCategoryManga(int categoryId, std::vector<Manga>& mang
 // Library Operations
 // ============================================================================
 
-bool SuwayomiClient::fetchLibraryManga(std::vector<Manga>& manga) {
+bool SuwayomiClient::fetchLibraryManga(std::vector<Manga>& manga, MangaProjection projection) {
     // Try GraphQL first (primary API)
-    if (fetchLibraryMangaGraphQL(manga)) {
+    if (fetchLibraryMangaGraphQL(manga, projection)) {
         return true;
     }
 
     // REST fallback - Default category (0) contains all library manga
     brls::Logger::info("GraphQL failed for library, falling back to REST...");
-    return fetchCategoryManga(0, manga);
+    return fetchCategoryManga(0, manga, projection);
 }
 
-bool SuwayomiClient::fetchLibraryMangaByCategory(int categoryId, std::vector<Manga>& manga) {
-    return fetchCategoryManga(categoryId, manga);
+bool SuwayomiClient::fetchLibraryMangaByCategory(int categoryId, std::vector<Manga>& manga,
+                                                 MangaProjection projection) {
+    return fetchCategoryManga(categoryId, manga, projection);
 }
 
 bool SuwayomiClient::triggerLibraryUpdate() {
@@ -4601,6 +4921,8 @@ bool SuwayomiClient::globalSearch(const std::string& query, const std::vector<in
 // ============================================================================
 
 bool SuwayomiClient::setMangaCategories(int mangaId, const std::vector<int>& categoryIds) {
+    ResponseCache::InvalidateOnExit invalidateCategories(m_responseCache, CachedOp::CATEGORIES);
+    ResponseCache::InvalidateOnExit invalidateManga(m_responseCache, CachedOp::MANGA_FULL);
     // Try GraphQL first (primary API)
     if (setMangaCategoriesGraphQL(mangaId, categoryIds)) {
         return true;
@@ -4801,11 +5123,43 @@ bool SuwayomiClient::fetchDownloadQueue(std::vector<DownloadQueueItem>& queue) {
         return false;
     }
 
+    parseDownloadQueue(response, queue);
+    brls::Logger::info("SuwayomiClient: Fetched {} items in download queue", queue.size());
+    return true;
+}
+
+const char* SuwayomiClient::getDownloadQueueSubscription() {
+    return R"(
+        subscription {
+            downloadChanged {
+                state
+                queue {
+                    chapter {
+                        id
+                        name
+                        chapterNumber
+                        pageCount
+                        manga {
+                            id
+                            title
+                        }
+                    }
+                    progress
+                    state
+                    tries
+                }
+            }
+        }
+    )";
+}
+
+void SuwayomiClient::parseDownloadQueue(const std::string& json, std::vector<DownloadQueueItem>& queue) {
+    queue.clear();
+
     // Parse the queue array from response
-    std::string queueArray = extractJsonArray(response, "queue");
+    std::string queueArray = extractJsonArray(json, "queue");
     if (queueArray.empty() || queueArray == "[]") {
-        brls::Logger::debug("SuwayomiClient: Download queue is empty");
-        return true;  // Empty queue is valid
+        return;  // Empty queue is valid
     }
 
     // Parse each queue item
@@ -4865,9 +5219,6 @@ bool SuwayomiClient::fetchDownloadQueue(std::vector<DownloadQueueItem>& queue) {
             }
         }
     }
-
-    brls::Logger::info("SuwayomiClient: Fetched {} items in download queue", queue.size());
-    return true;
 }
 
 bool SuwayomiClient::startDownloads() {
@@ -4974,6 +5325,9 @@ bool SuwayomiClient::exportBackup(const std::string& savePath) {
 }
 
 bool SuwayomiClient::importBackup(const std::string& filePath) {
+    ResponseCache::InvalidateOnExit invalidateCategories(m_responseCache, CachedOp::CATEGORIES);
+    ResponseCache::InvalidateOnExit invalidateManga(m_responseCache, CachedOp::MANGA_FULL);
+    ResponseCache::InvalidateOnExit invalidateSources(m_responseCache, CachedOp::SOURCES);
     // Read the backup file
     auto fileData = platform::readFile(filePath);
     if (fileData.empty()) {
@@ -5122,7 +5476,8 @@ TrackSearchResult SuwayomiClient::parseTrackSearchResultFromGraphQL(const std::s
     return result;
 }
 
-bool SuwayomiClient::fetchTrackersGraphQL(std::vector<Tracker>& trackers) {
+bool SuwayomiClient::fetchTrackersGraphQL(std::vector<Tracker>& trackers,
+                                          const std::function<void(const std::vector<Tracker>&)>& onStale) {
     const char* query = R"(
         query GetTrackers {
             trackers {
@@ -5144,11 +5499,20 @@ bool SuwayomiClient::fetchTrackersGraphQL(std::vector<Tracker>& trackers) {
         }
     )";
 
-    std::string response = executeGraphQL(query);
+    std::string response = cachedRequest(CachedOp::TRACKERS, "", [&]() {
+        return executeGraphQL(query);
+    }, staleAdapter<std::vector<Tracker>>(onStale, [this](const std::string& body, std::vector<Tracker>& out) {
+        return parseTrackersResponse(body, out);
+    }));
     if (response.empty()) {
         brls::Logger::error("GraphQL: fetchTrackers - empty response");
         return false;
     }
+    return parseTrackersResponse(response, trackers);
+}
+
+bool SuwayomiClient::parseTrackersResponse(const std::string& response, std::vector<Tracker>& trackers) {
+    if (response.empty()) return false;
 
     std::string data = extractJsonObject(response, "data");
     if (data.empty()) {
@@ -5179,8 +5543,9 @@ bool SuwayomiClient::fetchTrackersGraphQL(std::vector<Tracker>& trackers) {
     return true;
 }
 
-bool SuwayomiClient::fetchTrackers(std::vector<Tracker>& trackers) {
-    return fetchTrackersGraphQL(trackers);
+bool SuwayomiClient::fetchTrackers(std::vector<Tracker>& trackers,
+                                   const std::function<void(const std::vector<Tracker>&)>& onStale) {
+    return fetchTrackersGraphQL(trackers, onStale);
 }
 
 bool SuwayomiClient::fetchTrackerGraphQL(int trackerId, Tracker& tracker) {
@@ -5411,11 +5776,13 @@ bool SuwayomiClient::bindTrackerGraphQL(int mangaId, int trackerId, int64_t remo
 }
 
 bool SuwayomiClient::bindTracker(int mangaId, int trackerId, int64_t remoteId) {
+    ResponseCache::InvalidateOnExit invalidateManga(m_responseCache, CachedOp::MANGA_FULL);
     return bindTrackerGraphQL(mangaId, trackerId, remoteId);
 }
 
 // Legacy overload
 bool SuwayomiClient::bindTracker(int mangaId, int trackerId, int remoteId) {
+    ResponseCache::InvalidateOnExit invalidateManga(m_responseCache, CachedOp::MANGA_FULL);
     return bindTrackerGraphQL(mangaId, trackerId, static_cast<int64_t>(remoteId));
 }
 
@@ -5447,6 +5814,7 @@ bool SuwayomiClient::unbindTrackerGraphQL(int recordId, bool deleteRemoteTrack)
 }
 
 bool SuwayomiClient::unbindTracker(int recordId, bool deleteRemoteTrack) {
+    ResponseCache::InvalidateOnExit invalidateManga(m_responseCache, CachedOp::MANGA_FULL);
     return unbindTrackerGraphQL(recordId, deleteRemoteTrack);
 }
 
@@ -5512,6 +5880,7 @@ bool SuwayomiClient::updateTrackRecordGraphQL(int recordId, int status, double l
 
 bool SuwayomiClient::updateTrackRecord(int recordId, int status, double lastChapterRead,
                                        const std::string& scoreString, int64_t startDate, int64_t finishDate) {
+    ResponseCache::InvalidateOnExit invalidateManga(m_responseCache, CachedOp::MANGA_FULL);
     return updateTrackRecordGraphQL(recordId, status, lastChapterRead, scoreString, startDate, finishDate);
 }
 
@@ -5591,6 +5960,7 @@ bool SuwayomiClient::loginTrackerCredentialsGraphQL(int trackerId, const std::st
 }
 
 bool SuwayomiClient::loginTrackerCredentials(int trackerId, const std::string& username, const std::string& password) {
+    ResponseCache::InvalidateOnExit invalidateTrackers(m_responseCache, CachedOp::TRACKERS);
     return loginTrackerCredentialsGraphQL(trackerId, username, password);
 }
 
@@ -5600,6 +5970,7 @@ bool SuwayomiClient::loginTracker(int trackerId, const std::string& username, co
 }
 
 bool SuwayomiClient::loginTrackerOAuth(int trackerId, const std::string& callbackUrl, std::string& oauthUrl) {
+    ResponseCache::InvalidateOnExit invalidateTrackers(m_responseCache, CachedOp::TRACKERS);
     const char* query = R"(
         mutation LoginTrackerOAuth($trackerId: Int!, $callbackUrl: String!) {
             loginTrackerOAuth(input: { trackerId: $trackerId, callbackUrl: $callbackUrl }) {
@@ -5658,6 +6029,7 @@ bool SuwayomiClient::logoutTrackerGraphQL(int trackerId) {
 }
 
 bool SuwayomiClient::logoutTracker(int trackerId) {
+    ResponseCache::InvalidateOnExit invalidateTrackers(m_responseCache, CachedOp::TRACKERS);
     return logoutTrackerGraphQL(trackerId);
 }
 
@@ -5694,6 +6066,41 @@ bool SuwayomiClient::fetchUpdateSummary(int& pendingUpdates, int& runningJobs, b
     return true;
 }
 
+const char* SuwayomiClient::getUpdateStatusSubscription() {
+    return R"(
+        subscription {
+            updateStatusChanged {
+                isRunning
+                pendingJobs {
+                    mangas {
+                        totalCount
+                    }
+                }
+                runningJobs {
+                    mangas {
+                        totalCount
+                    }
+                }
+            }
+        }
+    )";
+}
+
+bool SuwayomiClient::parseUpdateStatus(const std::string& json, int& pendingUpdates, int& runningJobs,
+                                       bool& isUpdating) {
+    std::string status = extractJsonObject(json, "updateStatusChanged");
+    if (status.empty()) return false;
+
+    isUpdating = extractJsonBool(status, "isRunning");
+    pendingUpdates = 0;
+    runningJobs = 0;
+    std::string pendingJson = extractJsonObject(status, "pendingJobs");
+    std::string runningJson = extractJsonObject(status, "runningJobs");
+    if (!pendingJson.empty()) pendingUpdates = extractJsonInt(pendingJson, "totalCount");
+    if (!runningJson.empty()) runningJobs = extractJsonInt(runningJson, "totalCount");
+    return true;
+}
+
 // ============================================================================
 // GraphQL Extension Operations
 // ============================================================================
@@ -6758,11 +7165,12 @@ std::string SuwayomiClient::buildProxiedImageUrl(const std::string& externalUrl)
     }
 
     // Check if it's already a server URL (starts with server URL or is relative)
+    std::string serverUrl = getServerUrl();
     if (externalUrl[0] == '/' ||
-        (!m_serverUrl.empty() && externalUrl.find(m_serverUrl) == 0)) {
+        (!serverUrl.empty() && externalUrl.find(serverUrl) == 0)) {
         // Already a server URL, return as-is (with server prefix if relative)
         if (externalUrl[0] == '/') {
-            return m_serverUrl + externalUrl;
+            return serverUrl + externalUrl;
         }
         return externalUrl;
     }
@@ -6786,7 +7194,7 @@ std::string SuwayomiClient::buildProxiedImageUrl(const std::string& externalUrl)
         }
     }
 
-    return m_serverUrl + "/api/v1/imageUrl/fetch?url=" + encoded;
+    return serverUrl + "/api/v1/imageUrl/fetch?url=" + encoded;
 }
 
 // ============================================================================
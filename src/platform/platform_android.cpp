@@ -58,6 +58,15 @@ std::vector<uint8_t> readFile(const std::string& path) {
     return data;
 }
 
+std::vector<uint8_t> readFilePrefix(const std::string& path, size_t maxBytes) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) return {};
+    std::vector<uint8_t> data(maxBytes);
+    file.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(maxBytes));
+    data.resize(static_cast<size_t>(file.gcount()));
+    return data;
+}
+
 bool writeFile(const std::string& path, const void* data, size_t size) {
     std::ofstream file(path, std::ios::binary | std::ios::trunc);
     if (!file.is_open()) return false;
@@ -69,6 +78,13 @@ bool writeFile(const std::string& path, const std::string& content) {
     return writeFile(path, content.data(), content.size());
 }
 
+bool appendFile(const std::string& path, const void* data, size_t size) {
+    std::ofstream file(path, std::ios::binary | std::ios::app);
+    if (!file.is_open()) return false;
+    file.write(static_cast<const char*>(data), size);
+    return file.good();
+}
+
 bool fileExists(const std::string& path) {
     struct stat st;
     return stat(path.c_str(), &st) == 0;
@@ -78,6 +94,13 @@ bool deleteFile(const std::string& path) {
     return std::remove(path.c_str()) == 0;
 }
 
+bool renameFile(const std::string& from, const std::string& to) {
+    if (std::rename(from.c_str(), to.c_str()) == 0) return true;
+    // Some filesystems refuse to overwrite; clear the target and retry
+    std::remove(to.c_str());
+    return std::rename(from.c_str(), to.c_str()) == 0;
+}
+
 int64_t fileSize(const std::string& path) {
     // Regular files only; directories report st_size ~4096, which must not be
     // counted (callers recurse into them instead), so return -1 for non-files.
@@ -142,12 +165,23 @@ void launchLargeStackThread(std::function<void()> task) {
     launchThread(std::move(task));
 }
 
+int workerThreadCount() {
+    unsigned int cores = std::thread::hardware_concurrency();
+    if (cores < 4) return 4;
+    return cores > 8 ? 8 : static_cast<int>(cores);
+}
+
 bool condWaitFor(std::mutex& mtx, std::unique_lock<std::mutex>& lock,
                  int milliseconds, std::function<bool()> predicate) {
     static std::condition_variable cv;
     return cv.wait_for(lock, std::chrono::milliseconds(milliseconds), predicate);
 }
 
+bool condWaitFor(std::condition_variable& cv, std::unique_lock<std::mutex>& lock,
+                 int milliseconds, std::function<bool()> predicate) {
+    return cv.wait_for(lock, std::chrono::milliseconds(milliseconds), predicate);
+}
+
 // ── Display / Image Constraints ────────────────────────────────────────
 
 const ImageConstraints& imageConstraints() {
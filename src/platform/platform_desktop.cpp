@@ -56,6 +56,15 @@ std::vector<uint8_t> readFile(const std::string& path) {
     return data;
 }
 
+std::vector<uint8_t> readFilePrefix(const std::string& path, size_t maxBytes) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) return {};
+    std::vector<uint8_t> data(maxBytes);
+    file.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(maxBytes));
+    data.resize(static_cast<size_t>(file.gcount()));
+    return data;
+}
+
 bool writeFile(const std::string& path, const void* data, size_t size) {
     std::ofstream file(path, std::ios::binary | std::ios::trunc);
     if (!file.is_open()) return false;
@@ -67,6 +76,13 @@ bool writeFile(const std::string& path, const std::string& content) {
     return writeFile(path, content.data(), content.size());
 }
 
+bool appendFile(const std::string& path, const void* data, size_t size) {
+    std::ofstream file(path, std::ios::binary | std::ios::app);
+    if (!file.is_open()) return false;
+    file.write(static_cast<const char*>(data), size);
+    return file.good();
+}
+
 bool fileExists(const std::string& path) {
     std::error_code ec;
     return std::filesystem::exists(path, ec);
@@ -76,6 +92,13 @@ bool deleteFile(const std::string& path) {
     return std::remove(path.c_str()) == 0;
 }
 
+bool renameFile(const std::string& from, const std::string& to) {
+    // std::filesystem::rename replaces the target on Windows as well
+    std::error_code ec;
+    std::filesystem::rename(from, to, ec);
+    return !ec;
+}
+
 int64_t fileSize(const std::string& path) {
     // Only regular files have a meaningful size. Opening a directory with an
     // ifstream can "succeed" and then report a garbage tellg() value, so guard
@@ -138,12 +161,23 @@ void launchLargeStackThread(std::function<void()> task) {
     launchThread(std::move(task));
 }
 
+int workerThreadCount() {
+    unsigned int cores = std::thread::hardware_concurrency();
+    if (cores < 4) return 4;
+    return cores > 8 ? 8 : static_cast<int>(cores);
+}
+
 bool condWaitFor(std::mutex& mtx, std::unique_lock<std::mutex>& lock,
                  int milliseconds, std::function<bool()> predicate) {
     static std::condition_variable cv;
     return cv.wait_for(lock, std::chrono::milliseconds(milliseconds), predicate);
 }
 
+bool condWaitFor(std::condition_variable& cv, std::unique_lock<std::mutex>& lock,
+                 int milliseconds, std::function<bool()> predicate) {
+    return cv.wait_for(lock, std::chrono::milliseconds(milliseconds), predicate);
+}
+
 // ── Display / Image Constraints ────────────────────────────────────────
 
 const ImageConstraints& imageConstraints() {
@@ -51,6 +51,15 @@ std::vector<uint8_t> readFile(const std::string& path) {
     return data;
 }
 
+std::vector<uint8_t> readFilePrefix(const std::string& path, size_t maxBytes) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) return {};
+    std::vector<uint8_t> data(maxBytes);
+    file.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(maxBytes));
+    data.resize(static_cast<size_t>(file.gcount()));
+    return data;
+}
+
 bool writeFile(const std::string& path, const void* data, size_t size) {
     std::ofstream file(path, std::ios::binary | std::ios::trunc);
     if (!file.is_open()) return false;
@@ -62,6 +71,13 @@ bool writeFile(const std::string& path, const std::string& content) {
     return writeFile(path, content.data(), content.size());
 }
 
+bool appendFile(const std::string& path, const void* data, size_t size) {
+    std::ofstream file(path, std::ios::binary | std::ios::app);
+    if (!file.is_open()) return false;
+    file.write(static_cast<const char*>(data), size);
+    return file.good();
+}
+
 bool fileExists(const std::string& path) {
     struct stat st;
     return stat(path.c_str(), &st) == 0;
@@ -71,6 +87,13 @@ bool deleteFile(const std::string& path) {
     return std::remove(path.c_str()) == 0;
 }
 
+bool renameFile(const std::string& from, const std::string& to) {
+    if (std::rename(from.c_str(), to.c_str()) == 0) return true;
+    // Some filesystems refuse to overwrite; clear the target and retry
+    std::remove(to.c_str());
+    return std::rename(from.c_str(), to.c_str()) == 0;
+}
+
 int64_t fileSize(const std::string& path) {
     // Regular files only; directories must report -1 so callers recurse into
     // them instead of counting a bogus directory size.
@@ -135,12 +158,21 @@ void launchLargeStackThread(std::function<void()> task) {
     launchThread(std::move(task));
 }
 
+int workerThreadCount() {
+    return 6;
+}
+
 bool condWaitFor(std::mutex& mtx, std::unique_lock<std::mutex>& lock,
                  int milliseconds, std::function<bool()> predicate) {
     static std::condition_variable cv;
     return cv.wait_for(lock, std::chrono::milliseconds(milliseconds), predicate);
 }
 
+bool condWaitFor(std::condition_variable& cv, std::unique_lock<std::mutex>& lock,
+                 int milliseconds, std::function<bool()> predicate) {
+    return cv.wait_for(lock, std::chrono::milliseconds(milliseconds), predicate);
+}
+
 // ── Display / Image Constraints ────────────────────────────────────────
 
 const ImageConstraints& imageConstraints() {
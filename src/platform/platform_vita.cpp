@@ -64,6 +64,19 @@ std::vector<uint8_t> readFile(const std::string& path) {
     return data;
 }
 
+std::vector<uint8_t> readFilePrefix(const std::string& path, size_t maxBytes) {
+    SceUID fd = sceIoOpen(path.c_str(), SCE_O_RDONLY, 0);
+    if (fd < 0) return {};
+
+    std::vector<uint8_t> data(maxBytes);
+    SceSSize bytesRead = sceIoRead(fd, data.data(), static_cast<SceSize>(maxBytes));
+    sceIoClose(fd);
+
+    if (bytesRead < 0) return {};
+    data.resize(static_cast<size_t>(bytesRead));
+    return data;
+}
+
 bool writeFile(const std::string& path, const void* data, size_t size) {
     SceUID fd = sceIoOpen(path.c_str(), SCE_O_WRONLY | SCE_O_CREAT | SCE_O_TRUNC, 0666);
     if (fd < 0) return false;
@@ -76,6 +89,14 @@ bool writeFile(const std::string& path, const std::string& content) {
     return writeFile(path, content.data(), content.size());
 }
 
+bool appendFile(const std::string& path, const void* data, size_t size) {
+    SceUID fd = sceIoOpen(path.c_str(), SCE_O_WRONLY | SCE_O_CREAT | SCE_O_APPEND, 0666);
+    if (fd < 0) return false;
+    SceSSize written = sceIoWrite(fd, data, static_cast<SceSize>(size));
+    sceIoClose(fd);
+    return written == static_cast<SceSSize>(size);
+}
+
 bool fileExists(const std::string& path) {
     SceIoStat stat;
     return sceIoGetstat(path.c_str(), &stat) >= 0;
@@ -85,6 +106,12 @@ bool deleteFile(const std::string& path) {
     return sceIoRemove(path.c_str()) >= 0;
 }
 
+bool renameFile(const std::string& from, const std::string& to) {
+    // sceIoRename refuses to overwrite, so clear the target first
+    sceIoRemove(to.c_str());
+    return sceIoRename(from.c_str(), to.c_str()) >= 0;
+}
+
 int64_t fileSize(const std::string& path) {
     // Regular files only; a directory reports a size here too, which must not be
     // counted (callers recurse into it instead), so return -1 for directories.
@@ -177,12 +204,22 @@ void launchLargeStackThread(std::function<void()> task) {
     }
 }
 
+int workerThreadCount() {
+    // Three cores are available to apps; workers mostly sit in curl
+    return 4;
+}
+
 bool condWaitFor(std::mutex& mtx, std::unique_lock<std::mutex>& lock,
                  int milliseconds, std::function<bool()> predicate) {
     static std::condition_variable cv;
     return cv.wait_for(lock, std::chrono::milliseconds(milliseconds), predicate);
 }
 
+bool condWaitFor(std::condition_variable& cv, std::unique_lock<std::mutex>& lock,
+                 int milliseconds, std::function<bool()> predicate) {
+    return cv.wait_for(lock, std::chrono::milliseconds(milliseconds), predicate);
+}
+
 // ── Display / Image Constraints ────────────────────────────────────────
 
 const ImageConstraints& imageConstraints() {
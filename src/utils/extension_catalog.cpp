@@ -0,0 +1,348 @@
+/**
+ * VitaSuwayomi - Extension Catalog implementation
+ */
+
+#include "utils/extension_catalog.hpp"
+#include <borealis.hpp>
+#include <algorithm>
+#include <cstring>
+#include <ctime>
+#include <iterator>
+#include <map>
+#include <unordered_set>
+
+#include "platform/platform.hpp"
+
+namespace vitasuwayomi {
+
+static const char CATALOG_MAGIC[4] = {'E', 'X', 'C', '1'};
+
+enum : uint8_t {
+    FLAG_INSTALLED = 1 << 0,
+    FLAG_HAS_UPDATE = 1 << 1,
+    FLAG_OBSOLETE = 1 << 2,
+    FLAG_NSFW = 1 << 3,
+    FLAG_CONFIGURABLE = 1 << 4,
+};
+
+template<typename T>
+static void appendRaw(std::string& out, T value) {
+    out.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template<typename T>
+static bool readRaw(const std::vector<uint8_t>& data, size_t& offset, T& value) {
+    if (offset + sizeof(T) > data.size()) return false;
+    std::memcpy(&value, data.data() + offset, sizeof(T));
+    offset += sizeof(T);
+    return true;
+}
+
+static void appendString(std::string& out, const std::string& s) {
+    uint16_t len = static_cast<uint16_t>(std::min<size_t>(s.size(), 0xFFFF));
+    appendRaw<uint16_t>(out, len);
+    out.append(s.data(), len);
+}
+
+// Smallest encodings of an extension and a language group (all strings empty,
+// no members), used to reject counts the remaining bytes cannot hold
+static constexpr size_t MIN_EXTENSION_BYTES = 5 * sizeof(uint16_t) + sizeof(int32_t) + sizeof(uint8_t);
+static constexpr size_t MIN_GROUP_BYTES = sizeof(uint16_t) + sizeof(uint32_t);
+
+static bool readString(const std::vector<uint8_t>& data, size_t& offset, std::string& s) {
+    uint16_t len = 0;
+    if (!readRaw(data, offset, len) || offset + len > data.size()) return false;
+    s.assign(reinterpret_cast<const char*>(data.data() + offset), len);
+    offset += len;
+    return true;
+}
+
+static bool sameExtension(const Extension& a, const Extension& b) {
+    return a.name == b.name && a.lang == b.lang && a.versionName == b.versionName &&
+           a.versionCode == b.versionCode && a.iconUrl == b.iconUrl &&
+           a.installed == b.installed && a.hasUpdate == b.hasUpdate && a.obsolete == b.obsolete &&
+           a.isNsfw == b.isNsfw && a.hasConfigurableSources == b.hasConfigurableSources;
+}
+
+static bool nameOrder(const Extension& a, const Extension& b) {
+    if (a.name != b.name) return a.name < b.name;
+    return a.pkgName < b.pkgName;
+}
+
+static std::string toLower(const std::string& s) {
+    std::string out = s;
+    std::transform(out.begin(), out.end(), out.begin(), ::tolower);
+    return out;
+}
+
+static uint16_t bigramKey(unsigned char a, unsigned char b) {
+    return static_cast<uint16_t>((a << 8) | b);
+}
+
+std::string ExtensionCatalog::getCatalogFilePath() {
+    return platform::path("cache") + "/extensions.bin";
+}
+
+Extension* ExtensionCatalog::find(const std::string& pkgName) {
+    auto it = m_indexByPkg.find(pkgName);
+    return it != m_indexByPkg.end() ? &m_entries[it->second] : nullptr;
+}
+
+ExtensionCatalog::Delta ExtensionCatalog::merge(const std::vector<Extension>& fresh) {
+    Delta delta;
+    m_fetchedAt = static_cast<int64_t>(std::time(nullptr));
+
+    std::unordered_map<std::string, const Extension*> freshByPkg;
+    freshByPkg.reserve(fresh.size());
+    for (const auto& ext : fresh) {
+        freshByPkg[ext.pkgName] = &ext;
+    }
+
+    // Drop entries the server no longer lists, and pull out renamed ones so
+    // they can be re-inserted at their new position
+    std::vector<Extension> toInsert;
+    std::unordered_set<std::string> seen;
+    seen.reserve(m_entries.size());
+    size_t kept = 0;
+    for (size_t i = 0; i < m_entries.size(); i++) {
+        Extension& ext = m_entries[i];
+        auto it = freshByPkg.find(ext.pkgName);
+        if (it == freshByPkg.end() || !seen.insert(ext.pkgName).second) {
+            delta.removed++;
+            continue;
+        }
+        const Extension& latest = *it->second;
+        if (!sameExtension(ext, latest)) {
+            delta.changed++;
+            if (latest.name != ext.name) {
+                toInsert.push_back(latest);
+                continue;
+            }
+            ext = latest;
+        }
+        if (kept != i) m_entries[kept] = std::move(ext);
+        kept++;
+    }
+    m_entries.resize(kept);
+
+    for (const auto& ext : fresh) {
+        if (seen.insert(ext.pkgName).second) {
+            toInsert.push_back(ext);
+            delta.added++;
+        }
+    }
+
+    if (delta.empty()) return delta;
+
+    if (!toInsert.empty()) {
+        std::sort(toInsert.begin(), toInsert.end(), nameOrder);
+        size_t mid = m_entries.size();
+        m_entries.insert(m_entries.end(), std::make_move_iterator(toInsert.begin()),
+                         std::make_move_iterator(toInsert.end()));
+        std::inplace_merge(m_entries.begin(), m_entries.begin() + mid, m_entries.end(), nameOrder);
+    }
+
+    rebuildDerived(true);
+    return delta;
+}
+
+void ExtensionCatalog::rebuildDerived(bool regroup) {
+    m_indexByPkg.clear();
+    m_indexByPkg.reserve(m_entries.size());
+    m_nameLower.clear();
+    m_nameLower.reserve(m_entries.size());
+    m_bigrams.clear();
+
+    std::map<std::string, std::vector<int>> byLang;
+    uint32_t hash = 2166136261u;
+    auto mix = [&hash](const std::string& s) {
+        for (unsigned char c : s) {
+            hash ^= c;
+            hash *= 16777619u;
+        }
+        hash ^= 0xFF;
+        hash *= 16777619u;
+    };
+
+    for (int i = 0; i < static_cast<int>(m_entries.size()); i++) {
+        const Extension& ext = m_entries[i];
+        m_indexByPkg[ext.pkgName] = i;
+        if (regroup) byLang[ext.lang].push_back(i);
+
+        std::string lower = toLower(ext.name);
+        for (size_t k = 0; k + 1 < lower.size(); k++) {
+            auto& postings = m_bigrams[bigramKey(lower[k], lower[k + 1])];
+            if (postings.empty() || postings.back() != i) postings.push_back(i);
+        }
+        m_nameLower.push_back(std::move(lower));
+
+        mix(ext.pkgName);
+        mix(ext.versionName);
+        mix(std::to_string(ext.versionCode));
+        mix(ext.installed ? "i" : "-");
+        mix(ext.hasUpdate ? "u" : "-");
+    }
+    m_version = hash;
+
+    if (!regroup) return;
+    m_groups.clear();
+    m_groups.reserve(byLang.size());
+    for (auto& pair : byLang) {
+        LanguageGroup group;
+        group.lang = pair.first;
+        group.members = std::move(pair.second);
+        m_groups.push_back(std::move(group));
+    }
+}
+
+std::vector<int> ExtensionCatalog::search(const std::string& query) const {
+    std::vector<int> results;
+    std::string q = toLower(query);
+    if (q.empty()) return results;
+
+    if (q.size() < 2) {
+        for (int i = 0; i < static_cast<int>(m_nameLower.size()); i++) {
+            if (m_nameLower[i].find(q) != std::string::npos) results.push_back(i);
+        }
+        return results;
+    }
+
+    // Every bigram of the query must occur in the name; start from the
+    // rarest posting list and confirm survivors with a substring check
+    std::vector<const std::vector<int>*> lists;
+    for (size_t k = 0; k + 1 < q.size(); k++) {
+        auto it = m_bigrams.find(bigramKey(q[k], q[k + 1]));
+        if (it == m_bigrams.end()) return results;
+        lists.push_back(&it->second);
+    }
+    std::sort(lists.begin(), lists.end(),
+              [](const std::vector<int>* a, const std::vector<int>* b) { return a->size() < b->size(); });
+
+    std::vector<int> candidates = *lists[0];
+    for (size_t l = 1; l < lists.size() && !candidates.empty(); l++) {
+        std::vector<int> narrowed;
+        std::set_intersection(candidates.begin(), candidates.end(), lists[l]->begin(), lists[l]->end(),
+                              std::back_inserter(narrowed));
+        candidates.swap(narrowed);
+    }
+
+    for (int i : candidates) {
+        if (m_nameLower[i].find(q) != std::string::npos) results.push_back(i);
+    }
+    return results;
+}
+
+bool ExtensionCatalog::save() const {
+    std::string out;
+    out.reserve(m_entries.size() * 128);
+    out.append(CATALOG_MAGIC, sizeof(CATALOG_MAGIC));
+    appendRaw<uint32_t>(out, m_version);
+    appendRaw<int64_t>(out, m_fetchedAt);
+
+    appendRaw<uint32_t>(out, static_cast<uint32_t>(m_entries.size()));
+    for (const auto& ext : m_entries) {
+        appendString(out, ext.pkgName);
+        appendString(out, ext.name);
+        appendString(out, ext.lang);
+        appendString(out, ext.versionName);
+        appendString(out, ext.iconUrl);
+        appendRaw<int32_t>(out, ext.versionCode);
+        uint8_t flags = (ext.installed ? FLAG_INSTALLED : 0) | (ext.hasUpdate ? FLAG_HAS_UPDATE : 0) |
+                        (ext.obsolete ? FLAG_OBSOLETE : 0) | (ext.isNsfw ? FLAG_NSFW : 0) |
+                        (ext.hasConfigurableSources ? FLAG_CONFIGURABLE : 0);
+        appendRaw<uint8_t>(out, flags);
+    }
+
+    appendRaw<uint32_t>(out, static_cast<uint32_t>(m_groups.size()));
+    for (const auto& group : m_groups) {
+        appendString(out, group.lang);
+        appendRaw<uint32_t>(out, static_cast<uint32_t>(group.members.size()));
+        for (int index : group.members) {
+            appendRaw<int32_t>(out, index);
+        }
+    }
+
+    platform::createDirRecursive(platform::path("cache"));
+    if (!platform::writeFile(getCatalogFilePath(), out)) {
+        brls::Logger::warning("ExtensionCatalog: Failed to write catalog");
+        return false;
+    }
+    return true;
+}
+
+bool ExtensionCatalog::load() {
+    std::vector<uint8_t> data = platform::readFile(getCatalogFilePath());
+    if (data.size() < sizeof(CATALOG_MAGIC) || std::memcmp(data.data(), CATALOG_MAGIC, sizeof(CATALOG_MAGIC)) != 0) {
+        return false;
+    }
+
+    size_t offset = sizeof(CATALOG_MAGIC);
+    uint32_t version = 0;
+    int64_t fetchedAt = 0;
+    uint32_t count = 0;
+    if (!readRaw(data, offset, version) || !readRaw(data, offset, fetchedAt) || !readRaw(data, offset, count)) {
+        return false;
+    }
+    if (count > (data.size() - offset) / MIN_EXTENSION_BYTES) {
+        brls::Logger::warning("ExtensionCatalog: Corrupt entry count {}, ignoring", count);
+        return false;
+    }
+
+    std::vector<Extension> entries;
+    entries.reserve(count);
+    for (uint32_t i = 0; i < count; i++) {
+        Extension ext;
+        int32_t versionCode = 0;
+        uint8_t flags = 0;
+        if (!readString(data, offset, ext.pkgName) || !readString(data, offset, ext.name) ||
+            !readString(data, offset, ext.lang) || !readString(data, offset, ext.versionName) ||
+            !readString(data, offset, ext.iconUrl) || !readRaw(data, offset, versionCode) ||
+            !readRaw(data, offset, flags)) {
+            brls::Logger::warning("ExtensionCatalog: Truncated catalog, ignoring");
+            return false;
+        }
+        ext.versionCode = versionCode;
+        ext.installed = (flags & FLAG_INSTALLED) != 0;
+        ext.hasUpdate = (flags & FLAG_HAS_UPDATE) != 0;
+        ext.obsolete = (flags & FLAG_OBSOLETE) != 0;
+        ext.isNsfw = (flags & FLAG_NSFW) != 0;
+        ext.hasConfigurableSources = (flags & FLAG_CONFIGURABLE) != 0;
+        entries.push_back(std::move(ext));
+    }
+
+    uint32_t groupCount = 0;
+    if (!readRaw(data, offset, groupCount)) return false;
+    if (groupCount > (data.size() - offset) / MIN_GROUP_BYTES) {
+        brls::Logger::warning("ExtensionCatalog: Corrupt group count {}, ignoring", groupCount);
+        return false;
+    }
+    std::vector<LanguageGroup> groups;
+    groups.reserve(groupCount);
+    for (uint32_t g = 0; g < groupCount; g++) {
+        LanguageGroup group;
+        uint32_t memberCount = 0;
+        if (!readString(data, offset, group.lang) || !readRaw(data, offset, memberCount) ||
+            offset + static_cast<size_t>(memberCount) * sizeof(int32_t) > data.size()) {
+            brls::Logger::warning("ExtensionCatalog: Truncated catalog, ignoring");
+            return false;
+        }
+        group.members.resize(memberCount);
+        for (auto& index : group.members) {
+            int32_t value = 0;
+            readRaw(data, offset, value);
+            if (value < 0 || value >= static_cast<int32_t>(entries.size())) return false;
+            index = value;
+        }
+        groups.push_back(std::move(group));
+    }
+
+    m_entries = std::move(entries);
+    m_groups = std::move(groups);
+    // Lookup and name postings are rebuilt; the grouping is used as stored
+    rebuildDerived(false);
+    m_version = version;
+    m_fetchedAt = fetchedAt;
+    return true;
+}
+
+} // namespace vitasuwayomi
@@ -20,6 +20,12 @@ static const char* USER_AGENT = "VitaSuwayomi/" VITA_SUWAYOMI_VERSION;
 struct WriteCallbackData {
     std::string* buffer;
     int64_t totalSize;
+    size_t maxBytes = 0;
+    bool truncated = false;
+    void* curl = nullptr;
+    const BodyProgressCallback* onProgress = nullptr;
+    bool progressStarted = false;
+    bool progressStopped = false;
 };
 
 bool HttpClient::globalInit() {
@@ -80,6 +86,20 @@ size_t HttpClient::writeCallback(void* contents, size_t size, size_t nmemb, void
 
     if (data && data->buffer) {
         data->buffer->append((char*)contents, totalSize);
+        if (data->onProgress && !data->progressStopped) {
+            // Redirect and error bodies are not what the caller is decoding
+            long httpCode = 0;
+            curl_easy_getinfo((CURL*)data->curl, CURLINFO_RESPONSE_CODE, &httpCode);
+            if (httpCode >= 200 && httpCode < 300) {
+                bool fresh = !data->progressStarted;
+                data->progressStarted = true;
+                if (!(*data->onProgress)(*data->buffer, fresh)) data->progressStopped = true;
+            }
+        }
+        if (data->maxBytes > 0 && data->buffer->size() >= data->maxBytes) {
+            data->truncated = true;
+            return 0;  // Have what the caller asked for: abort the transfer
+        }
     }
 
     return totalSize;
@@ -181,10 +201,19 @@ HttpResponse HttpClient::request(const HttpRequest& req) {
     curl_easy_setopt(curl, CURLOPT_USERAGENT, m_userAgent.c_str());
 
     // Response buffer - pre-allocate to reduce reallocations during download
-    response.body.reserve(32 * 1024);
+    response.body.reserve(req.maxBytes > 0 ? req.maxBytes : 32 * 1024);
     WriteCallbackData writeData;
     writeData.buffer = &response.body;
     writeData.totalSize = 0;
+    writeData.maxBytes = req.maxBytes;
+    writeData.curl = curl;
+    if (req.onBodyProgress) writeData.onProgress = &req.onBodyProgress;
+
+    std::string range;
+    if (req.maxBytes > 0) {
+        range = "0-" + std::to_string(req.maxBytes - 1);
+        curl_easy_setopt(curl, CURLOPT_RANGE, range.c_str());
+    }
 
     curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, writeCallback);
     curl_easy_setopt(curl, CURLOPT_WRITEDATA, &writeData);
@@ -244,8 +273,8 @@ HttpResponse HttpClient::request(const HttpRequest& req) {
         curl_slist_free_all(headerList);
     }
 
-    // Check result
-    if (res == CURLE_OK) {
+    // Check result (a transfer we cut off at maxBytes counts as complete)
+    if (res == CURLE_OK || (res == CURLE_WRITE_ERROR && writeData.truncated)) {
         long httpCode;
         curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &httpCode);
         response.statusCode = (int)httpCode;
@@ -320,6 +349,14 @@ std::string HttpClient::urlDecode(const std::string& str) {
     return decoded;
 }
 
+HttpResponse HttpClient::getPrefix(const std::string& url, size_t maxBytes) {
+    HttpRequest req;
+    req.url = url;
+    req.method = "GET";
+    req.maxBytes = maxBytes;
+    return request(req);
+}
+
 bool HttpClient::get(const std::string& url, std::string& response) {
     HttpResponse res = get(url);
     if (res.success) {
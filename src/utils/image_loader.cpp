@@ -5,17 +5,25 @@
  */
 
 #include "utils/image_loader.hpp"
+#include "utils/image_pipeline.hpp"
 #include "utils/perf_overlay.hpp"
+#include "utils/texture_residency.hpp"
+#include "utils/perf_trace.hpp"
 #include "utils/http_client.hpp"
 #include "utils/library_cache.hpp"
 #include "app/suwayomi_client.hpp"
 #include "app/application.hpp"
+#include "app/endpoint_selector.hpp"
 
 // WebP decoding support
 #include <webp/decode.h>
 #include <cctype>
 #include <cstring>
 #include <cmath>
+#include <cstdlib>
+#include <algorithm>
+#include <bitset>
+#include <unordered_map>
 #include <new>
 #include <thread>
 #include <chrono>
@@ -27,6 +35,15 @@
 
 #include "platform/paths.hpp"
 
+// SIMD row scan for border cropping (Vita is Cortex-A9 with NEON)
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define VITASUWAYOMI_CROP_NEON 1
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define VITASUWAYOMI_CROP_SSE2 1
+#endif
+
 // stb_image for JPEG/PNG decoding
 // Note: stb_image.h should be available from borealis/extern or nanovg
 // If not found, you may need to add it to the project
@@ -68,11 +85,23 @@ namespace vitasuwayomi {
 
 // Static member initialization
 std::list<ImageLoader::CacheEntry> ImageLoader::s_cacheList;
-std::map<std::string, std::list<ImageLoader::CacheEntry>::iterator> ImageLoader::s_cacheMap;
+std::unordered_map<std::string, std::list<ImageLoader::CacheEntry>::iterator> ImageLoader::s_cacheMap;
 size_t ImageLoader::s_maxCacheSize = 30;  // LRU cache: 30 entries to limit PS Vita memory usage
 size_t ImageLoader::s_currentCacheMemory = 0;
 static const size_t MAX_CACHE_MEMORY = 20 * 1024 * 1024;  // 20MB max cache memory (reduced from 25MB to prevent OOM with animated WebP pages)
 std::mutex ImageLoader::s_cacheMutex;
+std::list<ImageLoader::RGBAEntry> ImageLoader::s_rgbaList;
+std::unordered_map<std::string, std::list<ImageLoader::RGBAEntry>::iterator> ImageLoader::s_rgbaMap;
+size_t ImageLoader::s_rgbaMemory = 0;
+static const size_t RGBA_CACHE_BUDGET = 6 * 1024 * 1024;  // ~75 covers at the default thumbnail size
+std::mutex ImageLoader::s_rgbaMutex;
+std::vector<ImageLoader::PageRingSlot> ImageLoader::s_pageRing;
+std::mutex ImageLoader::s_pageRingMutex;
+// Decoded bytes the page ring may hold on top of MAX_CACHE_MEMORY. Slots
+// furthest down the window give way first; under memory pressure the ring
+// shrinks to the current and next page within half the budget.
+static const size_t PAGE_RING_BUDGET = 16 * 1024 * 1024;
+static constexpr size_t PAGE_RING_PRESSURE_SLOTS = 2;
 std::string ImageLoader::s_authUsername;
 std::string ImageLoader::s_authPassword;
 std::string ImageLoader::s_accessToken;
@@ -148,6 +177,18 @@ static void trackDecodeSuccess() {
     s_consecutiveDecodeFailures.store(0);
 }
 
+// Smoothed wall time (queue pickup -> decoded TGA) of full-size page loads.
+// Seeded with a typical Vita download+decode so the webtoon prefetch window
+// is sensible before the first page has been measured.
+static std::atomic<int> s_avgFullSizeLoadMs{250};
+
+// Fold one full-size load time into the running average (EWMA, alpha 1/4).
+static void recordFullSizeLoadTime(long long ms) {
+    int sample = static_cast<int>(std::max(0LL, std::min(ms, 10000LL)));
+    int prev = s_avgFullSizeLoadMs.load();
+    s_avgFullSizeLoadMs.store(prev + (sample - prev) / 4);
+}
+
 // Check whether we are in an OOM cooldown period (decrements the counter).
 static bool isUnderMemoryPressure() {
     int frames = s_oomCooldownFrames.load();
@@ -158,6 +199,11 @@ static bool isUnderMemoryPressure() {
     return false;
 }
 
+// Like isUnderMemoryPressure, without consuming a cooldown frame
+static bool inMemoryCooldown() {
+    return s_oomCooldownFrames.load() > 0;
+}
+
 // Helper to extract manga ID, chapter index, and page index from a reader page URL
 // URLs look like: http://server/api/v1/manga/622/chapter/75/page/0
 // Returns true if all three values were extracted
@@ -283,8 +329,8 @@ static void writeTGAHeader(uint8_t* header, int width, int height) {
 // Fused downscale + RGBA→BGRA swizzle in a single pass (avoids separate
 // downscaleRGBA + createTGAFromRGBA which touches every pixel twice).
 // Writes directly into a TGA buffer (18-byte header + BGRA pixel data).
-static std::vector<uint8_t> downscaleRGBAtoTGA(const uint8_t* src, int srcW, int srcH,
-                                                int dstW, int dstH) {
+std::vector<uint8_t> downscaleRGBAtoTGA(const uint8_t* src, int srcW, int srcH,
+                                         int dstW, int dstH) {
     if (!src || srcW <= 0 || srcH <= 0 || dstW <= 0 || dstH <= 0) return {};
     size_t imageSize = (size_t)dstW * dstH * 4;
     if (imageSize > 256 * 1024 * 1024) return {};
@@ -406,6 +452,234 @@ static std::vector<uint8_t> createTGAFromBGRA(const uint8_t* bgra, int width, in
     return tgaData;
 }
 
+// Turn a decoded TGA back into RGBA for the decoded tier. Our own 32-bit
+// top-left layout is a plain swizzle; anything else goes through stb_image.
+static bool tgaToRGBA(const std::vector<uint8_t>& tga, std::vector<uint8_t>& rgba, int& width, int& height) {
+    try {
+        if (tga.size() > 18 && tga[1] == 0 && tga[2] == 2 && tga[16] == 32 && (tga[17] & 0x20)) {
+            width = tga[12] | (tga[13] << 8);
+            height = tga[14] | (tga[15] << 8);
+            size_t pixels = static_cast<size_t>(width) * height;
+            size_t offset = 18 + tga[0];
+            if (width > 0 && height > 0 && tga.size() >= offset + pixels * 4) {
+                rgba.resize(pixels * 4);
+                const uint8_t* src = tga.data() + offset;
+                uint8_t* dst = rgba.data();
+                for (size_t i = 0; i < pixels; i++, src += 4, dst += 4) {
+                    dst[0] = src[2];
+                    dst[1] = src[1];
+                    dst[2] = src[0];
+                    dst[3] = src[3];
+                }
+                return true;
+            }
+        }
+
+        int channels;
+        uint8_t* px = stbi_load_from_memory(tga.data(), static_cast<int>(tga.size()), &width, &height, &channels, 4);
+        if (!px) return false;
+        rgba.assign(px, px + static_cast<size_t>(width) * height * 4);
+        stbi_image_free(px);
+        return true;
+    } catch (const std::bad_alloc&) {
+        signalOOM("tgaToRGBA");
+        return false;
+    }
+}
+
+// Border cropping (ReaderSettings::cropBorders)
+// Pages are scanned for uniform white/black margins right after decode so
+// the margins never reach a texture. The scan works on 4-byte pixels with
+// alpha ignored and R/B treated alike, so it runs unchanged on RGBA (stb)
+// and BGRA (WebP/TGA) buffers.
+
+static std::atomic<bool> s_cropBorders{false};
+
+// Crop rectangle as fractions of the page, so one detection applies to any
+// decode size (full-res RGBA, downscaled TGA, disk-cached TGA).
+struct CropRect {
+    float left = 0.0f, top = 0.0f, right = 1.0f, bottom = 1.0f;
+    bool isFull() const { return left <= 0.0f && top <= 0.0f && right >= 1.0f && bottom >= 1.0f; }
+};
+
+// Per-page crop cache keyed by page URL: re-reading a page (or re-decoding
+// it after LRU eviction) skips detection entirely.
+static std::unordered_map<std::string, CropRect> s_cropCache;
+static std::mutex s_cropCacheMutex;
+static constexpr size_t MAX_CROP_CACHE_ENTRIES = 1024;
+
+static constexpr int CROP_TOLERANCE = 28;        // Per-channel distance still counted as margin
+static constexpr int CROP_NOISE_PER_MILLE = 5;   // Stray pixels a margin line may contain (JPEG noise, dust)
+static constexpr int CROP_PADDING = 2;           // Pixels kept around detected content
+static constexpr int CROP_SAMPLE_ROWS = 256;     // Rows sampled for the left/right column scan
+
+static inline bool isContentPixel(const uint8_t* p, const uint8_t* ref) {
+    return std::abs(p[0] - ref[0]) > CROP_TOLERANCE ||
+           std::abs(p[1] - ref[1]) > CROP_TOLERANCE ||
+           std::abs(p[2] - ref[2]) > CROP_TOLERANCE;
+}
+
+// Count pixels in a contiguous run that differ from ref by more than
+// CROP_TOLERANCE in any colour channel. Four pixels per vector step.
+static int countContentPixels(const uint8_t* px, int count, const uint8_t* ref) {
+    int content = 0;
+    int i = 0;
+#if defined(VITASUWAYOMI_CROP_NEON)
+    const uint8_t refBytes[16] = {ref[0], ref[1], ref[2], 0, ref[0], ref[1], ref[2], 0,
+                                  ref[0], ref[1], ref[2], 0, ref[0], ref[1], ref[2], 0};
+    const uint8_t tolBytes[16] = {CROP_TOLERANCE, CROP_TOLERANCE, CROP_TOLERANCE, 255,
+                                  CROP_TOLERANCE, CROP_TOLERANCE, CROP_TOLERANCE, 255,
+                                  CROP_TOLERANCE, CROP_TOLERANCE, CROP_TOLERANCE, 255,
+                                  CROP_TOLERANCE, CROP_TOLERANCE, CROP_TOLERANCE, 255};
+    const uint8x16_t vref = vld1q_u8(refBytes);
+    const uint8x16_t vtol = vld1q_u8(tolBytes);
+    uint32x4_t acc = vdupq_n_u32(0);
+    for (; i + 4 <= count; i += 4) {
+        uint8x16_t over = vqsubq_u8(vabdq_u8(vld1q_u8(px + i * 4), vref), vtol);
+        // A pixel is margin when all of its (saturated) channel excesses are zero
+        uint32x4_t isMargin = vceqq_u32(vreinterpretq_u32_u8(over), vdupq_n_u32(0));
+        acc = vaddq_u32(acc, vshrq_n_u32(vmvnq_u32(isMargin), 31));
+    }
+    uint64x2_t acc64 = vpaddlq_u32(acc);
+    content += static_cast<int>(vgetq_lane_u64(acc64, 0) + vgetq_lane_u64(acc64, 1));
+#elif defined(VITASUWAYOMI_CROP_SSE2)
+    const __m128i vref = _mm_setr_epi8(ref[0], ref[1], ref[2], 0, ref[0], ref[1], ref[2], 0,
+                                       ref[0], ref[1], ref[2], 0, ref[0], ref[1], ref[2], 0);
+    const __m128i vtol = _mm_setr_epi8(CROP_TOLERANCE, CROP_TOLERANCE, CROP_TOLERANCE, (char)255,
+                                       CROP_TOLERANCE, CROP_TOLERANCE, CROP_TOLERANCE, (char)255,
+                                       CROP_TOLERANCE, CROP_TOLERANCE, CROP_TOLERANCE, (char)255,
+                                       CROP_TOLERANCE, CROP_TOLERANCE, CROP_TOLERANCE, (char)255);
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 4 <= count; i += 4) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(px + i * 4));
+        __m128i diff = _mm_or_si128(_mm_subs_epu8(v, vref), _mm_subs_epu8(vref, v));
+        __m128i over = _mm_subs_epu8(diff, vtol);
+        int marginMask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(over, zero)));
+        content += 4 - static_cast<int>(std::bitset<4>(marginMask).count());
+    }
+#endif
+    for (; i < count; i++) {
+        if (isContentPixel(px + i * 4, ref)) content++;
+    }
+    return content;
+}
+
+// Find the content rectangle inside uniform white/black margins.
+// Returns false (no crop) when the edges aren't a plain light/dark colour or
+// the result would drop more than half the page in either direction, which
+// almost always means a full-bleed or mostly-blank page.
+static bool detectContentBounds(const uint8_t* px, int width, int height, CropRect& out) {
+    if (!px || width < 16 || height < 16) return false;
+
+    // Margin colour comes from the top-left pixel and must be near white/black
+    const uint8_t* ref = px;
+    int lo = std::min({ref[0], ref[1], ref[2]});
+    int hi = std::max({ref[0], ref[1], ref[2]});
+    if (!(lo >= 200 || hi <= 55)) return false;
+
+    const size_t stride = static_cast<size_t>(width) * 4;
+    const int rowNoise = std::max(1, width * CROP_NOISE_PER_MILLE / 1000);
+
+    int top = 0;
+    while (top < height / 2 && countContentPixels(px + top * stride, width, ref) <= rowNoise) top++;
+    int bottom = height - 1;
+    while (bottom > height / 2 && countContentPixels(px + bottom * stride, width, ref) <= rowNoise) bottom--;
+    if (top >= height / 2 || bottom - top + 1 < height / 2) return false;
+
+    // Columns are strided, so scan a sample of rows inside the content band
+    int rowStep = std::max(1, (bottom - top + 1) / CROP_SAMPLE_ROWS);
+    int sampled = (bottom - top) / rowStep + 1;
+    int colNoise = std::max(1, sampled * CROP_NOISE_PER_MILLE / 1000);
+    auto columnContent = [&](int x) {
+        int n = 0;
+        for (int y = top; y <= bottom; y += rowStep) {
+            if (isContentPixel(px + y * stride + x * 4, ref)) n++;
+        }
+        return n;
+    };
+    int left = 0;
+    while (left < width / 2 && columnContent(left) <= colNoise) left++;
+    int right = width - 1;
+    while (right > width / 2 && columnContent(right) <= colNoise) right--;
+    if (left >= width / 2 || right - left + 1 < width / 2) return false;
+
+    top = std::max(0, top - CROP_PADDING);
+    left = std::max(0, left - CROP_PADDING);
+    bottom = std::min(height - 1, bottom + CROP_PADDING);
+    right = std::min(width - 1, right + CROP_PADDING);
+
+    out.left = (float)left / width;
+    out.top = (float)top / height;
+    out.right = (float)(right + 1) / width;
+    out.bottom = (float)(bottom + 1) / height;
+    return true;
+}
+
+// Look up (or detect and remember) the crop rectangle for a page.
+// An empty key disables cropping; a full rect means "nothing to crop".
+static CropRect getCropRect(const std::string& key, const uint8_t* px, int width, int height) {
+    CropRect rect;
+    if (key.empty()) return rect;
+    {
+        std::lock_guard<std::mutex> lock(s_cropCacheMutex);
+        auto it = s_cropCache.find(key);
+        if (it != s_cropCache.end()) return it->second;
+    }
+    if (!detectContentBounds(px, width, height, rect)) rect = CropRect();
+    {
+        std::lock_guard<std::mutex> lock(s_cropCacheMutex);
+        if (s_cropCache.size() >= MAX_CROP_CACHE_ENTRIES) s_cropCache.clear();
+        s_cropCache[key] = rect;
+    }
+    return rect;
+}
+
+// Crop a tightly packed 4-byte-per-pixel buffer in place by compacting the
+// kept rows to the front. Returns the new dimensions via width/height.
+static void cropPixelsInPlace(uint8_t* px, int& width, int& height, const CropRect& rect) {
+    int x0 = std::max(0, std::min(width - 1, (int)(rect.left * width)));
+    int y0 = std::max(0, std::min(height - 1, (int)(rect.top * height)));
+    int x1 = std::max(x0 + 1, std::min(width, (int)std::ceil(rect.right * width)));
+    int y1 = std::max(y0 + 1, std::min(height, (int)std::ceil(rect.bottom * height)));
+    int newW = x1 - x0;
+    int newH = y1 - y0;
+    if (newW == width && newH == height) return;
+    for (int y = 0; y < newH; y++) {
+        memmove(px + (size_t)y * newW * 4, px + ((size_t)(y + y0) * width + x0) * 4, (size_t)newW * 4);
+    }
+    width = newW;
+    height = newH;
+}
+
+// Apply border cropping to a decoded TGA (top-left origin, 32-bit). Used for
+// formats whose decoders emit TGA directly (WebP, GIF, disk-cached pages).
+static void cropTGABorders(std::vector<uint8_t>& tga, const std::string& key) {
+    if (key.empty() || tga.size() < 18) return;
+    if (tga[0] != 0 || tga[2] != 2 || tga[16] != 32 || !(tga[17] & 0x20)) return;
+    int w = tga[12] | (tga[13] << 8);
+    int h = tga[14] | (tga[15] << 8);
+    if (w <= 0 || h <= 0 || tga.size() < 18 + (size_t)w * h * 4) return;
+
+    CropRect rect = getCropRect(key, tga.data() + 18, w, h);
+    if (rect.isFull()) return;
+    cropPixelsInPlace(tga.data() + 18, w, h, rect);
+    writeTGAHeader(tga.data(), w, h);
+    tga.resize(18 + (size_t)w * h * 4);
+}
+
+// LRU key for a full-size reader page. Cropped and uncropped decodes of the
+// same URL are distinct entries so toggling the setting takes effect at once.
+// Keys are full URLs, so a local/remote endpoint switch misses this session's
+// in-memory tiers once; the on-disk caches are keyed by id and carry over.
+static std::string fullSizeCacheKey(const std::string& url) {
+    return s_cropBorders.load() ? url + "_full_crop" : url + "_full";
+}
+
+// Header bytes read to find an image's dimensions, and the most a JPEG with
+// large metadata segments may take before falling back to the whole file
+static constexpr size_t DIMENSION_PROBE_BYTES = 16 * 1024;
+static constexpr size_t DIMENSION_PROBE_MAX_BYTES = 256 * 1024;
+
 // Get WebP image dimensions without decoding
 static bool getWebPDimensions(const uint8_t* webpData, size_t webpSize, int& width, int& height) {
     return WebPGetInfo(webpData, webpSize, &width, &height) != 0;
@@ -696,7 +970,7 @@ static std::vector<uint8_t> extractFirstFrameFromGIF(const uint8_t* data, size_t
 // This decoder parses the GIF binary format and uses an iterative LZW decompressor.
 // Input: raw GIF file data (full file or extracted first frame).
 // Output: TGA image data ready for texture upload, or empty vector on failure.
-static std::vector<uint8_t> decodeGIFToTGA(const uint8_t* data, size_t size, int maxSize) {
+std::vector<uint8_t> decodeGIFToTGA(const uint8_t* data, size_t size, int maxSize) {
     if (size < 13 || memcmp(data, "GIF", 3) != 0) return {};
 
     // Parse Logical Screen Descriptor
@@ -1018,7 +1292,7 @@ static std::vector<uint8_t> decodeGIFToTGA(const uint8_t* data, size_t size, int
 }
 
 // Calculate number of segments needed for a tall image
-static int calculateSegments(int width, int height, int maxSize) {
+int calculateSegments(int width, int height, int maxSize) {
     if (height <= maxSize) return 1;
     // Split based on height, keeping each segment within maxSize
     return (height + maxSize - 1) / maxSize;
@@ -1026,8 +1300,9 @@ static int calculateSegments(int width, int height, int maxSize) {
 
 // Convert WebP to TGA for a specific segment of a tall image
 // Uses WebPDecode with crop + scale to avoid allocating the full image buffer
-static std::vector<uint8_t> convertWebPtoTGASegment(const uint8_t* webpData, size_t webpSize,
-                                                     int segment, int totalSegments, int maxSize) {
+std::vector<uint8_t> convertWebPtoTGASegment(const uint8_t* webpData, size_t webpSize,
+                                              int segment, int totalSegments, int maxSize) {
+    PERF_TRACE_SCOPE("webp_decode_segment");
     if (totalSegments < 1 || segment < 0 || segment >= totalSegments) return {};
 
     WebPBitstreamFeatures features;
@@ -1101,9 +1376,192 @@ static std::vector<uint8_t> convertWebPtoTGASegment(const uint8_t* webpData, siz
     return tgaData;
 }
 
+// Segment count for auto-splitting a tall page (1 = keep it one texture),
+// with the segment width that keeps the whole page inside the VRAM budget.
+// Only pages MUCH taller than a texture are split (webtoon-style); normal
+// pages slightly taller than max scale into one texture faster.
+static int planAutoSplit(int origW, int origH, int maxTextureSize, int& segMaxSize) {
+    segMaxSize = maxTextureSize;
+    if (origW <= 0 || origH <= maxTextureSize * 2) return 1;
+
+    // The segment decode scales both dims proportionally when width > maxSize,
+    // so total VRAM = maxSize² * origH / origW * 4.
+    // Solve for maxSize: maxSize = sqrt(budget * origW / (origH * 4))
+    const int MAX_VRAM_PER_IMAGE = 16 * 1024 * 1024;  // 16MB
+    long long totalUnscaledBytes = (long long)origW * origH * 4;
+    if (totalUnscaledBytes > MAX_VRAM_PER_IMAGE) {
+        float maxSizeF = std::sqrt((float)MAX_VRAM_PER_IMAGE * origW / ((float)origH * 4.0f));
+        segMaxSize = std::max(256, std::min((int)maxSizeF, maxTextureSize));
+        brls::Logger::info("ImageLoader: VRAM budget {}x{} -> maxWidth={}", origW, origH, segMaxSize);
+    }
+    return (origH + maxTextureSize - 1) / maxTextureSize;
+}
+
+// Compact metadata cached under an auto-split page's main key, so that
+// loadAsyncFullSize can reconstruct it from the cached segments.
+// Format: "ASEG" + uint16 count + uint16 origW + uint16 origH + uint16[] segHeights
+static std::vector<uint8_t> buildAutoSplitMeta(int origW, int origH, const std::vector<int>& segHeights) {
+    std::vector<uint8_t> meta(4 + 2 + 2 + 2 + 2 * segHeights.size());
+    meta[0] = 'A'; meta[1] = 'S'; meta[2] = 'E'; meta[3] = 'G';
+    uint16_t cnt = static_cast<uint16_t>(segHeights.size());
+    uint16_t mw = static_cast<uint16_t>(std::min(origW, 65535));
+    uint16_t mh = static_cast<uint16_t>(std::min(origH, 65535));
+    memcpy(&meta[4], &cnt, 2);
+    memcpy(&meta[6], &mw, 2);
+    memcpy(&meta[8], &mh, 2);
+    for (size_t s = 0; s < segHeights.size(); s++) {
+        uint16_t sh = static_cast<uint16_t>(segHeights[s]);
+        memcpy(&meta[10 + s * 2], &sh, 2);
+    }
+    return meta;
+}
+
+// Incremental decode of an auto-split WebP page. Fed the bytes received so
+// far, it decodes only the new rows, scaled once to the segment width, and
+// hands out each segment as soon as its last row is done. A long strip's
+// top reaches the upload queue while the rest is still downloading, and no
+// row is decoded twice (the crop decode re-decodes from the top per segment).
+class WebPSegmentStream {
+public:
+    explicit WebPSegmentStream(int maxTextureSize) : m_maxTextureSize(maxTextureSize) {}
+    ~WebPSegmentStream() { reset(); }
+    WebPSegmentStream(const WebPSegmentStream&) = delete;
+    WebPSegmentStream& operator=(const WebPSegmentStream&) = delete;
+
+    // data holds everything from the first byte and may move between calls.
+    // False if this is not a tall still WebP or decoding failed.
+    bool update(const uint8_t* data, size_t size);
+
+    // Move out the segments finished since the last call
+    void takeReady(std::vector<std::vector<uint8_t>>& segments, std::vector<int>& srcHeights) {
+        for (auto& seg : m_ready) segments.push_back(std::move(seg));
+        srcHeights.insert(srcHeights.end(), m_readyHeights.begin(), m_readyHeights.end());
+        m_ready.clear();
+        m_readyHeights.clear();
+    }
+
+    bool done() const { return m_segments > 1 && m_nextSegment >= m_segments; }
+    int emittedSegments() const { return m_nextSegment; }
+    int origWidth() const { return m_origW; }
+    int origHeight() const { return m_origH; }
+    int segments() const { return m_segments; }
+
+    // Start over, e.g. for a retried download
+    void reset() {
+        releaseDecoder();
+        m_ready.clear();
+        m_readyHeights.clear();
+        m_failed = false;
+        m_segments = 0;
+        m_nextSegment = 0;
+    }
+
+private:
+    bool fail() {
+        releaseDecoder();
+        m_failed = true;
+        return false;
+    }
+
+    void releaseDecoder() {
+        if (!m_idec) return;
+        WebPIDelete(m_idec);
+        WebPFreeDecBuffer(&m_config.output);
+        m_idec = nullptr;
+    }
+
+    int m_maxTextureSize;
+    WebPDecoderConfig m_config;  // Must outlive m_idec, which points into it
+    WebPIDecoder* m_idec = nullptr;
+    bool m_failed = false;
+    int m_origW = 0, m_origH = 0;
+    int m_outW = 0, m_outH = 0;
+    int m_segments = 0;
+    int m_nextSegment = 0;
+    std::vector<std::vector<uint8_t>> m_ready;
+    std::vector<int> m_readyHeights;
+};
+
+bool WebPSegmentStream::update(const uint8_t* data, size_t size) {
+    if (m_failed) return false;
+    if (done()) return true;
+
+    if (!m_idec) {
+        WebPBitstreamFeatures features;
+        VP8StatusCode status = WebPGetFeatures(data, size, &features);
+        if (status == VP8_STATUS_NOT_ENOUGH_DATA) return true;  // Header not complete yet
+        if (status != VP8_STATUS_OK || features.has_animation) return fail();
+
+        int segMaxSize = 0;
+        int segments = planAutoSplit(features.width, features.height, m_maxTextureSize, segMaxSize);
+        if (segments <= 1) return fail();
+
+        m_origW = features.width;
+        m_origH = features.height;
+        m_segments = segments;
+        m_outW = std::min(m_origW, segMaxSize);
+        m_outH = std::max(1, static_cast<int>((long long)m_origH * m_outW / m_origW));
+
+        if (!WebPInitDecoderConfig(&m_config)) return fail();
+        // Same reduced-memory options as the segment decode
+        m_config.options.bypass_filtering = 1;
+        m_config.options.no_fancy_upsampling = 1;
+        if (m_outW != m_origW) {
+            m_config.options.use_scaling = 1;
+            m_config.options.scaled_width = m_outW;
+            m_config.options.scaled_height = m_outH;
+        }
+        m_config.output.colorspace = MODE_BGRA;
+
+        m_idec = WebPIDecode(data, size, &m_config);
+        if (!m_idec) return fail();
+    }
+
+    VP8StatusCode status = WebPIUpdate(m_idec, data, size);
+    if (status != VP8_STATUS_OK && status != VP8_STATUS_SUSPENDED) {
+        if (status == VP8_STATUS_OUT_OF_MEMORY) signalOOM("WebPIUpdate");
+        brls::Logger::error("ImageLoader: Incremental WebP decode failed (status={}) at seg {}/{}",
+                            static_cast<int>(status), m_nextSegment + 1, m_segments);
+        return fail();
+    }
+
+    int lastY = 0, width = 0, height = 0, stride = 0;
+    uint8_t* bgra = WebPIDecGetRGB(m_idec, &lastY, &width, &height, &stride);
+    if (!bgra) return true;  // No rows yet
+    if (width != m_outW || height != m_outH || stride != m_outW * 4) return fail();
+    if (status == VP8_STATUS_OK) lastY = height;
+
+    int segH = (m_origH + m_segments - 1) / m_segments;
+    while (m_nextSegment < m_segments) {
+        int startY = m_nextSegment * segH;
+        int endY = std::min(startY + segH, m_origH);
+        if (endY <= startY) return fail();
+        int outStart = static_cast<int>((long long)startY * m_outH / m_origH);
+        int outEnd = (m_nextSegment == m_segments - 1)
+            ? m_outH : static_cast<int>((long long)endY * m_outH / m_origH);
+        outEnd = std::min(m_outH, std::max(outEnd, outStart + 1));
+        if (lastY < outEnd) break;
+
+        auto tga = createTGAFromBGRA(bgra + static_cast<size_t>(outStart) * stride, m_outW, outEnd - outStart);
+        if (tga.empty()) return fail();
+        m_ready.push_back(std::move(tga));
+        m_readyHeights.push_back(endY - startY);
+        m_nextSegment++;
+    }
+
+    // Everything is handed out: drop the decoder and its full-page buffer now
+    if (done()) releaseDecoder();
+    return true;
+}
+
+// Streaming decodes hold their output buffer for the whole download, so
+// only one runs at a time; other pages decode once they have arrived.
+static std::atomic<bool> s_webpStreamBusy{false};
+static std::atomic<uint64_t> s_nextSegmentStreamId{1};
+
 // Convert JPEG/PNG to TGA for a specific segment of a tall image (using stb_image)
-static std::vector<uint8_t> convertImageToTGASegment(const uint8_t* data, size_t dataSize,
-                                                      int segment, int totalSegments, int maxSize) {
+std::vector<uint8_t> convertImageToTGASegment(const uint8_t* data, size_t dataSize,
+                                               int segment, int totalSegments, int maxSize) {
     std::vector<uint8_t> tgaData;
 
     if (totalSegments < 1 || segment < 0 || segment >= totalSegments) return tgaData;
@@ -1189,6 +1647,7 @@ static bool convertImageToTGAAllSegments(const uint8_t* data, size_t dataSize,
                                           int totalSegments, int maxSize,
                                           std::vector<std::vector<uint8_t>>& segmentDatas,
                                           int& outWidth, int& outHeight) {
+    PERF_TRACE_SCOPE("decode_segments");
     segmentDatas.clear();
     outWidth = outHeight = 0;
 
@@ -1267,7 +1726,11 @@ static bool convertImageToTGAAllSegments(const uint8_t* data, size_t dataSize,
 }
 
 // Convert JPEG/PNG to TGA with optional downscaling (using stb_image)
-static std::vector<uint8_t> convertImageToTGA(const uint8_t* data, size_t dataSize, int maxSize) {
+// cropKey: when non-empty, uniform page margins are trimmed from the full
+// resolution RGBA before downscaling (detection result cached under cropKey).
+static std::vector<uint8_t> convertImageToTGA(const uint8_t* data, size_t dataSize, int maxSize,
+                                              const std::string& cropKey = std::string()) {
+    PERF_TRACE_SCOPE("decode");
     std::vector<uint8_t> tgaData;
 
     // Pre-check dimensions to prevent OOM crash on PS Vita.
@@ -1298,6 +1761,12 @@ static std::vector<uint8_t> convertImageToTGA(const uint8_t* data, size_t dataSi
         return tgaData;
     }
 
+    // Crop before downscaling so the kept content gets the full texture budget
+    if (!cropKey.empty()) {
+        CropRect rect = getCropRect(cropKey, rgba, width, height);
+        if (!rect.isFull()) cropPixelsInPlace(rgba, width, height, rect);
+    }
+
     int targetW = width;
     int targetH = height;
 
@@ -1447,6 +1916,7 @@ static std::vector<uint8_t> tryWebPDecode(const uint8_t* webpData, size_t webpSi
 //   3. On failure, retry at half the target size
 //   4. Try RGB colorspace (25% less memory) at each size
 static std::vector<uint8_t> convertWebPtoTGA(const uint8_t* webpData, size_t webpSize, int maxSize) {
+    PERF_TRACE_SCOPE("webp_decode");
     // Validate RIFF container integrity before spending time on decode
     bool isTruncated = false;
     if (!validateWebPContainer(webpData, webpSize, isTruncated)) {
@@ -1989,9 +2459,13 @@ static void applyAuthHeaders(HttpClient& client) {
 
 // Authenticated HTTP GET with automatic JWT token refresh on 401/403.
 // If the request fails due to an expired token, refreshes via SuwayomiClient
-// and retries once with the new token.
+// and retries once with the new token. maxBytes > 0 fetches only the start
+// of the body (see HttpClient::getPrefix); onProgress sees the body as it
+// arrives (fresh again on every retry).
 static HttpResponse authenticatedGet(const std::string& url, int maxRetries = 2,
-                                     HttpClient* existingClient = nullptr) {
+                                     HttpClient* existingClient = nullptr, size_t maxBytes = 0,
+                                     const BodyProgressCallback& onProgress = nullptr) {
+    PERF_TRACE_SCOPE("image_fetch");
     HttpClient tempClient;
     HttpClient& client = existingClient ? *existingClient : tempClient;
     if (!existingClient) {
@@ -2001,14 +2475,38 @@ static HttpResponse authenticatedGet(const std::string& url, int maxRetries = 2,
     HttpResponse resp;
     bool success = false;
     bool tokenRefreshed = false;
+    std::string requestUrl = url;
+    bool failedOver = false;
 
     for (int attempt = 0; attempt <= maxRetries && !success; attempt++) {
         if (attempt > 0) {
-            brls::Logger::debug("ImageLoader: Retry {} for {}", attempt, url);
+            brls::Logger::debug("ImageLoader: Retry {} for {}", attempt, requestUrl);
             std::this_thread::sleep_for(std::chrono::milliseconds(1000 * attempt));
         }
 
-        resp = client.get(url);
+        if (maxBytes > 0) {
+            resp = client.getPrefix(requestUrl, maxBytes);
+        } else if (onProgress) {
+            HttpRequest req;
+            req.url = requestUrl;
+            req.onBodyProgress = onProgress;
+            resp = client.request(req);
+        } else {
+            resp = client.get(requestUrl);
+        }
+
+        // Endpoint unreachable: move to the other server URL before spending
+        // the retries. The caller still caches under the original URL.
+        if (resp.statusCode == 0 && !failedOver) {
+            std::string alternateUrl = EndpointSelector::getInstance().failoverUrl(requestUrl);
+            if (!alternateUrl.empty()) {
+                brls::Logger::info("ImageLoader: {} unreachable, retrying on {}", requestUrl, alternateUrl);
+                requestUrl = alternateUrl;
+                failedOver = true;
+                attempt--;
+                continue;
+            }
+        }
 
         // Check for auth failure (401 Unauthorized or 403 Forbidden)
         if ((resp.statusCode == 401 || resp.statusCode == 403) && !tokenRefreshed) {
@@ -2055,6 +2553,17 @@ void ImageLoader::setDeferTextureUploads(bool defer) {
     }
 }
 
+void ImageLoader::setCropBorders(bool enabled) {
+    // Ring pages were decoded under the old setting
+    if (s_cropBorders.exchange(enabled) != enabled) {
+        clearPageRing();
+    }
+}
+
+int ImageLoader::getAverageFullSizeLoadMs() {
+    return s_avgFullSizeLoadMs.load();
+}
+
 void ImageLoader::setMaxThumbnailSize(int maxSize) {
     s_maxThumbnailSize = maxSize > 0 ? maxSize : 0;
 }
@@ -2092,6 +2601,15 @@ void ImageLoader::cachePut(const std::string& url, const std::vector<uint8_t>& d
     s_currentCacheMemory += data.size();
 }
 
+void ImageLoader::cacheErase(const std::string& url) {
+    std::lock_guard<std::mutex> lock(s_cacheMutex);
+    auto it = s_cacheMap.find(url);
+    if (it == s_cacheMap.end()) return;
+    s_currentCacheMemory -= it->second->data.size();
+    s_cacheList.erase(it->second);
+    s_cacheMap.erase(it);
+}
+
 bool ImageLoader::cacheGet(const std::string& url, std::vector<uint8_t>& data) {
     std::lock_guard<std::mutex> lock(s_cacheMutex);
 
@@ -2106,11 +2624,62 @@ bool ImageLoader::cacheGet(const std::string& url, std::vector<uint8_t>& data) {
     return true;
 }
 
-void ImageLoader::queueTextureUpdate(const std::vector<uint8_t>& data, brls::Image* target, LoadCallback callback,
-                                     std::shared_ptr<bool> alive) {
+std::string ImageLoader::rgbaKey(const std::string& url, int maxSize) {
+    return url + "@" + std::to_string(maxSize);
+}
+
+void ImageLoader::rgbaPut(const std::string& key, const std::vector<uint8_t>& rgba, int width, int height) {
+    if (rgba.empty() || rgba.size() > RGBA_CACHE_BUDGET / 4) return;  // Not what this tier is for
+
+    std::lock_guard<std::mutex> lock(s_rgbaMutex);
+    auto it = s_rgbaMap.find(key);
+    if (it != s_rgbaMap.end()) {
+        s_rgbaMemory -= it->second->rgba.size();
+        s_rgbaList.erase(it->second);
+        s_rgbaMap.erase(it);
+    }
+
+    while (!s_rgbaList.empty() && s_rgbaMemory + rgba.size() > RGBA_CACHE_BUDGET) {
+        auto& oldest = s_rgbaList.back();
+        s_rgbaMemory -= oldest.rgba.size();
+        s_rgbaMap.erase(oldest.key);
+        s_rgbaList.pop_back();
+    }
+
+    s_rgbaList.push_front({key, rgba, width, height});
+    s_rgbaMap[key] = s_rgbaList.begin();
+    s_rgbaMemory += rgba.size();
+}
+
+bool ImageLoader::rgbaGet(const std::string& key, std::vector<uint8_t>& rgba, int& width, int& height) {
+    std::lock_guard<std::mutex> lock(s_rgbaMutex);
+    auto it = s_rgbaMap.find(key);
+    if (it == s_rgbaMap.end()) return false;
+
+    rgba = it->second->rgba;
+    width = it->second->width;
+    height = it->second->height;
+    s_rgbaList.splice(s_rgbaList.begin(), s_rgbaList, it->second);
+    return true;
+}
+
+bool ImageLoader::rgbaHas(const std::string& key) {
+    std::lock_guard<std::mutex> lock(s_rgbaMutex);
+    return s_rgbaMap.find(key) != s_rgbaMap.end();
+}
+
+void ImageLoader::queueTextureUpdate(std::vector<uint8_t> rgba, int width, int height, brls::Image* target,
+                                     LoadCallback callback, std::shared_ptr<bool> alive) {
     {
         std::lock_guard<std::mutex> lock(s_pendingMutex);
-        s_pendingTextures.push({data, target, callback, alive});
+        PendingTextureUpdate update;
+        update.rgba = std::move(rgba);
+        update.width = width;
+        update.height = height;
+        update.target = target;
+        update.callback = std::move(callback);
+        update.alive = std::move(alive);
+        s_pendingTextures.push(std::move(update));
     }
 
     // Schedule processing if not already scheduled
@@ -2123,6 +2692,7 @@ void ImageLoader::queueTextureUpdate(const std::vector<uint8_t>& data, brls::Ima
 }
 
 void ImageLoader::processPendingTextures() {
+    PERF_TRACE_SCOPE("thumb_upload");
     s_pendingScheduled = false;
 
     // If uploads are deferred (e.g. grid is actively scrolling), skip
@@ -2143,7 +2713,7 @@ void ImageLoader::processPendingTextures() {
     }
 
     // Process up to MAX_TEXTURES_PER_FRAME textures this frame, with a time budget.
-    // Each GPU texture upload (setImageFromMem) can take 15-20ms on PS Vita,
+    // Each GPU texture upload (setImageFromMemRGBA) can take 15-20ms on PS Vita,
     // so we also enforce a 8ms time limit to avoid blowing the 16.7ms frame budget.
     auto frameStart = std::chrono::steady_clock::now();
     static constexpr int64_t MAX_UPLOAD_TIME_US = 8000;  // 8ms time budget
@@ -2171,14 +2741,14 @@ void ImageLoader::processPendingTextures() {
                 continue;
             }
             // Skip empty data to avoid passing garbage to NVG
-            if (update.data.empty()) {
+            if (update.rgba.empty() || update.width <= 0 || update.height <= 0) {
                 continue;
             }
             // Re-check alive right before the actual GPU upload
             if (update.alive && !*update.alive) {
                 continue;
             }
-            update.target->setImageFromMem(update.data.data(), update.data.size());
+            update.target->setImageFromMemRGBA(update.rgba.data(), update.width, update.height);
             if (update.callback) update.callback(update.target);
         }
         processed++;
@@ -2211,19 +2781,12 @@ void ImageLoader::loadCoverAsync(const std::string& url, CoverReadyCallback call
                                   std::shared_ptr<bool> alive) {
     if (url.empty()) return;
 
-    // Memory cache: decode TGA→RGBA here (fast, <0.5ms for 120px thumbnails),
-    // then queue the RGBA for GPU upload on the next frame.
+    // Decoded tier: queue the RGBA for GPU upload on the next frame as is
     {
-        std::vector<uint8_t> cachedData;
-        if (cacheGet(url, cachedData)) {
-            int w, h, c;
-            uint8_t* rgba = stbi_load_from_memory(cachedData.data(),
-                static_cast<int>(cachedData.size()), &w, &h, &c, 4);
-            if (rgba) {
-                std::vector<uint8_t> rgbaVec(rgba, rgba + w * h * 4);
-                stbi_image_free(rgba);
-                queueCoverUpload(std::move(rgbaVec), w, h, std::move(callback), std::move(alive));
-            }
+        std::vector<uint8_t> rgba;
+        int w = 0, h = 0;
+        if (rgbaGet(rgbaKey(url, s_maxThumbnailSize), rgba, w, h)) {
+            queueCoverUpload(std::move(rgba), w, h, std::move(callback), std::move(alive));
             return;
         }
     }
@@ -2263,6 +2826,7 @@ void ImageLoader::queueCoverUpload(std::vector<uint8_t> rgbaData, int w, int h,
 }
 
 void ImageLoader::processPendingCovers() {
+    PERF_TRACE_SCOPE("cover_upload");
     s_pendingCoverScheduled = false;
 
     NVGcontext* vg = brls::Application::getNVGContext();
@@ -2281,6 +2845,7 @@ void ImageLoader::processPendingCovers() {
         if (upload.alive && !*upload.alive) continue;
         if (upload.rgbaData.empty() || upload.width <= 0 || upload.height <= 0) continue;
 
+        TextureResidency::getInstance().reserve(upload.rgbaData.size());
         int nvgImg = nvgCreateImageRGBA(vg, upload.width, upload.height,
                                          0, upload.rgbaData.data());
         if (nvgImg != 0 && upload.callback) {
@@ -2325,9 +2890,32 @@ void ImageLoader::queueRotatableTextureUpdate(const std::vector<uint8_t>& data,
     }
 }
 
+void ImageLoader::queueRotatableTextureUpdate(std::shared_ptr<const std::vector<uint8_t>> data,
+                                               RotatableImage* target, RotatableLoadCallback callback,
+                                               std::shared_ptr<bool> alive) {
+    {
+        std::lock_guard<std::mutex> lock(s_pendingRotatableMutex);
+        PendingRotatableTextureUpdate update;
+        update.sharedData = std::move(data);
+        update.target = target;
+        update.callback = callback;
+        update.alive = alive;
+        update.isSegmented = false;
+        s_pendingRotatableTextures.push(std::move(update));
+    }
+
+    bool expected = false;
+    if (s_pendingRotatableScheduled.compare_exchange_strong(expected, true)) {
+        brls::sync([]() {
+            processPendingRotatableTextures();
+        });
+    }
+}
+
 void ImageLoader::queueRotatableSegmentUpdate(std::vector<std::vector<uint8_t>> segDatas, int origW, int origH,
                                                std::vector<int> segHeights, RotatableImage* target,
-                                               RotatableLoadCallback callback, std::shared_ptr<bool> alive) {
+                                               RotatableLoadCallback callback, std::shared_ptr<bool> alive,
+                                               uint64_t streamId) {
     {
         std::lock_guard<std::mutex> lock(s_pendingRotatableMutex);
         PendingRotatableTextureUpdate update;
@@ -2335,6 +2923,7 @@ void ImageLoader::queueRotatableSegmentUpdate(std::vector<std::vector<uint8_t>>
         update.origW = origW;
         update.origH = origH;
         update.segHeights = std::move(segHeights);
+        update.streamId = streamId;
         update.target = target;
         update.callback = callback;
         update.alive = alive;
@@ -2350,7 +2939,31 @@ void ImageLoader::queueRotatableSegmentUpdate(std::vector<std::vector<uint8_t>>
     }
 }
 
+void ImageLoader::queueRotatableStreamUpdate(uint64_t streamId, std::vector<std::vector<uint8_t>> segDatas,
+                                              std::vector<int> segHeights, bool last, std::shared_ptr<bool> alive) {
+    {
+        std::lock_guard<std::mutex> lock(s_pendingRotatableMutex);
+        PendingRotatableTextureUpdate update;
+        update.segmentDatas = std::move(segDatas);
+        update.segHeights = std::move(segHeights);
+        update.isSegmented = true;
+        update.streamId = streamId;
+        update.streamAppend = true;
+        update.streamLast = last;
+        update.alive = alive;
+        s_pendingRotatableTextures.push(std::move(update));
+    }
+
+    bool expected = false;
+    if (s_pendingRotatableScheduled.compare_exchange_strong(expected, true)) {
+        brls::sync([]() {
+            processPendingRotatableTextures();
+        });
+    }
+}
+
 void ImageLoader::processPendingRotatableTextures() {
+    PERF_TRACE_SCOPE("page_upload");
     s_pendingRotatableScheduled = false;
 
     int processed = 0;
@@ -2368,39 +2981,67 @@ void ImageLoader::processPendingRotatableTextures() {
         PendingRotatableTextureUpdate update;
         {
             std::lock_guard<std::mutex> lock(s_pendingRotatableMutex);
-            if (s_pendingRotatableTextures.empty()) return;
+            if (s_pendingRotatableTextures.empty()) break;
             update = std::move(s_pendingRotatableTextures.front());
             s_pendingRotatableTextures.pop();
         }
 
+        if (update.streamAppend) {
+            // Only records the tiles, like the first update of the stream
+            if (!update.alive || *update.alive) {
+                RotatableImage::appendStreamSegments(update.streamId, std::move(update.segmentDatas),
+                                                     update.segHeights, update.streamLast);
+            }
+            continue;
+        }
+
         if (update.target) {
             if (update.alive && !*update.alive) {
                 continue;  // Owner destroyed, skip
             }
             // Skip empty data to avoid passing garbage to NVG
-            if (!update.isSegmented && update.data.empty()) {
+            if (!update.isSegmented && update.data.empty() &&
+                (!update.sharedData || update.sharedData->empty())) {
                 continue;
             }
-            auto uploadStart = std::chrono::steady_clock::now();
+            // Covers the handoff to the view: a single image's upload, or only
+            // recording a segmented one's tiles
+            auto handoffStart = std::chrono::steady_clock::now();
             if (update.isSegmented) {
-                update.target->setImageSegments(update.segmentDatas, update.origW, update.origH, update.segHeights);
+                // Only records the tiles; the uploads happen in the tile pump below
+                update.target->setImageSegments(std::move(update.segmentDatas), update.origW, update.origH,
+                                                update.segHeights, update.streamId);
             } else {
-                update.target->setImageFromMem(update.data.data(), update.data.size());
+                // Tall single textures are tiled as well (see setImageFromBuffer)
+                if (update.sharedData) {
+                    update.target->setImageFromBuffer(std::move(update.sharedData));
+                } else {
+                    update.target->setImageFromBuffer(std::move(update.data));
+                }
             }
-            auto uploadEnd = std::chrono::steady_clock::now();
-            auto uploadMs = std::chrono::duration_cast<std::chrono::milliseconds>(uploadEnd - uploadStart).count();
-            brls::Logger::debug("ImageLoader: [TIMING] GPU upload took {}ms ({})",
-                               uploadMs, update.isSegmented ? "segmented" : "single");
+            auto handoffEnd = std::chrono::steady_clock::now();
+            auto handoffMs = std::chrono::duration_cast<std::chrono::milliseconds>(handoffEnd - handoffStart).count();
+            brls::Logger::debug("ImageLoader: [TIMING] texture handoff took {}ms ({})",
+                               handoffMs, update.isSegmented ? "segmented" : "single");
             if (update.callback) update.callback(update.target);
+            if (update.isSegmented) continue;  // No GPU work done yet
         }
         processed++;
     }
 
+    // Spend what is left of this frame's upload budget on pending tiles
+    // (visible ones first), so a tall page streams in over several frames
+    // instead of stalling one.
+    if (processed < MAX_ROTATABLE_TEXTURES_PER_FRAME) {
+        processed += RotatableImage::uploadPendingTiles(MAX_ROTATABLE_TEXTURES_PER_FRAME - processed);
+    }
+    PerfOverlay::getInstance().recordTextureUploads(processed);
+
     // If more pending, schedule another batch for the next frame
-    bool morePending = false;
+    bool morePending = RotatableImage::hasPendingTiles();
     {
         std::lock_guard<std::mutex> lock(s_pendingRotatableMutex);
-        morePending = !s_pendingRotatableTextures.empty();
+        morePending = morePending || !s_pendingRotatableTextures.empty();
     }
     if (morePending) {
         bool expected = false;
@@ -2413,6 +3054,7 @@ void ImageLoader::processPendingRotatableTextures() {
 }
 
 void ImageLoader::executeLoad(const LoadRequest& request, HttpClient& httpClient) {
+    PERF_TRACE_SCOPE("thumb_load");
     const std::string& url = request.url;
     brls::Image* target = request.target;
     LoadCallback callback = request.callback;
@@ -2448,21 +3090,18 @@ void ImageLoader::executeLoad(const LoadRequest& request, HttpClient& httpClient
                     brls::Logger::warning("ImageLoader: Removing invalid cached cover for manga {}", mangaId);
                     LibraryCache::getInstance().deleteCoverImage(mangaId);
                 } else {
-                    // Found valid TGA in disk cache - add to memory LRU cache
-                    cachePut(url, diskData);
+                    // Found valid TGA in disk cache - keep it decoded in memory
+                    std::vector<uint8_t> rgba;
+                    int w = 0, h = 0;
+                    if (!tgaToRGBA(diskData, rgba, w, h)) return;
+                    { std::vector<uint8_t>().swap(diskData); }
+                    rgbaPut(rgbaKey(url, s_maxThumbnailSize), rgba, w, h);
                     // Re-check alive after disk I/O
                     if (alive && !*alive) return;
                     if (request.coverCallback) {
-                        int w, h, c;
-                        uint8_t* rgba = stbi_load_from_memory(diskData.data(),
-                            static_cast<int>(diskData.size()), &w, &h, &c, 4);
-                        if (rgba) {
-                            std::vector<uint8_t> rgbaVec(rgba, rgba + w * h * 4);
-                            stbi_image_free(rgba);
-                            queueCoverUpload(std::move(rgbaVec), w, h, request.coverCallback, alive);
-                        }
+                        queueCoverUpload(std::move(rgba), w, h, request.coverCallback, alive);
                     } else if (target) {
-                        queueTextureUpdate(diskData, target, callback, alive);
+                        queueTextureUpdate(std::move(rgba), w, h, target, callback, alive);
                     }
                     return;
                 }
@@ -2693,9 +3332,6 @@ void ImageLoader::executeLoad(const LoadRequest& request, HttpClient& httpClient
         bodyVec.shrink_to_fit();
     }
 
-    // Cache the image in memory using LRU eviction
-    cachePut(url, imageData);
-
     // Save to disk cache if enabled
     if (Application::getInstance().getSettings().cacheCoverImages) {
         int mangaId = extractMangaIdFromUrl(url);
@@ -2704,24 +3340,24 @@ void ImageLoader::executeLoad(const LoadRequest& request, HttpClient& httpClient
         }
     }
 
+    // Keep it in memory decoded (the TGA only goes to disk), so every later
+    // upload is a pure GPU upload
+    std::vector<uint8_t> rgba;
+    int rgbaW = 0, rgbaH = 0;
+    if (!tgaToRGBA(imageData, rgba, rgbaW, rgbaH)) return;
+    { std::vector<uint8_t>().swap(imageData); }
+    rgbaPut(rgbaKey(url, s_maxThumbnailSize), rgba, rgbaW, rgbaH);
+
     // Re-check alive flag after the (potentially long) decode.  The owning
     // view may have been destroyed while we were downloading / decoding.
     // Without this, a stale `target` pointer reaches processPendingTextures()
-    // and crashes on setImageFromMem().
+    // and crashes on the upload.
     if (alive && !*alive) return;
 
-    // Cover mode: decode TGA→RGBA on this worker thread, queue pure GPU upload
     if (request.coverCallback) {
-        int w, h, c;
-        uint8_t* rgba = stbi_load_from_memory(imageData.data(),
-            static_cast<int>(imageData.size()), &w, &h, &c, 4);
-        if (rgba) {
-            std::vector<uint8_t> rgbaVec(rgba, rgba + w * h * 4);
-            stbi_image_free(rgba);
-            queueCoverUpload(std::move(rgbaVec), w, h, request.coverCallback, alive);
-        }
+        queueCoverUpload(std::move(rgba), rgbaW, rgbaH, request.coverCallback, alive);
     } else if (target) {
-        queueTextureUpdate(imageData, target, callback, alive);
+        queueTextureUpdate(std::move(rgba), rgbaW, rgbaH, target, callback, alive);
     }
     brls::Logger::debug("ImageLoader: Queued texture for {}", url);
 }
@@ -2757,6 +3393,7 @@ void ImageLoader::workerThreadFunc(int workerId) {
     // This avoids creating a new TCP connection for every cover download.
     HttpClient httpClient;
     applyAuthHeaders(httpClient);
+    PerfTrace::setThreadName("image worker");
 
     brls::Logger::debug("ImageLoader: Worker {} started", workerId);
 
@@ -2821,15 +3458,16 @@ void ImageLoader::loadAsync(const std::string& url, LoadCallback callback, brls:
                             std::shared_ptr<bool> alive) {
     if (url.empty() || !target) return;
 
-    // Check memory cache first (LRU - promotes to front on hit)
+    // Check the decoded tier first (LRU - promotes to front on hit)
     // This is fast (in-memory map lookup) and safe on the main thread
     {
-        std::vector<uint8_t> cachedData;
-        if (cacheGet(url, cachedData)) {
+        std::vector<uint8_t> rgba;
+        int w = 0, h = 0;
+        if (rgbaGet(rgbaKey(url, s_maxThumbnailSize), rgba, w, h)) {
             // Route through batched texture queue even for memory cache hits.
-            // Direct setImageFromMem() on the main thread causes a freeze when
+            // Uploading directly on the main thread causes a freeze when
             // many cells hit memory cache simultaneously (e.g., after grid rebuild).
-            queueTextureUpdate(cachedData, target, callback, alive);
+            queueTextureUpdate(std::move(rgba), w, h, target, callback, alive);
             return;
         }
     }
@@ -2847,6 +3485,7 @@ void ImageLoader::loadAsync(const std::string& url, LoadCallback callback, brls:
 }
 
 void ImageLoader::executeRotatableLoad(const RotatableLoadRequest& request, HttpClient& httpClient) {
+    PERF_TRACE_SCOPE("page_load");
     const std::string& url = request.url;
     RotatableLoadCallback callback = request.callback;
     RotatableImage* target = request.target;
@@ -2880,17 +3519,22 @@ void ImageLoader::executeRotatableLoad(const RotatableLoadRequest& request, Http
     int pageMangaId = -1, pageChapterIdx = -1, pagePageIdx = -1;
     bool hasPageIds = extractPageUrlIds(url, pageMangaId, pageChapterIdx, pagePageIdx);
     bool pageCacheOn = Application::getInstance().getSettings().pageCacheEnabled;
+    // Border cropping applies to whole pages only; explicitly segmented loads
+    // must keep their rows aligned with the other segments.
+    bool cropPage = s_cropBorders.load() && totalSegments <= 1;
+    const std::string cropKey = cropPage ? url : std::string();
+    const std::string fullKey = totalSegments > 1 ? url + "_full" : fullSizeCacheKey(url);
     if (pageCacheOn && hasPageIds && totalSegments <= 1) {
         std::vector<uint8_t> diskData;
-        if (LibraryCache::getInstance().loadPageImage(pageMangaId, pageChapterIdx, pagePageIdx, diskData)) {
+        if (LibraryCache::getInstance().loadPageImage(pageMangaId, pageChapterIdx, pagePageIdx, diskData, cropPage)) {
             auto ioEndTime = std::chrono::steady_clock::now();
             auto ioMs = std::chrono::duration_cast<std::chrono::milliseconds>(ioEndTime - loadStartTime).count();
             brls::Logger::info("ImageLoader: [TIMING] Disk cache hit {}ms for {} ({} bytes)",
                               ioMs, url, diskData.size());
+            recordFullSizeLoadTime(ioMs);
 
-            // Put in LRU memory cache too
-            std::string cacheKey = url + "_full";
-            cachePut(cacheKey, diskData);
+            // Hand to the reader's page ring, else the LRU memory cache
+            if (!pageRingOffer(url, diskData)) cachePut(fullKey, diskData);
 
             if (target || callback) {
                 queueRotatableTextureUpdate(diskData, target, callback, alive);
@@ -2899,9 +3543,49 @@ void ImageLoader::executeRotatableLoad(const RotatableLoadRequest& request, Http
         }
     }
 
+    // Convert images to TGA with size limit optimized for Vita display.
+    // The Vita renders at 1280x726 internally, so anything larger than 1280
+    // on the longest dimension is wasted resolution. Using 1280 instead of 2048
+    // reduces decode time and memory significantly:
+    // e.g. 1125x1600 → 900x1280 (saves ~40% pixels, ~40% faster decode)
+    const int MAX_TEXTURE_SIZE = 1280;
+
     std::string imageBody;
     bool loadSuccess = false;
 
+    // Tall WebP pages are decoded while they download. Finished segments are
+    // cached and queued for upload at once, the first one opening a segment
+    // stream on the target that later ones are appended to.
+    WebPSegmentStream stream(MAX_TEXTURE_SIZE);
+    uint64_t streamId = 0;
+    bool streamShown = false;
+    std::vector<int> streamSrcHeights;
+    auto deliverStream = [&](bool last) {
+        std::vector<std::vector<uint8_t>> segs;
+        std::vector<int> heights;
+        stream.takeReady(segs, heights);
+        for (size_t i = 0; i < segs.size(); i++) {
+            cachePut(fullKey + "_autoseg" + std::to_string(streamSrcHeights.size() + i), segs[i]);
+        }
+        streamSrcHeights.insert(streamSrcHeights.end(), heights.begin(), heights.end());
+        if (!target && !callback) return;
+
+        if (!streamShown) {
+            if (segs.empty()) return;
+            streamShown = true;
+            streamId = last ? 0 : s_nextSegmentStreamId.fetch_add(1);
+            auto firstMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - loadStartTime).count();
+            brls::Logger::info("ImageLoader: [TIMING] First streamed segment after {}ms ({}x{}, {} segs) for {}",
+                               firstMs, stream.origWidth(), stream.origHeight(), stream.segments(), url);
+            queueRotatableSegmentUpdate(std::move(segs), stream.origWidth(), stream.origHeight(),
+                                        std::move(heights), target, callback, alive, streamId);
+        } else if (streamId != 0) {
+            queueRotatableStreamUpdate(streamId, std::move(segs), std::move(heights), last, alive);
+            if (last) streamId = 0;
+        }
+    };
+
     // Check if this is a local file path
     bool isLocalFile = isPlatformLocalPath(url);
 
@@ -2924,11 +3608,61 @@ void ImageLoader::executeRotatableLoad(const RotatableLoadRequest& request, Http
             return;
         }
 
+        // Stream only whole-page loads, and not while recovering from OOM
+        BodyProgressCallback onProgress;
+        bool holdsStreamSlot = false;
+        if (totalSegments <= 1 && s_oomCooldownFrames.load() <= 0 && !s_webpStreamBusy.exchange(true)) {
+            holdsStreamSlot = true;
+            // Hand the slot to the next page as soon as this one can't stream
+            // (not a tall WebP, say) instead of at the end of the download
+            auto releaseSlot = [&]() {
+                holdsStreamSlot = false;
+                s_webpStreamBusy = false;
+                return false;
+            };
+            onProgress = [&](const std::string& body, bool fresh) -> bool {
+                if (!holdsStreamSlot) return false;
+                if (fresh) {
+                    // A retry after segments went out decodes the finished body instead
+                    if (stream.emittedSegments() > 0) return false;
+                    stream.reset();
+                }
+                if (alive && !*alive) {
+                    stream.reset();
+                    return releaseSlot();
+                }
+                std::lock_guard<std::mutex> decodeLock(s_decodeMutex);
+                // A rejected stream has already freed its decoder
+                if (!stream.update(reinterpret_cast<const uint8_t*>(body.data()), body.size())) return releaseSlot();
+                deliverStream(false);
+                return true;
+            };
+        }
+
         // Load from HTTP with automatic JWT refresh on 401/403
-        HttpResponse resp = authenticatedGet(url, 2, &httpClient);
+        HttpResponse resp = authenticatedGet(url, 2, &httpClient, 0, onProgress);
+        if (holdsStreamSlot) s_webpStreamBusy = false;
+
+        if (stream.done()) {
+            deliverStream(true);
+            cachePut(fullKey, buildAutoSplitMeta(stream.origWidth(), stream.origHeight(), streamSrcHeights));
+            auto totalMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - loadStartTime).count();
+            brls::Logger::info("ImageLoader: [TIMING] Streamed decode {}x{} -> {} segs, total {}ms for {}",
+                               stream.origWidth(), stream.origHeight(), stream.segments(), totalMs, url);
+            recordFullSizeLoadTime(totalMs);
+            return;
+        }
+        // Free a partial decode before the regular one
+        stream.reset();
+
         if (resp.success && !resp.body.empty()) {
             imageBody = std::move(resp.body);
             loadSuccess = true;
+        } else if (streamId != 0) {
+            // Keep the rows that made it; the rest stays a placeholder
+            queueRotatableStreamUpdate(streamId, {}, {}, true, alive);
+            streamId = 0;
         }
     }
 
@@ -3048,7 +3782,7 @@ void ImageLoader::executeRotatableLoad(const RotatableLoadRequest& request, Http
             brls::Logger::debug("ImageLoader: TGA pass-through ({} bytes) for {}", imageBody.size(), url);
             std::vector<uint8_t> imageData(imageBody.begin(), imageBody.end());
 
-            std::string cacheKey = url + "_full";
+            std::string cacheKey = fullKey;
             if (totalSegments > 1) {
                 cacheKey += "_seg" + std::to_string(segment);
             }
@@ -3058,6 +3792,7 @@ void ImageLoader::executeRotatableLoad(const RotatableLoadRequest& request, Http
                 auto decodeEndTime = std::chrono::steady_clock::now();
                 auto totalMs = std::chrono::duration_cast<std::chrono::milliseconds>(decodeEndTime - loadStartTime).count();
                 brls::Logger::info("ImageLoader: [TIMING] TGA pass-through, total {}ms for {}", totalMs, url);
+                recordFullSizeLoadTime(totalMs);
             }
 
             if (target || callback) {
@@ -3066,13 +3801,6 @@ void ImageLoader::executeRotatableLoad(const RotatableLoadRequest& request, Http
             return;
         }
 
-        // Convert images to TGA with size limit optimized for Vita display.
-        // The Vita renders at 1280x726 internally, so anything larger than 1280
-        // on the longest dimension is wasted resolution. Using 1280 instead of 2048
-        // reduces decode time and memory significantly:
-        // e.g. 1125x1600 → 900x1280 (saves ~40% pixels, ~40% faster decode)
-        const int MAX_TEXTURE_SIZE = 1280;
-
         // Serialize decodes across all worker threads to prevent concurrent
         // multi-MB decode buffers from exhausting the Vita's memory.
         std::lock_guard<std::mutex> decodeLock(s_decodeMutex);
@@ -3092,8 +3820,7 @@ void ImageLoader::executeRotatableLoad(const RotatableLoadRequest& request, Http
                 brls::Logger::error("ImageLoader: SVG conversion failed for {}", url);
                 return;
             }
-            std::string cacheKey = url + "_full";
-            cachePut(cacheKey, imageData);
+            cachePut(fullKey, imageData);
             auto decodeEndTime = std::chrono::steady_clock::now();
             auto decodeMs = std::chrono::duration_cast<std::chrono::milliseconds>(decodeEndTime - decodeStartTime).count();
             auto totalMs = std::chrono::duration_cast<std::chrono::milliseconds>(decodeEndTime - loadStartTime).count();
@@ -3111,8 +3838,7 @@ void ImageLoader::executeRotatableLoad(const RotatableLoadRequest& request, Http
                 brls::Logger::error("ImageLoader: {} conversion failed for {}", fmtName, url);
                 return;
             }
-            std::string cacheKey = url + "_full";
-            cachePut(cacheKey, imageData);
+            cachePut(fullKey, imageData);
             auto decodeEndTime = std::chrono::steady_clock::now();
             auto decodeMs = std::chrono::duration_cast<std::chrono::milliseconds>(decodeEndTime - decodeStartTime).count();
             auto totalMs = std::chrono::duration_cast<std::chrono::milliseconds>(decodeEndTime - loadStartTime).count();
@@ -3158,25 +3884,9 @@ void ImageLoader::executeRotatableLoad(const RotatableLoadRequest& request, Http
                                       static_cast<int>(imageBody.size()), &origW, &origH, &c);
             }
 
-            if (origW > 0 && origH > MAX_TEXTURE_SIZE * 2) {
-                // Only auto-split if image is MUCH taller than max (webtoon-style).
-                // For normal manga pages slightly taller than max, proportional
-                // scaling into a single texture is faster than multi-segment decode.
-                int autoSegments = (origH + MAX_TEXTURE_SIZE - 1) / MAX_TEXTURE_SIZE;
-
-                // VRAM budget: cap total texture memory per image to prevent GPU exhaustion.
-                // The segment function scales both dims proportionally when width > maxSize,
-                // so total VRAM = maxSize² * origH / origW * 4.
-                // Solve for maxSize: maxSize = sqrt(budget * origW / (origH * 4))
-                const int MAX_VRAM_PER_IMAGE = 16 * 1024 * 1024;  // 16MB
-                int segMaxSize = MAX_TEXTURE_SIZE;
-                long long totalUnscaledBytes = (long long)origW * origH * 4;
-                if (totalUnscaledBytes > MAX_VRAM_PER_IMAGE) {
-                    float maxSizeF = std::sqrt((float)MAX_VRAM_PER_IMAGE * origW / ((float)origH * 4.0f));
-                    segMaxSize = std::max(256, std::min((int)maxSizeF, MAX_TEXTURE_SIZE));
-                    brls::Logger::info("ImageLoader: VRAM budget {}x{} -> maxWidth={}", origW, origH, segMaxSize);
-                }
-
+            int segMaxSize = MAX_TEXTURE_SIZE;
+            int autoSegments = planAutoSplit(origW, origH, MAX_TEXTURE_SIZE, segMaxSize);
+            if (autoSegments > 1) {
                 brls::Logger::info("ImageLoader: Auto-splitting {}x{} into {} segments (maxSize={})",
                                    origW, origH, autoSegments, segMaxSize);
 
@@ -3198,7 +3908,7 @@ void ImageLoader::executeRotatableLoad(const RotatableLoadRequest& request, Http
                     if (allOK) {
                         // Cache each segment and build height list
                         for (int seg = 0; seg < autoSegments; seg++) {
-                            std::string segCK = url + "_full_autoseg" + std::to_string(seg);
+                            std::string segCK = fullKey + "_autoseg" + std::to_string(seg);
                             cachePut(segCK, segmentDatas[seg]);
 
                             int segH = (decH + autoSegments - 1) / autoSegments;
@@ -3208,7 +3918,20 @@ void ImageLoader::executeRotatableLoad(const RotatableLoadRequest& request, Http
                         }
                     }
                 } else {
-                    // WebP: use per-segment crop+scale decode (efficient, no full alloc)
+                    // WebP: one scaled decode sliced into segments (the same
+                    // decoder a streaming download uses)
+                    WebPSegmentStream whole(MAX_TEXTURE_SIZE);
+                    if (whole.update(reinterpret_cast<const uint8_t*>(imageBody.data()), imageBody.size()) &&
+                        whole.done()) {
+                        whole.takeReady(segmentDatas, segSrcHeights);
+                        for (int seg = 0; seg < autoSegments; seg++) {
+                            cachePut(fullKey + "_autoseg" + std::to_string(seg), segmentDatas[seg]);
+                        }
+                    }
+                }
+
+                if (isWebP && segmentDatas.empty()) {
+                    // Fallback: per-segment crop+scale decode (no full-page buffer)
                     for (int seg = 0; seg < autoSegments && allOK; seg++) {
                         if (alive && !*alive) return;  // Owner destroyed during processing
                         if (isUnderMemoryPressure()) {
@@ -3227,7 +3950,7 @@ void ImageLoader::executeRotatableLoad(const RotatableLoadRequest& request, Http
                         }
 
                         // Cache each segment
-                        std::string segCK = url + "_full_autoseg" + std::to_string(seg);
+                        std::string segCK = fullKey + "_autoseg" + std::to_string(seg);
                         cachePut(segCK, segData);
                         segmentDatas.push_back(std::move(segData));
 
@@ -3243,21 +3966,7 @@ void ImageLoader::executeRotatableLoad(const RotatableLoadRequest& request, Http
                     // Store compact metadata under the main cache key so that
                     // loadAsyncFullSize can reconstruct from cached segments
                     // without re-reading the file from disk.
-                    // Format: "ASEG" + uint16 count + uint16 origW + uint16 origH + uint16[] segHeights
-                    std::vector<uint8_t> meta;
-                    meta.resize(4 + 2 + 2 + 2 + 2 * autoSegments);
-                    meta[0] = 'A'; meta[1] = 'S'; meta[2] = 'E'; meta[3] = 'G';
-                    uint16_t cnt = static_cast<uint16_t>(autoSegments);
-                    uint16_t mw = static_cast<uint16_t>(std::min(origW, 65535));
-                    uint16_t mh = static_cast<uint16_t>(std::min(origH, 65535));
-                    memcpy(&meta[4], &cnt, 2);
-                    memcpy(&meta[6], &mw, 2);
-                    memcpy(&meta[8], &mh, 2);
-                    for (int s = 0; s < autoSegments; s++) {
-                        uint16_t sh = static_cast<uint16_t>(segSrcHeights[s]);
-                        memcpy(&meta[10 + s * 2], &sh, 2);
-                    }
-                    cachePut(url + "_full", meta);
+                    cachePut(fullKey, buildAutoSplitMeta(origW, origH, segSrcHeights));
 
                     {
                         auto decodeEndTime = std::chrono::steady_clock::now();
@@ -3265,6 +3974,7 @@ void ImageLoader::executeRotatableLoad(const RotatableLoadRequest& request, Http
                         auto totalMs = std::chrono::duration_cast<std::chrono::milliseconds>(decodeEndTime - loadStartTime).count();
                         brls::Logger::info("ImageLoader: [TIMING] Decode took {}ms (auto-split {}x{} -> {} segs), total {}ms for {}",
                                           decodeMs, origW, origH, autoSegments, totalMs, url);
+                        recordFullSizeLoadTime(totalMs);
                     }
 
                     if (target || callback) {
@@ -3328,6 +4038,8 @@ void ImageLoader::executeRotatableLoad(const RotatableLoadRequest& request, Http
                 }
                 brls::Logger::info("ImageLoader: stb_image fallback succeeded for {}", url);
             }
+            // WebP decodes straight to a downscaled TGA, so crop that
+            cropTGABorders(imageData, cropKey);
         } else if (isJpegOrPng) {
             if (totalSegments > 1) {
                 // Loading a specific segment of a tall JPEG/PNG image
@@ -3341,10 +4053,12 @@ void ImageLoader::executeRotatableLoad(const RotatableLoadRequest& request, Http
                 brls::Logger::info("ImageLoader: Loaded segment {}/{} of JPEG/PNG", segment + 1, totalSegments);
             } else {
                 // Normal JPEG/PNG loading with downscaling if needed
+                // (margins cropped at full resolution before the downscale)
                 imageData = convertImageToTGA(
                     reinterpret_cast<const uint8_t*>(imageBody.data()),
                     imageBody.size(),
-                    MAX_TEXTURE_SIZE
+                    MAX_TEXTURE_SIZE,
+                    cropKey
                 );
             }
             if (imageData.empty()) {
@@ -3375,6 +4089,7 @@ void ImageLoader::executeRotatableLoad(const RotatableLoadRequest& request, Http
                 brls::Logger::error("ImageLoader: GIF decode failed for {}", url);
                 return;
             }
+            cropTGABorders(imageData, cropKey);
         } else {
             // For other formats, pass through directly
             // NVG will handle loading
@@ -3388,16 +4103,19 @@ void ImageLoader::executeRotatableLoad(const RotatableLoadRequest& request, Http
         // reducing peak memory usage on the Vita.
         { std::string().swap(imageBody); }
 
-        // Cache the image using LRU (include segment in key if segmented)
-        std::string cacheKey = url + "_full";
+        // Cache the image using LRU (include segment in key if segmented),
+        // unless the reader's page ring is waiting for it
+        std::string cacheKey = fullKey;
         if (totalSegments > 1) {
             cacheKey += "_seg" + std::to_string(segment);
         }
-        cachePut(cacheKey, imageData);
+        if (totalSegments > 1 || !pageRingOffer(url, imageData)) {
+            cachePut(cacheKey, imageData);
+        }
 
         // Save to page disk cache for instant loading next time
         if (pageCacheOn && hasPageIds && totalSegments <= 1 && !imageData.empty()) {
-            LibraryCache::getInstance().savePageImage(pageMangaId, pageChapterIdx, pagePageIdx, imageData);
+            LibraryCache::getInstance().savePageImage(pageMangaId, pageChapterIdx, pagePageIdx, imageData, cropPage);
         }
 
         {
@@ -3405,6 +4123,7 @@ void ImageLoader::executeRotatableLoad(const RotatableLoadRequest& request, Http
             auto decodeMs = std::chrono::duration_cast<std::chrono::milliseconds>(decodeEndTime - decodeStartTime).count();
             auto totalMs = std::chrono::duration_cast<std::chrono::milliseconds>(decodeEndTime - loadStartTime).count();
             brls::Logger::info("ImageLoader: [TIMING] Decode took {}ms, total {}ms for {}", decodeMs, totalMs, url);
+            recordFullSizeLoadTime(totalMs);
         }
 
         // Queue for batched texture upload on the main thread.
@@ -3425,8 +4144,17 @@ void ImageLoader::loadAsyncFullSize(const std::string& url, RotatableLoadCallbac
     if (url.empty() || !target) return;
     if (alive && !*alive) return;
 
+    // Decoded-page ring hit: upload only
+    {
+        std::shared_ptr<const std::vector<uint8_t>> ringData;
+        if (pageRingGet(url, ringData)) {
+            queueRotatableTextureUpdate(std::move(ringData), target, callback, alive);
+            return;
+        }
+    }
+
     // Check LRU cache first
-    std::string cacheKey = url + "_full";
+    std::string cacheKey = fullSizeCacheKey(url);
     {
         std::vector<uint8_t> cachedData;
         if (cacheGet(cacheKey, cachedData)) {
@@ -3447,7 +4175,7 @@ void ImageLoader::loadAsyncFullSize(const std::string& url, RotatableLoadCallbac
                 bool allFound = true;
 
                 for (int s = 0; s < segCount && allFound; s++) {
-                    std::string segCK = url + "_full_autoseg" + std::to_string(s);
+                    std::string segCK = cacheKey + "_autoseg" + std::to_string(s);
                     std::vector<uint8_t> segData;
                     if (cacheGet(segCK, segData)) {
                         segDatas.push_back(std::move(segData));
@@ -3531,12 +4259,7 @@ void ImageLoader::loadAsyncFullSizeSegment(const std::string& url, int segment,
 void ImageLoader::preload(const std::string& url) {
     if (url.empty()) return;
 
-    {
-        std::lock_guard<std::mutex> lock(s_cacheMutex);
-        if (s_cacheMap.find(url) != s_cacheMap.end()) {
-            return;
-        }
-    }
+    if (rgbaHas(rgbaKey(url, s_maxThumbnailSize))) return;
 
     {
         std::lock_guard<std::mutex> lock(s_queueMutex);
@@ -3547,6 +4270,69 @@ void ImageLoader::preload(const std::string& url) {
     ensureWorkersStarted();
 }
 
+// Read width/height from the container header alone: PNG IHDR, the WebP
+// VP8/VP8L/VP8X chunk header or the JPEG SOF segment. A JPEG's SOF can sit
+// behind large EXIF/ICC segments; needBytes is set when it lies past size.
+static bool parseHeaderDimensions(const uint8_t* data, size_t size, int& width, int& height,
+                                  size_t& needBytes) {
+    needBytes = 0;
+    if (size < 12) return false;
+
+    // WebP - WebPGetInfo only parses the first chunk header
+    if (memcmp(data, "RIFF", 4) == 0 && memcmp(data + 8, "WEBP", 4) == 0) {
+        return WebPGetInfo(data, size, &width, &height) != 0;
+    }
+
+    // PNG - IHDR is always the first chunk, dimensions at bytes 16-23
+    if (data[0] == 0x89 && data[1] == 0x50 && data[2] == 0x4E && data[3] == 0x47) {
+        if (size < 24) return false;
+        width = (data[16] << 24) | (data[17] << 16) | (data[18] << 8) | data[19];
+        height = (data[20] << 24) | (data[21] << 16) | (data[22] << 8) | data[23];
+        return width > 0 && height > 0;
+    }
+
+    // JPEG - walk the marker segments up to the first SOFn
+    if (data[0] == 0xFF && data[1] == 0xD8) {
+        size_t i = 2;
+        while (true) {
+            if (i + 4 > size) {
+                needBytes = i + 4;
+                return false;
+            }
+            if (data[i] != 0xFF) {
+                i++;
+                continue;
+            }
+            uint8_t marker = data[i + 1];
+            if (marker == 0xFF) {
+                i++;  // Fill byte
+                continue;
+            }
+            if (marker == 0xD8 || marker == 0x01 || (marker >= 0xD0 && marker <= 0xD7)) {
+                i += 2;  // No length field
+                continue;
+            }
+            if (marker == 0xD9 || marker == 0xDA) return false;  // No SOF before the scan data
+
+            // SOF0-SOF15 except DHT (C4), JPG (C8) and DAC (CC)
+            if (marker >= 0xC0 && marker <= 0xCF && marker != 0xC4 && marker != 0xC8 && marker != 0xCC) {
+                if (i + 9 > size) {
+                    needBytes = i + 9;
+                    return false;
+                }
+                height = (data[i + 5] << 8) | data[i + 6];
+                width = (data[i + 7] << 8) | data[i + 8];
+                return width > 0 && height > 0;
+            }
+
+            uint16_t len = (data[i + 2] << 8) | data[i + 3];
+            i += 2 + len;
+        }
+    }
+
+    return false;
+}
+
 bool ImageLoader::getImageDimensions(const std::string& url, int& width, int& height, int& suggestedSegments) {
     // Maximum texture size for Vita GPU
     const int MAX_TEXTURE_SIZE = 2048;
@@ -3558,28 +4344,59 @@ bool ImageLoader::getImageDimensions(const std::string& url, int& width, int& he
 
     if (url.empty()) return false;
 
-    std::string imageData;
-    bool loadSuccess = false;
-
     // Check if this is a local file path
     bool isLocalFile = isPlatformLocalPath(url);
 
-    if (isLocalFile) {
-        auto fileData = platform::readFile(url);
-        if (!fileData.empty()) {
-            imageData.assign(reinterpret_cast<const char*>(fileData.data()), fileData.size());
-            loadSuccess = true;
+    // Read only the first few KB: enough for the header of nearly every page.
+    // Only a JPEG with an oversized EXIF/ICC block needs a second, larger read.
+    std::string imageData;
+    bool haveWholeFile = false;
+    size_t probeBytes = DIMENSION_PROBE_BYTES;
+    while (probeBytes > 0) {
+        std::string head;
+        if (isLocalFile) {
+            auto fileData = platform::readFilePrefix(url, probeBytes);
+            head.assign(reinterpret_cast<const char*>(fileData.data()), fileData.size());
+        } else {
+            HttpResponse resp = authenticatedGet(url, 2, nullptr, probeBytes);
+            if (resp.success) head = std::move(resp.body);
         }
-    } else {
-        // Load from HTTP with automatic JWT refresh on 401/403
-        HttpResponse resp = authenticatedGet(url, 2);
-        if (resp.success && !resp.body.empty()) {
-            imageData = std::move(resp.body);
-            loadSuccess = true;
+        if (head.empty()) break;
+
+        size_t needBytes = 0;
+        if (parseHeaderDimensions(reinterpret_cast<const uint8_t*>(head.data()), head.size(),
+                                  width, height, needBytes)) {
+            suggestedSegments = calculateSegments(width, height, MAX_TEXTURE_SIZE);
+            brls::Logger::debug("ImageLoader: {}x{} -> {} segments from {} header bytes",
+                                width, height, suggestedSegments, head.size());
+            return true;
+        }
+
+        if (head.size() < probeBytes) {
+            // Short read: this is the whole file
+            imageData = std::move(head);
+            haveWholeFile = true;
+            break;
+        }
+        if (needBytes == 0 || needBytes > DIMENSION_PROBE_MAX_BYTES) break;
+
+        size_t next = std::min(DIMENSION_PROBE_MAX_BYTES, std::max(needBytes + 4096, probeBytes * 4));
+        probeBytes = next > probeBytes ? next : 0;
+    }
+
+    // Formats without a fixed header layout (SVG, AVIF/HEIF) need the whole file
+    if (!haveWholeFile) {
+        if (isLocalFile) {
+            auto fileData = platform::readFile(url);
+            imageData.assign(reinterpret_cast<const char*>(fileData.data()), fileData.size());
+        } else {
+            // Load from HTTP with automatic JWT refresh on 401/403
+            HttpResponse resp = authenticatedGet(url, 2);
+            if (resp.success) imageData = std::move(resp.body);
         }
     }
 
-    if (!loadSuccess || imageData.empty()) {
+    if (imageData.empty()) {
         brls::Logger::warning("ImageLoader::getImageDimensions: failed to fetch {}", url);
         return false;
     }
@@ -3589,51 +4406,11 @@ bool ImageLoader::getImageDimensions(const std::string& url, int& width, int& he
 
     unsigned char* data = reinterpret_cast<unsigned char*>(imageData.data());
 
-    // WebP
-    if (data[0] == 0x52 && data[1] == 0x49 && data[2] == 0x46 && data[3] == 0x46 &&
-        data[8] == 0x57 && data[9] == 0x45 && data[10] == 0x42 && data[11] == 0x50) {
-        if (WebPGetInfo(data, imageData.size(), &width, &height)) {
-            suggestedSegments = calculateSegments(width, height, MAX_TEXTURE_SIZE);
-            brls::Logger::info("ImageLoader: WebP {}x{} -> {} segments", width, height, suggestedSegments);
-            return true;
-        }
-    }
-    // PNG - dimensions at bytes 16-23
-    else if (data[0] == 0x89 && data[1] == 0x50 && data[2] == 0x4E && data[3] == 0x47) {
-        if (imageData.size() >= 24) {
-            width = (data[16] << 24) | (data[17] << 16) | (data[18] << 8) | data[19];
-            height = (data[20] << 24) | (data[21] << 16) | (data[22] << 8) | data[23];
-            suggestedSegments = calculateSegments(width, height, MAX_TEXTURE_SIZE);
-            brls::Logger::info("ImageLoader: PNG {}x{} -> {} segments", width, height, suggestedSegments);
-            return true;
-        }
-    }
-    // JPEG - need to parse markers
-    else if (data[0] == 0xFF && data[1] == 0xD8 && data[2] == 0xFF) {
-        // Simple JPEG parser - look for SOF0/SOF2 markers
-        size_t i = 2;
-        while (i + 8 < imageData.size()) {
-            if (data[i] != 0xFF) {
-                i++;
-                continue;
-            }
-            uint8_t marker = data[i + 1];
-            // SOF0 (0xC0) or SOF2 (0xC2) contain dimensions
-            if (marker == 0xC0 || marker == 0xC2) {
-                height = (data[i + 5] << 8) | data[i + 6];
-                width = (data[i + 7] << 8) | data[i + 8];
-                suggestedSegments = calculateSegments(width, height, MAX_TEXTURE_SIZE);
-                brls::Logger::info("ImageLoader: JPEG {}x{} -> {} segments", width, height, suggestedSegments);
-                return true;
-            }
-            // Skip this marker segment
-            if (marker == 0xD8 || marker == 0xD9 || (marker >= 0xD0 && marker <= 0xD7)) {
-                i += 2;  // No length field
-            } else {
-                uint16_t len = (data[i + 2] << 8) | data[i + 3];
-                i += 2 + len;
-            }
-        }
+    size_t needBytes = 0;
+    if (parseHeaderDimensions(data, imageData.size(), width, height, needBytes)) {
+        suggestedSegments = calculateSegments(width, height, MAX_TEXTURE_SIZE);
+        brls::Logger::info("ImageLoader: {}x{} -> {} segments", width, height, suggestedSegments);
+        return true;
     }
 
     // SVG - parse with nanosvg to get dimensions
@@ -3680,7 +4457,10 @@ void ImageLoader::preloadFullSize(const std::string& url) {
     if (url.empty()) return;
 
     // Use same cache key as loadAsyncFullSize/executeRotatableLoad
-    std::string cacheKey = url + "_full";
+    std::string cacheKey = fullSizeCacheKey(url);
+
+    // Already decoded in the reader's page ring
+    if (pageRingHas(url)) return;
 
     // Check if already cached
     {
@@ -3707,10 +4487,138 @@ void ImageLoader::preloadFullSize(const std::string& url) {
 }
 
 void ImageLoader::clearCache() {
-    std::lock_guard<std::mutex> lock(s_cacheMutex);
-    s_cacheList.clear();
-    s_cacheMap.clear();
-    s_currentCacheMemory = 0;
+    {
+        std::lock_guard<std::mutex> lock(s_cacheMutex);
+        s_cacheList.clear();
+        s_cacheMap.clear();
+        s_currentCacheMemory = 0;
+    }
+    {
+        std::lock_guard<std::mutex> lock(s_rgbaMutex);
+        s_rgbaList.clear();
+        s_rgbaMap.clear();
+        s_rgbaMemory = 0;
+    }
+    clearPageRing();
+}
+
+void ImageLoader::setPageRingWindow(const std::vector<std::string>& urls) {
+    std::vector<PageRingSlot> leaving;
+    std::vector<std::string> missing;
+    bool pressure = inMemoryCooldown();
+    size_t budget = pressure ? PAGE_RING_BUDGET / 2 : PAGE_RING_BUDGET;
+    {
+        std::lock_guard<std::mutex> lock(s_pageRingMutex);
+        std::vector<PageRingSlot> next;
+        next.reserve(urls.size());
+        size_t kept = 0;
+        for (const auto& url : urls) {
+            if (url.empty()) continue;
+            if (pressure && next.size() >= PAGE_RING_PRESSURE_SLOTS) break;
+            PageRingSlot slot;
+            slot.url = url;
+            for (auto& old : s_pageRing) {
+                if (old.url == url) {
+                    // Past the budget the page leaves for the LRU like any other
+                    if (kept + old.bytes() <= budget) {
+                        kept += old.bytes();
+                        slot.data = std::move(old.data);
+                        old.url.clear();
+                    }
+                    break;
+                }
+            }
+            if (!slot.data) missing.push_back(url);
+            next.push_back(std::move(slot));
+        }
+        for (auto& old : s_pageRing) {
+            if (!old.url.empty() && old.data) leaving.push_back(std::move(old));
+        }
+        s_pageRing.swap(next);
+    }
+
+    // Pages leaving the window go back to the shared LRU so a short
+    // backtrack can still skip the decode
+    for (const auto& slot : leaving) {
+        cachePut(fullSizeCacheKey(slot.url), *slot.data);
+    }
+
+    // Fill new slots nearest-first: take already-decoded pages out of the
+    // LRU (auto-split pages stay there, the ring holds single textures only),
+    // queue a preload for the rest
+    for (const auto& url : missing) {
+        std::string cacheKey = fullSizeCacheKey(url);
+        std::vector<uint8_t> cached;
+        if (cacheGet(cacheKey, cached)) {
+            bool isAutoSeg = cached.size() >= 4 && cached[0] == 'A' && cached[1] == 'S' &&
+                             cached[2] == 'E' && cached[3] == 'G';
+            if (!isAutoSeg && pageRingOffer(url, cached)) {
+                cacheErase(cacheKey);
+            }
+            continue;
+        }
+        preloadFullSize(url);
+    }
+}
+
+void ImageLoader::clearPageRing() {
+    std::lock_guard<std::mutex> lock(s_pageRingMutex);
+    s_pageRing.clear();
+}
+
+bool ImageLoader::pageRingOffer(const std::string& url, const std::vector<uint8_t>& data) {
+    if (data.size() <= 18) return false;
+    size_t budget = inMemoryCooldown() ? PAGE_RING_BUDGET / 2 : PAGE_RING_BUDGET;
+    std::vector<PageRingSlot> displaced;
+    {
+        std::lock_guard<std::mutex> lock(s_pageRingMutex);
+        size_t index = 0;
+        size_t used = 0;
+        while (index < s_pageRing.size() && s_pageRing[index].url != url) {
+            used += s_pageRing[index].bytes();
+            index++;
+        }
+        if (index == s_pageRing.size()) return false;
+        if (s_pageRing[index].data) return true;
+        // Slots nearer the current page keep their bytes; a page that doesn't
+        // fit next to them is refused and goes to the LRU
+        if (used + data.size() > budget) return false;
+
+        // Make room by displacing slots further down the window
+        for (size_t i = index + 1; i < s_pageRing.size(); i++) used += s_pageRing[i].bytes();
+        for (size_t i = s_pageRing.size(); i-- > index + 1 && used + data.size() > budget;) {
+            PageRingSlot& far = s_pageRing[i];
+            if (!far.data) continue;
+            used -= far.bytes();
+            displaced.push_back({far.url, std::move(far.data)});
+            far.data.reset();
+        }
+        s_pageRing[index].data = std::make_shared<const std::vector<uint8_t>>(data);
+    }
+
+    for (const auto& slot : displaced) {
+        cachePut(fullSizeCacheKey(slot.url), *slot.data);
+    }
+    return true;
+}
+
+bool ImageLoader::pageRingGet(const std::string& url, std::shared_ptr<const std::vector<uint8_t>>& data) {
+    std::lock_guard<std::mutex> lock(s_pageRingMutex);
+    for (const auto& slot : s_pageRing) {
+        if (slot.url == url && slot.data) {
+            data = slot.data;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool ImageLoader::pageRingHas(const std::string& url) {
+    std::lock_guard<std::mutex> lock(s_pageRingMutex);
+    for (const auto& slot : s_pageRing) {
+        if (slot.url == url && slot.data) return true;
+    }
+    return false;
 }
 
 void ImageLoader::cancelAll() {
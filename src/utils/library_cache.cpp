@@ -3,10 +3,14 @@
  */
 
 #include "utils/library_cache.hpp"
+#include "utils/library_search.hpp"
+#include "utils/perf_trace.hpp"
 #include <borealis.hpp>
+#include <set>
 #include <sstream>
 #include <cstring>
 #include <cstdlib>
+#include <ctime>
 
 #include "platform/platform.hpp"
 
@@ -48,6 +52,11 @@ bool LibraryCache::init() {
         return false;
     }
 
+    if (!ensureDirectoryExists(getPageListsCacheDir())) {
+        brls::Logger::error("LibraryCache: Failed to create page list cache directory");
+        return false;
+    }
+
     m_initialized = true;
     brls::Logger::info("LibraryCache: Initialized at {}", getCacheDir());
     return true;
@@ -65,6 +74,10 @@ std::string LibraryCache::getCategoryFilePath(int categoryId) {
     return getCacheDir() + "/category_" + std::to_string(categoryId) + ".txt";
 }
 
+std::string LibraryCache::getCategorySyncFilePath(int categoryId) {
+    return getCacheDir() + "/category_" + std::to_string(categoryId) + ".sync";
+}
+
 std::string LibraryCache::getCategoriesFilePath() {
     return getCacheDir() + "/categories.txt";
 }
@@ -295,6 +308,80 @@ bool LibraryCache::hasCategoryCache(int categoryId) {
 void LibraryCache::invalidateCategoryCache(int categoryId) {
     std::lock_guard<std::mutex> lock(m_mutex);
     platform::deleteFile(getCategoryFilePath(categoryId));
+    platform::deleteFile(getCategorySyncFilePath(categoryId));
+}
+
+bool LibraryCache::saveCategorySyncState(int categoryId, const std::string& serverUrl,
+                                         const LibrarySyncWatermark& watermark, int64_t lastFullSync) {
+    if (!m_enabled) return false;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // Format: fetchedAt|lastReadAt|lastFullSync|serverUrl
+    std::ostringstream ss;
+    ss << watermark.fetchedAt << "|" << watermark.lastReadAt << "|" << lastFullSync << "|" << serverUrl;
+    return platform::writeFile(getCategorySyncFilePath(categoryId), ss.str());
+}
+
+bool LibraryCache::loadCategorySyncState(int categoryId, const std::string& serverUrl,
+                                         LibrarySyncWatermark& watermark, int64_t& lastFullSync) {
+    if (!m_enabled) return false;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto fileData = platform::readFile(getCategorySyncFilePath(categoryId));
+    if (fileData.empty()) return false;
+
+    std::istringstream ss(std::string(reinterpret_cast<const char*>(fileData.data()), fileData.size()));
+    std::string fetchedAt, lastReadAt, fullSync, url;
+    if (!std::getline(ss, fetchedAt, '|') || !std::getline(ss, lastReadAt, '|') ||
+        !std::getline(ss, fullSync, '|') || !std::getline(ss, url)) {
+        return false;
+    }
+
+    // A watermark from another server says nothing about this one
+    if (url != serverUrl) return false;
+
+    try {
+        watermark.fetchedAt = std::stoll(fetchedAt);
+        watermark.lastReadAt = std::stoll(lastReadAt);
+        lastFullSync = std::stoll(fullSync);
+    } catch (...) {
+        return false;
+    }
+    return watermark.isValid();
+}
+
+bool LibraryCache::applyCategoryDelta(int categoryId, const CategoryMangaDelta& delta, std::vector<Manga>& manga) {
+    std::set<int> members(delta.memberIds.begin(), delta.memberIds.end());
+    std::map<int, const Manga*> changed;
+    for (const auto& m : delta.changed) {
+        if (members.count(m.id)) changed[m.id] = &m;
+    }
+
+    std::vector<Manga> merged;
+    merged.reserve(delta.memberIds.size());
+    for (auto& m : manga) {
+        if (!members.count(m.id)) continue;
+        auto it = changed.find(m.id);
+        if (it != changed.end()) {
+            merged.push_back(*it->second);
+            changed.erase(it);
+        } else {
+            merged.push_back(std::move(m));
+        }
+    }
+
+    // Whatever is left joined the category since the last sync
+    for (const auto& m : delta.changed) {
+        if (changed.count(m.id)) {
+            merged.push_back(m);
+            changed.erase(m.id);
+        }
+    }
+
+    manga = std::move(merged);
+    return saveCategoryManga(categoryId, manga);
 }
 
 bool LibraryCache::saveAllLibraryManga(const std::vector<Manga>& manga) {
@@ -349,6 +436,7 @@ bool LibraryCache::hasAllLibraryCache() {
 
 bool LibraryCache::saveCoverImage(int mangaId, const std::vector<uint8_t>& imageData) {
     if (!m_coverCacheEnabled || imageData.empty()) return false;
+    PERF_TRACE_SCOPE("cover_disk_write");
 
     std::lock_guard<std::mutex> lock(m_coverMutex);
     return platform::writeFile(getCoverCachePath(mangaId), imageData.data(), imageData.size());
@@ -356,6 +444,7 @@ bool LibraryCache::saveCoverImage(int mangaId, const std::vector<uint8_t>& image
 
 bool LibraryCache::loadCoverImage(int mangaId, std::vector<uint8_t>& imageData) {
     if (!m_coverCacheEnabled) return false;
+    PERF_TRACE_SCOPE("cover_disk_read");
 
     std::lock_guard<std::mutex> lock(m_coverMutex);
 
@@ -382,12 +471,13 @@ std::string LibraryCache::getPageCacheDir() {
     return getCacheDir() + "/pages";
 }
 
-std::string LibraryCache::getPageCachePath(int mangaId, int chapterId, int pageIndex) {
+std::string LibraryCache::getPageCachePath(int mangaId, int chapterId, int pageIndex, bool cropped) {
     return getPageCacheDir() + "/" + std::to_string(mangaId) + "_" +
-           std::to_string(chapterId) + "_" + std::to_string(pageIndex) + ".tga";
+           std::to_string(chapterId) + "_" + std::to_string(pageIndex) + (cropped ? "_c.tga" : ".tga");
 }
 
-bool LibraryCache::savePageImage(int mangaId, int chapterId, int pageIndex, const std::vector<uint8_t>& imageData) {
+bool LibraryCache::savePageImage(int mangaId, int chapterId, int pageIndex, const std::vector<uint8_t>& imageData,
+                                 bool cropped) {
     if (imageData.empty()) return false;
 
     std::lock_guard<std::mutex> lock(m_pageMutex);
@@ -395,14 +485,15 @@ bool LibraryCache::savePageImage(int mangaId, int chapterId, int pageIndex, cons
     // Ensure page cache directory exists
     ensureDirectoryExists(getPageCacheDir());
 
-    std::string path = getPageCachePath(mangaId, chapterId, pageIndex);
+    std::string path = getPageCachePath(mangaId, chapterId, pageIndex, cropped);
     return platform::writeFile(path, imageData.data(), imageData.size());
 }
 
-bool LibraryCache::loadPageImage(int mangaId, int chapterId, int pageIndex, std::vector<uint8_t>& imageData) {
+bool LibraryCache::loadPageImage(int mangaId, int chapterId, int pageIndex, std::vector<uint8_t>& imageData,
+                                 bool cropped) {
     std::lock_guard<std::mutex> lock(m_pageMutex);
 
-    imageData = platform::readFile(getPageCachePath(mangaId, chapterId, pageIndex));
+    imageData = platform::readFile(getPageCachePath(mangaId, chapterId, pageIndex, cropped));
     if (imageData.size() <= 18 || imageData.size() > 16 * 1024 * 1024) {
         imageData.clear();
         return false;
@@ -420,8 +511,8 @@ bool LibraryCache::loadPageImage(int mangaId, int chapterId, int pageIndex, std:
     return false;
 }
 
-bool LibraryCache::hasPageCache(int mangaId, int chapterId, int pageIndex) {
-    return platform::fileExists(getPageCachePath(mangaId, chapterId, pageIndex));
+bool LibraryCache::hasPageCache(int mangaId, int chapterId, int pageIndex, bool cropped) {
+    return platform::fileExists(getPageCachePath(mangaId, chapterId, pageIndex, cropped));
 }
 
 void LibraryCache::clearPageCache() {
@@ -453,6 +544,9 @@ void LibraryCache::clearAllCache() {
     clearLibraryCache();
     clearCoverCache();
     clearPageCache();
+    clearChapterPagesCache();
+    LibrarySearchIndex::getInstance().clear();
+    SuwayomiClient::getInstance().clearResponseCache();
 
     // Also clear the manga-details cache and the categories index so the whole
     // cache is emptied (matches the size reported by getCacheSize()).
@@ -899,4 +993,219 @@ void LibraryCache::invalidateChaptersCache(int mangaId) {
     platform::deleteFile(getChaptersFilePath(mangaId));
 }
 
+// ---- Chapter page-list caching ----
+
+// Page URLs only change when the server re-fetches a chapter from its source,
+// which validateChapterPages() detects; the TTL bounds anything it can't see.
+static const int64_t PAGE_LIST_TTL_SECONDS = 7 * 24 * 60 * 60;
+
+std::string LibraryCache::getPageListsCacheDir() {
+    return getCacheDir() + "/pagelists";
+}
+
+std::string LibraryCache::getPageListFilePath(int chapterId) {
+    return getPageListsCacheDir() + "/" + std::to_string(chapterId) + ".txt";
+}
+
+std::string LibraryCache::getPageDimensionsFilePath(int chapterId) {
+    return getPageListsCacheDir() + "/" + std::to_string(chapterId) + ".dim";
+}
+
+bool LibraryCache::saveChapterPages(int chapterId, const std::vector<Page>& pages) {
+    if (!m_enabled || pages.empty()) return false;
+
+    // Store server URLs relative to the server so the list stays valid when
+    // the same server is reached through a different address
+    std::string serverUrl = SuwayomiClient::getInstance().getServerUrl();
+
+    // Format: first line savedAt|pageCount, then one index|imageUrl per page
+    std::string content = std::to_string(static_cast<int64_t>(std::time(nullptr))) + "|" +
+                          std::to_string(pages.size()) + "\n";
+    for (const auto& page : pages) {
+        std::string url = page.imageUrl;
+        if (!serverUrl.empty() && url.compare(0, serverUrl.size(), serverUrl) == 0) {
+            url = url.substr(serverUrl.size());
+        }
+        content += std::to_string(page.index) + "|" + escapeString(url) + "\n";
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    ensureDirectoryExists(getPageListsCacheDir());
+    std::string path = getPageListFilePath(chapterId);
+    if (!platform::writeFile(path, content)) {
+        brls::Logger::error("LibraryCache: Failed to open {} for writing", path);
+        return false;
+    }
+
+    brls::Logger::debug("LibraryCache: Saved {} page URLs for chapter {}", pages.size(), chapterId);
+    return true;
+}
+
+bool LibraryCache::loadChapterPages(int chapterId, std::vector<Page>& pages) {
+    if (!m_enabled) return false;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    std::string path = getPageListFilePath(chapterId);
+    auto fileData = platform::readFile(path);
+    if (fileData.empty()) return false;
+
+    std::istringstream stream(std::string(reinterpret_cast<const char*>(fileData.data()), fileData.size()));
+    std::string line;
+    if (!std::getline(stream, line)) return false;
+
+    int64_t savedAt = 0;
+    size_t expectedCount = 0;
+    size_t sep = line.find('|');
+    if (sep == std::string::npos) return false;
+    try {
+        savedAt = std::stoll(line.substr(0, sep));
+        expectedCount = static_cast<size_t>(std::stoul(line.substr(sep + 1)));
+    } catch (...) {
+        platform::deleteFile(path);
+        return false;
+    }
+
+    int64_t age = static_cast<int64_t>(std::time(nullptr)) - savedAt;
+    if (age < 0 || age > PAGE_LIST_TTL_SECONDS) {
+        brls::Logger::debug("LibraryCache: Page list for chapter {} expired", chapterId);
+        platform::deleteFile(path);
+        return false;
+    }
+
+    std::string serverUrl = SuwayomiClient::getInstance().getServerUrl();
+    std::vector<Page> loaded;
+    loaded.reserve(expectedCount);
+    while (std::getline(stream, line)) {
+        if (line.empty()) continue;
+        sep = line.find('|');
+        if (sep == std::string::npos) continue;
+        Page page;
+        try {
+            page.index = std::stoi(line.substr(0, sep));
+        } catch (...) {
+            continue;
+        }
+        page.imageUrl = unescapeString(line.substr(sep + 1));
+        if (!page.imageUrl.empty() && page.imageUrl[0] == '/') {
+            page.imageUrl = serverUrl + page.imageUrl;
+        }
+        loaded.push_back(std::move(page));
+    }
+
+    // Truncated or corrupt file
+    if (loaded.empty() || loaded.size() != expectedCount) {
+        platform::deleteFile(path);
+        return false;
+    }
+
+    pages = std::move(loaded);
+    brls::Logger::debug("LibraryCache: Loaded {} page URLs for chapter {} from cache", pages.size(), chapterId);
+    return true;
+}
+
+bool LibraryCache::validateChapterPages(const Chapter& chapter) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    std::string path = getPageListFilePath(chapter.id);
+    auto fileData = platform::readFile(path);
+    if (fileData.empty()) return false;
+
+    // Only the header line is needed: savedAt|pageCount
+    std::string header(reinterpret_cast<const char*>(fileData.data()),
+                       std::min(fileData.size(), static_cast<size_t>(64)));
+    size_t sep = header.find('|');
+    int64_t savedAt = 0;
+    int cachedCount = 0;
+    if (sep != std::string::npos) {
+        try {
+            savedAt = std::stoll(header.substr(0, sep));
+            cachedCount = std::stoi(header.substr(sep + 1));
+        } catch (...) {
+            sep = std::string::npos;
+        }
+    }
+
+    bool countChanged = chapter.pageCount > 0 && chapter.pageCount != cachedCount;
+    bool refetched = chapter.fetchedAt > savedAt;
+    if (sep != std::string::npos && !countChanged && !refetched) return false;
+
+    brls::Logger::info("LibraryCache: Dropping page list for chapter {} (pages {} -> {}, refetched={})",
+                       chapter.id, cachedCount, chapter.pageCount, refetched);
+    platform::deleteFile(path);
+    platform::deleteFile(getPageDimensionsFilePath(chapter.id));
+    return true;
+}
+
+void LibraryCache::invalidateChapterPages(int chapterId) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    platform::deleteFile(getPageListFilePath(chapterId));
+    platform::deleteFile(getPageDimensionsFilePath(chapterId));
+}
+
+void LibraryCache::clearChapterPagesCache() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::string dir = getPageListsCacheDir();
+
+    for (const auto& name : platform::listDir(dir)) {
+        if (name.find(".txt") != std::string::npos || name.find(".dim") != std::string::npos) {
+            platform::deleteFile(dir + "/" + name);
+        }
+    }
+}
+
+bool LibraryCache::savePageDimensions(int chapterId, const std::vector<std::pair<int, int>>& sizes) {
+    if (!m_enabled || sizes.empty()) return false;
+
+    // Format: first line pageCount, then one width|height per page index
+    std::string content = std::to_string(sizes.size()) + "\n";
+    for (const auto& size : sizes) {
+        content += std::to_string(size.first) + "|" + std::to_string(size.second) + "\n";
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    ensureDirectoryExists(getPageListsCacheDir());
+    std::string path = getPageDimensionsFilePath(chapterId);
+    if (!platform::writeFile(path, content)) {
+        brls::Logger::error("LibraryCache: Failed to open {} for writing", path);
+        return false;
+    }
+    return true;
+}
+
+bool LibraryCache::loadPageDimensions(int chapterId, std::vector<std::pair<int, int>>& sizes) {
+    if (!m_enabled) return false;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    std::string path = getPageDimensionsFilePath(chapterId);
+    auto fileData = platform::readFile(path);
+    if (fileData.empty()) return false;
+
+    std::istringstream stream(std::string(reinterpret_cast<const char*>(fileData.data()), fileData.size()));
+    std::string line;
+    size_t expectedCount = 0;
+    try {
+        if (!std::getline(stream, line)) return false;
+        expectedCount = static_cast<size_t>(std::stoul(line));
+
+        std::vector<std::pair<int, int>> loaded;
+        loaded.reserve(expectedCount);
+        while (std::getline(stream, line)) {
+            size_t sep = line.find('|');
+            if (sep == std::string::npos) break;
+            loaded.push_back({std::stoi(line.substr(0, sep)), std::stoi(line.substr(sep + 1))});
+        }
+        if (loaded.size() != expectedCount) {
+            platform::deleteFile(path);
+            return false;
+        }
+        sizes = std::move(loaded);
+    } catch (...) {
+        platform::deleteFile(path);
+        return false;
+    }
+    return true;
+}
+
 } // namespace vitasuwayomi
@@ -0,0 +1,492 @@
+/**
+ * VitaSuwayomi - Offline Library Search implementation
+ */
+
+#include "utils/library_search.hpp"
+#include "utils/library_cache.hpp"
+#include "utils/async.hpp"
+#include "utils/timer_wheel.hpp"
+#include <borealis.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+#include "platform/platform.hpp"
+
+namespace vitasuwayomi {
+
+// Field weights: a title hit outranks any number of description hits
+static constexpr uint16_t WEIGHT_TITLE = 10;
+static constexpr uint16_t WEIGHT_PEOPLE = 4;   // author / artist
+static constexpr uint16_t WEIGHT_GENRE = 3;
+static constexpr uint16_t WEIGHT_DESCRIPTION = 1;
+// Only the start of the description is indexed; synopses can run to several
+// KB and the tail is rarely what someone types into a search box.
+static constexpr size_t DESCRIPTION_INDEX_CHARS = 512;
+// Fraction of query trigrams a document must contain to count as a match.
+// Low enough that one or two typos in a word still match.
+static constexpr float MIN_MATCH_FRACTION = 0.4f;
+// Index updates within this window share one file write. The index is
+// rebuilt from the library cache, so losing the last window at exit is fine.
+static constexpr int SAVE_DELAY_MS = 2000;
+
+static const char INDEX_MAGIC[4] = {'L', 'S', 'X', '1'};
+
+LibrarySearchIndex& LibrarySearchIndex::getInstance() {
+    static LibrarySearchIndex instance;
+    return instance;
+}
+
+std::string LibrarySearchIndex::getIndexFilePath() {
+    return platform::path("cache") + "/search_index.bin";
+}
+
+std::string LibrarySearchIndex::normalize(const std::string& text) {
+    // Lowercase ASCII, keep digits and UTF-8 bytes, fold punctuation to single spaces
+    std::string out;
+    out.reserve(text.size());
+    bool lastSpace = true;
+    for (unsigned char c : text) {
+        if (c >= 'A' && c <= 'Z') {
+            out += static_cast<char>(c - 'A' + 'a');
+            lastSpace = false;
+        } else if ((c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c >= 0x80) {
+            out += static_cast<char>(c);
+            lastSpace = false;
+        } else if (!lastSpace) {
+            out += ' ';
+            lastSpace = true;
+        }
+    }
+    if (!out.empty() && out.back() == ' ') out.pop_back();
+    return out;
+}
+
+void LibrarySearchIndex::addGrams(const std::string& normalized, uint16_t weight,
+                                  std::unordered_map<uint32_t, uint16_t>& out) {
+    // Each word is padded with a space on both sides so word starts and ends
+    // get their own trigrams (" ber", "rk ") and short words still produce one.
+    std::vector<uint32_t> fieldGrams;
+    size_t start = 0;
+    while (start < normalized.size()) {
+        size_t end = normalized.find(' ', start);
+        if (end == std::string::npos) end = normalized.size();
+
+        std::string padded = " " + normalized.substr(start, end - start) + " ";
+        for (size_t i = 0; i + 3 <= padded.size(); i++) {
+            uint32_t key = (static_cast<uint32_t>(static_cast<unsigned char>(padded[i])) << 16) |
+                           (static_cast<uint32_t>(static_cast<unsigned char>(padded[i + 1])) << 8) |
+                           static_cast<uint32_t>(static_cast<unsigned char>(padded[i + 2]));
+            fieldGrams.push_back(key);
+        }
+        start = end + 1;
+    }
+
+    // A trigram repeated within one field counts once
+    std::sort(fieldGrams.begin(), fieldGrams.end());
+    fieldGrams.erase(std::unique(fieldGrams.begin(), fieldGrams.end()), fieldGrams.end());
+
+    for (uint32_t key : fieldGrams) {
+        uint32_t sum = static_cast<uint32_t>(out[key]) + weight;
+        out[key] = static_cast<uint16_t>(std::min<uint32_t>(sum, 0xFFFF));
+    }
+}
+
+uint32_t LibrarySearchIndex::computeSignature(const Manga& manga) {
+    // FNV-1a over the indexed fields, so unchanged entries are skipped on update
+    uint32_t hash = 2166136261u;
+    auto mix = [&hash](const std::string& s) {
+        for (unsigned char c : s) {
+            hash ^= c;
+            hash *= 16777619u;
+        }
+        hash ^= 0x1F;
+        hash *= 16777619u;
+    };
+    mix(manga.title);
+    mix(manga.author);
+    mix(manga.artist);
+    mix(manga.description);
+    for (const auto& g : manga.genre) mix(g);
+    return hash;
+}
+
+LibrarySearchIndex::Doc LibrarySearchIndex::buildDoc(const Manga& manga, uint32_t signature) {
+    Doc doc;
+    doc.mangaId = manga.id;
+    doc.signature = signature;
+    doc.title = normalize(manga.title);
+
+    std::unordered_map<uint32_t, uint16_t> grams;
+    addGrams(doc.title, WEIGHT_TITLE, grams);
+    addGrams(normalize(manga.author), WEIGHT_PEOPLE, grams);
+    if (manga.artist != manga.author) {
+        addGrams(normalize(manga.artist), WEIGHT_PEOPLE, grams);
+    }
+    for (const auto& g : manga.genre) {
+        addGrams(normalize(g), WEIGHT_GENRE, grams);
+    }
+    if (manga.description.size() > DESCRIPTION_INDEX_CHARS) {
+        addGrams(normalize(manga.description.substr(0, DESCRIPTION_INDEX_CHARS)), WEIGHT_DESCRIPTION, grams);
+    } else {
+        addGrams(normalize(manga.description), WEIGHT_DESCRIPTION, grams);
+    }
+
+    doc.grams.reserve(grams.size());
+    for (const auto& kv : grams) {
+        doc.grams.push_back({kv.first, kv.second});
+    }
+    return doc;
+}
+
+void LibrarySearchIndex::ensureLoaded() {
+    if (m_loaded) return;
+    m_loaded = true;
+    if (load()) {
+        brls::Logger::info("LibrarySearchIndex: Loaded {} entries", m_slotById.size());
+    }
+}
+
+void LibrarySearchIndex::rebuildPostings() {
+    m_postings.clear();
+    for (uint32_t slot = 0; slot < m_docs.size(); slot++) {
+        const Doc& doc = m_docs[slot];
+        if (doc.mangaId == 0) continue;
+        for (const auto& g : doc.grams) {
+            m_postings[g.key].push_back({slot, g.weight});
+        }
+    }
+    m_scratchScore.assign(m_docs.size(), 0.0f);
+    m_scratchHits.assign(m_docs.size(), 0);
+    m_postingsDirty = false;
+}
+
+bool LibrarySearchIndex::update(const std::vector<Manga>& mangaList) {
+    std::vector<std::pair<const Manga*, uint32_t>> pending;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ensureLoaded();
+        for (const auto& manga : mangaList) {
+            if (manga.id <= 0) continue;
+            uint32_t signature = computeSignature(manga);
+            auto it = m_slotById.find(manga.id);
+            if (it != m_slotById.end() && m_docs[it->second].signature == signature) continue;
+            pending.push_back({&manga, signature});
+        }
+    }
+    if (pending.empty()) return false;
+
+    // Build outside the lock: filling in genre/description from the details
+    // cache touches the disk once per new or changed entry.
+    std::vector<Doc> built;
+    built.reserve(pending.size());
+    for (const auto& entry : pending) {
+        const Manga& manga = *entry.first;
+        if (manga.genre.empty() || manga.description.empty()) {
+            Manga details;
+            if (LibraryCache::getInstance().loadMangaDetails(manga.id, details)) {
+                Manga merged = manga;
+                if (merged.genre.empty()) merged.genre = details.genre;
+                if (merged.description.empty()) merged.description = details.description;
+                built.push_back(buildDoc(merged, entry.second));
+                continue;
+            }
+        }
+        built.push_back(buildDoc(manga, entry.second));
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto& doc : built) {
+            auto it = m_slotById.find(doc.mangaId);
+            if (it != m_slotById.end()) {
+                m_docs[it->second] = std::move(doc);
+            } else {
+                m_slotById[doc.mangaId] = static_cast<uint32_t>(m_docs.size());
+                m_docs.push_back(std::move(doc));
+            }
+        }
+        m_postingsDirty = true;
+        scheduleSaveLocked();
+    }
+
+    brls::Logger::debug("LibrarySearchIndex: Indexed {} new/changed entries", built.size());
+    return true;
+}
+
+void LibrarySearchIndex::updateAsync(const std::vector<Manga>& mangaList, std::function<void()> onChanged) {
+    {
+        std::lock_guard<std::mutex> lock(m_queueMutex);
+        if (!m_hasQueued) {
+            m_queuedList = mangaList;
+        } else {
+            // Keep what the earlier callers queued; their callbacks expect it indexed
+            std::unordered_map<int, size_t> indexById;
+            for (size_t i = 0; i < m_queuedList.size(); i++) indexById[m_queuedList[i].id] = i;
+            for (const auto& manga : mangaList) {
+                auto it = indexById.find(manga.id);
+                if (it != indexById.end()) {
+                    m_queuedList[it->second] = manga;
+                } else {
+                    indexById[manga.id] = m_queuedList.size();
+                    m_queuedList.push_back(manga);
+                }
+            }
+        }
+        if (onChanged) m_queuedCallbacks.push_back(std::move(onChanged));
+        m_hasQueued = true;
+        if (m_workerRunning) return;
+        m_workerRunning = true;
+    }
+
+    asyncRun([this]() {
+        while (true) {
+            std::vector<Manga> next;
+            std::vector<std::function<void()>> callbacks;
+            {
+                std::lock_guard<std::mutex> lock(m_queueMutex);
+                if (!m_hasQueued) {
+                    m_workerRunning = false;
+                    return;
+                }
+                next.swap(m_queuedList);
+                callbacks.swap(m_queuedCallbacks);
+                m_hasQueued = false;
+            }
+            if (!update(next)) continue;
+            for (auto& callback : callbacks) {
+                brls::sync(std::move(callback));
+            }
+        }
+    }, TaskPriority::LOW);
+}
+
+void LibrarySearchIndex::remove(int mangaId) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ensureLoaded();
+        auto it = m_slotById.find(mangaId);
+        if (it == m_slotById.end()) return;
+        // Leave the slot empty; it is compacted away on the next load
+        m_docs[it->second] = Doc();
+        m_slotById.erase(it);
+        m_postingsDirty = true;
+        scheduleSaveLocked();
+    }
+}
+
+void LibrarySearchIndex::clear() {
+    std::lock_guard<std::mutex> saveLock(m_saveMutex);
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_docs.clear();
+    m_slotById.clear();
+    m_postings.clear();
+    m_scratchScore.clear();
+    m_scratchHits.clear();
+    m_postingsDirty = true;
+    m_loaded = true;
+    if (m_saveTimer != 0) {
+        TimerWheel::getInstance().cancel(m_saveTimer);
+        m_saveTimer = 0;
+    }
+    platform::deleteFile(getIndexFilePath());
+}
+
+size_t LibrarySearchIndex::size() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    ensureLoaded();
+    return m_slotById.size();
+}
+
+std::vector<LibrarySearchIndex::Result> LibrarySearchIndex::search(const std::string& query, size_t maxResults) {
+    std::vector<Result> results;
+    std::string q = normalize(query);
+    if (q.empty()) return results;
+
+    auto startTime = std::chrono::steady_clock::now();
+    std::lock_guard<std::mutex> lock(m_mutex);
+    ensureLoaded();
+
+    if (q.size() < 3) {
+        // Too short for trigrams to discriminate: plain title substring scan
+        for (const auto& doc : m_docs) {
+            if (doc.mangaId == 0) continue;
+            size_t pos = doc.title.find(q);
+            if (pos == std::string::npos) continue;
+            float score = 1.0f;
+            if (pos == 0) score = 3.0f;
+            else if (doc.title[pos - 1] == ' ') score = 2.0f;
+            results.push_back({doc.mangaId, score});
+        }
+    } else {
+        if (m_postingsDirty) rebuildPostings();
+
+        std::unordered_map<uint32_t, uint16_t> queryGrams;
+        addGrams(q, 1, queryGrams);
+        size_t gramCount = queryGrams.size();
+        uint16_t minHits = static_cast<uint16_t>(
+            std::max<size_t>(1, static_cast<size_t>(gramCount * MIN_MATCH_FRACTION + 0.5f)));
+
+        std::vector<uint32_t> touched;
+        for (const auto& kv : queryGrams) {
+            auto it = m_postings.find(kv.first);
+            if (it == m_postings.end()) continue;
+            for (const auto& posting : it->second) {
+                if (m_scratchHits[posting.slot] == 0) touched.push_back(posting.slot);
+                m_scratchHits[posting.slot]++;
+                m_scratchScore[posting.slot] += posting.weight;
+            }
+        }
+
+        for (uint32_t slot : touched) {
+            uint16_t hits = m_scratchHits[slot];
+            float score = m_scratchScore[slot];
+            m_scratchHits[slot] = 0;
+            m_scratchScore[slot] = 0.0f;
+            if (hits < minHits) continue;
+
+            // Favour documents that cover more of the query over ones that
+            // hit a few common trigrams in several fields
+            float coverage = static_cast<float>(hits) / static_cast<float>(gramCount);
+            score *= coverage * coverage;
+
+            const Doc& doc = m_docs[slot];
+            size_t pos = doc.title.find(q);
+            if (pos == 0) {
+                score += 1000.0f;
+            } else if (pos != std::string::npos) {
+                score += (doc.title[pos - 1] == ' ') ? 700.0f : 500.0f;
+            }
+            results.push_back({doc.mangaId, score});
+        }
+    }
+
+    std::sort(results.begin(), results.end(), [](const Result& a, const Result& b) {
+        if (a.score != b.score) return a.score > b.score;
+        return a.mangaId < b.mangaId;
+    });
+    if (results.size() > maxResults) results.resize(maxResults);
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - startTime).count();
+    brls::Logger::debug("LibrarySearchIndex: '{}' -> {} results in {}us", q, results.size(), elapsed);
+    return results;
+}
+
+// Binary layout (native endianness, the file never leaves the device):
+//   "LSX1" u32 docCount
+//   per doc: i32 mangaId, u32 signature, u16 titleLen, title bytes,
+//            u32 gramCount, gramCount x (u32 key, u16 weight)
+template<typename T>
+static void appendRaw(std::string& out, T value) {
+    out.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template<typename T>
+static bool readRaw(const std::vector<uint8_t>& data, size_t& offset, T& value) {
+    if (offset + sizeof(T) > data.size()) return false;
+    std::memcpy(&value, data.data() + offset, sizeof(T));
+    offset += sizeof(T);
+    return true;
+}
+
+std::string LibrarySearchIndex::serialize() {
+    std::string out;
+    out.append(INDEX_MAGIC, sizeof(INDEX_MAGIC));
+    appendRaw<uint32_t>(out, static_cast<uint32_t>(m_slotById.size()));
+    for (const auto& doc : m_docs) {
+        if (doc.mangaId == 0) continue;
+        uint16_t titleLen = static_cast<uint16_t>(std::min<size_t>(doc.title.size(), 0xFFFF));
+        appendRaw<int32_t>(out, doc.mangaId);
+        appendRaw<uint32_t>(out, doc.signature);
+        appendRaw<uint16_t>(out, titleLen);
+        out.append(doc.title.data(), titleLen);
+        appendRaw<uint32_t>(out, static_cast<uint32_t>(doc.grams.size()));
+        for (const auto& g : doc.grams) {
+            appendRaw<uint32_t>(out, g.key);
+            appendRaw<uint16_t>(out, g.weight);
+        }
+    }
+    return out;
+}
+
+void LibrarySearchIndex::scheduleSaveLocked() {
+    if (m_saveTimer != 0) return;
+    m_saveTimer = TimerWheel::getInstance().schedule(SAVE_DELAY_MS, [this]() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_saveTimer = 0;
+        }
+        save();
+    }, TimerDispatch::WORKER);
+}
+
+void LibrarySearchIndex::save() {
+    std::lock_guard<std::mutex> saveLock(m_saveMutex);
+    std::string data;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        data = serialize();
+    }
+    if (!platform::writeFile(getIndexFilePath(), data)) {
+        brls::Logger::warning("LibrarySearchIndex: Failed to write index");
+    }
+}
+
+bool LibrarySearchIndex::load() {
+    std::vector<uint8_t> data = platform::readFile(getIndexFilePath());
+    if (data.size() < sizeof(INDEX_MAGIC) + sizeof(uint32_t)) return false;
+    if (std::memcmp(data.data(), INDEX_MAGIC, sizeof(INDEX_MAGIC)) != 0) {
+        brls::Logger::warning("LibrarySearchIndex: Unknown index format, rebuilding");
+        return false;
+    }
+
+    size_t offset = sizeof(INDEX_MAGIC);
+    uint32_t docCount = 0;
+    readRaw(data, offset, docCount);
+    // Smallest doc: id, signature, empty title, no grams
+    static constexpr size_t MIN_DOC_BYTES = sizeof(int32_t) + sizeof(uint32_t) + sizeof(uint16_t) + sizeof(uint32_t);
+    if (docCount > (data.size() - offset) / MIN_DOC_BYTES) {
+        brls::Logger::warning("LibrarySearchIndex: Corrupt doc count {}, rebuilding", docCount);
+        return false;
+    }
+
+    std::vector<Doc> docs;
+    docs.reserve(docCount);
+    for (uint32_t i = 0; i < docCount; i++) {
+        Doc doc;
+        int32_t mangaId = 0;
+        uint16_t titleLen = 0;
+        uint32_t gramCount = 0;
+        if (!readRaw(data, offset, mangaId) || !readRaw(data, offset, doc.signature) ||
+            !readRaw(data, offset, titleLen) || offset + titleLen > data.size()) {
+            brls::Logger::warning("LibrarySearchIndex: Truncated index, rebuilding");
+            return false;
+        }
+        doc.mangaId = mangaId;
+        doc.title.assign(reinterpret_cast<const char*>(data.data() + offset), titleLen);
+        offset += titleLen;
+
+        if (!readRaw(data, offset, gramCount) ||
+            offset + static_cast<size_t>(gramCount) * (sizeof(uint32_t) + sizeof(uint16_t)) > data.size()) {
+            brls::Logger::warning("LibrarySearchIndex: Truncated index, rebuilding");
+            return false;
+        }
+        doc.grams.resize(gramCount);
+        for (auto& g : doc.grams) {
+            readRaw(data, offset, g.key);
+            readRaw(data, offset, g.weight);
+        }
+        docs.push_back(std::move(doc));
+    }
+
+    m_docs = std::move(docs);
+    m_slotById.clear();
+    for (uint32_t slot = 0; slot < m_docs.size(); slot++) {
+        m_slotById[m_docs[slot].mangaId] = slot;
+    }
+    m_postingsDirty = true;
+    return true;
+}
+
+} // namespace vitasuwayomi
@@ -3,6 +3,11 @@
  */
 
 #include "utils/perf_overlay.hpp"
+#include "utils/thread_pool.hpp"
+#include "utils/texture_residency.hpp"
+#include "utils/perf_trace.hpp"
+#include "platform/platform.hpp"
+#include "app/suwayomi_client.hpp"
 #include <cstring>
 #include <cstdio>
 #include <algorithm>
@@ -11,6 +16,15 @@ namespace vitasuwayomi {
 
 static const char* PERF_LOG_PATH = "ux0:data/VitaSuwayomi/perf.log";
 
+// Longer than this between begin and end is a suspend or a loading stall,
+// not a frame
+static constexpr float MAX_FRAME_MS = 1000.0f;
+
+// A frame counts as jank once it runs half a period past its target, so
+// vsync and timer jitter around 16.7ms/33.3ms doesn't count as a miss
+static constexpr float JANK_60_MS = 1.5f * 1000.0f / 60.0f;  // 25ms
+static constexpr float JANK_30_MS = 1.5f * 1000.0f / 30.0f;  // 50ms
+
 PerfOverlay& PerfOverlay::getInstance() {
     static PerfOverlay instance;
     return instance;
@@ -48,23 +62,67 @@ void PerfOverlay::writeLogEntry() {
     for (int i = 0; i < m_sectionCount; i++) {
         fprintf(m_logFile, " | %s:%.1fms", m_sections[i].name, m_sections[i].lastMs);
     }
+    TextureResidency::Stats vram = TextureResidency::getInstance().getStats();
+    fprintf(m_logFile, " | VRAM:%zuKB/%zuKB peak:%zuKB tex:%d evict:%llu",
+            vram.residentBytes / 1024, vram.budgetBytes / 1024, vram.peakBytes / 1024,
+            vram.textures, static_cast<unsigned long long>(vram.evictions));
+    const ScreenStats& screen = m_screenStats[static_cast<int>(m_frameScreen)];
+    if (screen.frames.count() > 0) {
+        fprintf(m_logFile, " | %s p50:%.1fms p99:%.1fms jank:%llu/%llu",
+                screenName(m_frameScreen), screen.frames.percentileMs(50.0f), screen.frames.percentileMs(99.0f),
+                static_cast<unsigned long long>(screen.jank60), static_cast<unsigned long long>(screen.jank30));
+    }
+    if (m_turnCount > 0) {
+        fprintf(m_logFile, " | Turn p50:%.0fms p90:%.0fms p99:%.0fms (n=%d)",
+                getPageTurnPercentile(50.0f), getPageTurnPercentile(90.0f),
+                getPageTurnPercentile(99.0f), m_turnCount);
+    }
     fprintf(m_logFile, "\n");
     fflush(m_logFile);
 }
 
-void PerfOverlay::beginFrame() {
-    if (!m_enabled) return;
+bool PerfOverlay::isTiming() const {
+    return m_enabled || PerfTrace::getInstance().isRecording();
+}
+
+void PerfOverlay::setEnabled(bool enabled) {
+    if (enabled && !m_enabled) resetStats();
+    m_enabled = enabled;
+}
+
+void PerfOverlay::beginFrame(PerfScreen screen) {
+    if (!isTiming()) return;
     m_frameStart = Clock::now();
+    m_frameStartUs = PerfTrace::nowUs();
+    m_frameOpen = true;
+    m_frameScreen = screen;
     m_textureUploadsThisFrame = 0;
 }
 
-void PerfOverlay::endFrame() {
-    if (!m_enabled) return;
+void PerfOverlay::endFrame(PerfScreen screen) {
+    if (!isTiming()) return;
 
+    // Not recorded: a frame begun before timing started, one begun by another
+    // screen (the interval spans a screen switch) and one stretched by a suspend
     auto now = Clock::now();
     float frameMs = std::chrono::duration<float, std::milli>(now - m_frameStart).count();
+    bool frameOpen = m_frameOpen && m_frameScreen == screen && frameMs <= MAX_FRAME_MS;
+    m_frameOpen = false;
+    if (!frameOpen) return;
+
+    PerfTrace& trace = PerfTrace::getInstance();
+    if (trace.isRecording()) {
+        trace.record("frame", m_frameStartUs, PerfTrace::nowUs());
+    }
+    if (!m_enabled) return;
+
     m_frameTimeMs = frameMs;
 
+    ScreenStats& stats = m_screenStats[static_cast<int>(m_frameScreen)];
+    stats.frames.recordMs(frameMs);
+    if (frameMs > JANK_60_MS) stats.jank60++;
+    if (frameMs > JANK_30_MS) stats.jank30++;
+
     // Record to history
     m_frameTimeHistory[m_historyIndex] = frameMs;
     m_historyIndex = (m_historyIndex + 1) % HISTORY_SIZE;
@@ -94,7 +152,7 @@ void PerfOverlay::endFrame() {
 }
 
 void PerfOverlay::beginSection(const char* name) {
-    if (!m_enabled) return;
+    if (!isTiming()) return;
     int idx = findSection(name);
     if (idx < 0) {
         if (m_sectionCount >= MAX_SECTIONS) return;
@@ -102,14 +160,21 @@ void PerfOverlay::beginSection(const char* name) {
         m_sections[idx].name = name;
     }
     m_sections[idx].start = Clock::now();
+    m_sections[idx].startUs = PerfTrace::nowUs();
 }
 
 void PerfOverlay::endSection(const char* name) {
-    if (!m_enabled) return;
+    if (!isTiming()) return;
     int idx = findSection(name);
     if (idx < 0) return;
     auto now = Clock::now();
     m_sections[idx].lastMs = std::chrono::duration<float, std::milli>(now - m_sections[idx].start).count();
+    if (m_enabled) {
+        m_screenStats[static_cast<int>(m_frameScreen)].sections[idx].recordMs(m_sections[idx].lastMs);
+    }
+
+    PerfTrace& trace = PerfTrace::getInstance();
+    if (trace.isRecording()) trace.record(name, m_sections[idx].startUs, PerfTrace::nowUs());
 }
 
 void PerfOverlay::recordTextureUploads(int count) {
@@ -120,6 +185,92 @@ void PerfOverlay::recordPendingTextures(int count) {
     m_pendingTextures = count;
 }
 
+void PerfOverlay::recordPageTurn(float ms) {
+    m_turnHistory[m_turnIndex] = ms;
+    m_turnIndex = (m_turnIndex + 1) % TURN_HISTORY_SIZE;
+    if (m_turnCount < TURN_HISTORY_SIZE) m_turnCount++;
+}
+
+float PerfOverlay::getPageTurnPercentile(float percentile) const {
+    if (m_turnCount == 0) return 0.0f;
+
+    // Nearest-rank percentile over a sorted copy (at most 64 samples)
+    float sorted[TURN_HISTORY_SIZE];
+    std::copy(m_turnHistory, m_turnHistory + m_turnCount, sorted);
+    std::sort(sorted, sorted + m_turnCount);
+    float clamped = std::max(0.0f, std::min(100.0f, percentile));
+    int rank = static_cast<int>(clamped / 100.0f * m_turnCount + 0.5f);
+    return sorted[std::max(0, std::min(m_turnCount - 1, rank - 1))];
+}
+
+const char* PerfOverlay::screenName(PerfScreen screen) {
+    switch (screen) {
+        case PerfScreen::GRID: return "grid";
+        case PerfScreen::READER: return "reader";
+        case PerfScreen::WEBTOON: return "webtoon";
+        default: return "other";
+    }
+}
+
+float PerfOverlay::getFramePercentile(PerfScreen screen, float percentile) const {
+    int index = static_cast<int>(screen);
+    if (index < 0 || index >= SCREEN_COUNT) return 0.0f;
+    return m_screenStats[index].frames.percentileMs(percentile);
+}
+
+void PerfOverlay::resetStats() {
+    for (ScreenStats& stats : m_screenStats) {
+        stats.frames.reset();
+        for (FrameHistogram& section : stats.sections) section.reset();
+        stats.jank60 = 0;
+        stats.jank30 = 0;
+    }
+}
+
+// One row per screen and metric. The last column lists the non-empty
+// buckets as "upper_us:count" so the full distribution can be rebuilt.
+static void appendStatsRow(std::string& out, const char* screen, const char* metric,
+                           const FrameHistogram& hist, const char* jank60, const char* jank30) {
+    char buf[192];
+    snprintf(buf, sizeof(buf), "%s,%s,%llu,%.2f,%.2f,%.2f,%.2f,%.2f,%s,%s,", screen, metric,
+             static_cast<unsigned long long>(hist.count()), hist.meanMs(), hist.percentileMs(50.0f),
+             hist.percentileMs(95.0f), hist.percentileMs(99.0f), hist.maxMs(), jank60, jank30);
+    out += buf;
+    bool first = true;
+    for (int i = 0; i < FrameHistogram::BUCKET_COUNT; i++) {
+        uint32_t n = hist.bucketCount(i);
+        if (n == 0) continue;
+        snprintf(buf, sizeof(buf), "%s%u:%u", first ? "" : " ", FrameHistogram::bucketUpperUs(i), n);
+        out += buf;
+        first = false;
+    }
+    out += "\n";
+}
+
+bool PerfOverlay::dumpStats(const std::string& path) const {
+    std::string out = "screen,metric,samples,mean_ms,p50_ms,p95_ms,p99_ms,max_ms,jank_over_25ms,jank_over_50ms,buckets\n";
+    for (int s = 0; s < SCREEN_COUNT; s++) {
+        const ScreenStats& stats = m_screenStats[s];
+        if (stats.frames.count() == 0) continue;
+        const char* screen = screenName(static_cast<PerfScreen>(s));
+
+        std::string jank60 = std::to_string(stats.jank60);
+        std::string jank30 = std::to_string(stats.jank30);
+        appendStatsRow(out, screen, "frame", stats.frames, jank60.c_str(), jank30.c_str());
+        for (int i = 0; i < m_sectionCount; i++) {
+            if (stats.sections[i].count() == 0) continue;
+            appendStatsRow(out, screen, m_sections[i].name, stats.sections[i], "", "");
+        }
+    }
+
+    if (!platform::writeFile(path, out)) {
+        brls::Logger::error("PerfOverlay: Failed to write {}", path);
+        return false;
+    }
+    brls::Logger::info("PerfOverlay: Frame statistics written to {}", path);
+    return true;
+}
+
 int PerfOverlay::findSection(const char* name) {
     for (int i = 0; i < m_sectionCount; i++) {
         if (m_sections[i].name == name) return i;  // Pointer comparison (same literal)
@@ -133,7 +284,7 @@ void PerfOverlay::draw(NVGcontext* vg, float screenWidth, float screenHeight) {
     // Overlay position: top-right corner
     float panelW = 220.0f;
     float lineH = 14.0f;
-    int numLines = 4 + m_sectionCount;  // FPS, frame time, textures, pending + sections
+    int numLines = 8 + m_sectionCount;  // FPS, frame time, percentiles, textures, VRAM, target, page turns, pool + sections
     float graphH = 40.0f;
     float panelH = (numLines * lineH) + graphH + 16.0f;
     float panelX = screenWidth - panelW - 4.0f;
@@ -171,6 +322,17 @@ void PerfOverlay::draw(NVGcontext* vg, float screenWidth, float screenHeight) {
     nvgText(vg, textX, textY, buf, nullptr);
     textY += lineH;
 
+    // Frame-time percentiles on this screen and janky frames (over 25/50ms)
+    const ScreenStats& screen = m_screenStats[static_cast<int>(m_frameScreen)];
+    snprintf(buf, sizeof(buf), "%s p50/95/99: %.1f/%.1f/%.1fms  jank %llu/%llu", screenName(m_frameScreen),
+             screen.frames.percentileMs(50.0f), screen.frames.percentileMs(95.0f),
+             screen.frames.percentileMs(99.0f), static_cast<unsigned long long>(screen.jank60),
+             static_cast<unsigned long long>(screen.jank30));
+    NVGcolor pctColor = screen.frames.percentileMs(99.0f) > 33.3f ? nvgRGB(255, 128, 0) : nvgRGB(180, 180, 180);
+    nvgFillColor(vg, pctColor);
+    nvgText(vg, textX, textY, buf, nullptr);
+    textY += lineH;
+
     // Texture upload stats
     snprintf(buf, sizeof(buf), "Tex uploads: %d  pending: %d", m_textureUploadsThisFrame, m_pendingTextures);
     NVGcolor texColor = m_pendingTextures > 10 ? nvgRGB(255, 128, 0) : nvgRGB(180, 180, 180);
@@ -178,12 +340,46 @@ void PerfOverlay::draw(NVGcontext* vg, float screenWidth, float screenHeight) {
     nvgText(vg, textX, textY, buf, nullptr);
     textY += lineH;
 
+    // Tracked texture memory against the VRAM budget, and evictions so far
+    TextureResidency::Stats vram = TextureResidency::getInstance().getStats();
+    snprintf(buf, sizeof(buf), "VRAM: %.1f/%.0fMB  tex %d  evicted %llu",
+             vram.residentBytes / (1024.0f * 1024.0f), vram.budgetBytes / (1024.0f * 1024.0f),
+             vram.textures, static_cast<unsigned long long>(vram.evictions));
+    NVGcolor vramColor = vram.residentBytes > vram.budgetBytes ? nvgRGB(255, 128, 0) : nvgRGB(180, 180, 180);
+    nvgFillColor(vg, vramColor);
+    nvgText(vg, textX, textY, buf, nullptr);
+    textY += lineH;
+
     // Target line label
     snprintf(buf, sizeof(buf), "Target: 16.7ms (60fps)");
     nvgFillColor(vg, nvgRGB(120, 120, 120));
     nvgText(vg, textX, textY, buf, nullptr);
     textY += lineH;
 
+    // Reader page-turn latency percentiles
+    if (m_turnCount > 0) {
+        snprintf(buf, sizeof(buf), "Turn p50/90/99: %.0f/%.0f/%.0fms",
+                 getPageTurnPercentile(50.0f), getPageTurnPercentile(90.0f), getPageTurnPercentile(99.0f));
+    } else {
+        snprintf(buf, sizeof(buf), "Turn: no samples");
+    }
+    NVGcolor turnColor = getPageTurnPercentile(90.0f) > 100.0f ? nvgRGB(255, 128, 0) : nvgRGB(180, 180, 180);
+    nvgFillColor(vg, turnColor);
+    nvgText(vg, textX, textY, buf, nullptr);
+    textY += lineH;
+
+    // Worker pool: busy workers and queue depth by priority (high/normal/low),
+    // plus reads served by another caller's in-flight request
+    ThreadPool::Stats pool = ThreadPool::getInstance().getStats();
+    size_t poolQueued = pool.queued[0] + pool.queued[1] + pool.queued[2];
+    unsigned long long coalesced = SuwayomiClient::getInstance().getCoalescedRequestCount();
+    snprintf(buf, sizeof(buf), "Pool: %d/%d busy  q %zu/%zu/%zu (peak %zu)  shared %llu", pool.busy, pool.workers,
+             pool.queued[0], pool.queued[1], pool.queued[2], pool.peakQueued, coalesced);
+    NVGcolor poolColor = poolQueued > static_cast<size_t>(pool.workers) * 4 ? nvgRGB(255, 128, 0) : nvgRGB(180, 180, 180);
+    nvgFillColor(vg, poolColor);
+    nvgText(vg, textX, textY, buf, nullptr);
+    textY += lineH;
+
     // Section breakdown
     for (int i = 0; i < m_sectionCount; i++) {
         snprintf(buf, sizeof(buf), "  %s: %.1fms", m_sections[i].name, m_sections[i].lastMs);
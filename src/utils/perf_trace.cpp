@@ -0,0 +1,174 @@
+/**
+ * VitaSuwayomi - Perf Trace implementation
+ */
+
+#include "utils/perf_trace.hpp"
+#include "platform/platform.hpp"
+
+#include <borealis.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+namespace vitasuwayomi {
+
+thread_local PerfTrace::ThreadHandle PerfTrace::s_thread;
+static thread_local const char* t_threadName = nullptr;
+static thread_local bool t_untraced = false;  // Arrived while MAX_THREADS were live
+
+PerfTrace& PerfTrace::getInstance() {
+    static PerfTrace instance;
+    return instance;
+}
+
+uint64_t PerfTrace::nowUs() {
+    static const auto epoch = std::chrono::steady_clock::now();
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - epoch).count());
+}
+
+void PerfTrace::start() {
+    // Buffers reset themselves on their next record() once they see the
+    // new generation; only the owning thread ever writes its buffer
+    m_generation.fetch_add(1, std::memory_order_acq_rel);
+    m_recording.store(true, std::memory_order_release);
+    brls::Logger::info("PerfTrace: Recording started");
+}
+
+void PerfTrace::stop() {
+    m_recording.store(false, std::memory_order_release);
+    brls::Logger::info("PerfTrace: Recording stopped");
+}
+
+void PerfTrace::setThreadName(const char* name) {
+    t_threadName = name;
+    if (s_thread.buffer) s_thread.buffer->name.store(name, std::memory_order_relaxed);
+}
+
+PerfTrace::ThreadBuffer* PerfTrace::bufferForThisThread() {
+    if (s_thread.buffer || t_untraced) return s_thread.buffer;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    ThreadBuffer* buffer = nullptr;
+    for (const auto& candidate : m_buffers) {
+        if (!candidate->inUse.load(std::memory_order_acquire)) {
+            // The exited owner's spans go with it; export holds m_mutex too
+            buffer = candidate.get();
+            buffer->inUse.store(true, std::memory_order_relaxed);
+            buffer->head.store(0, std::memory_order_relaxed);
+            break;
+        }
+    }
+    if (!buffer) {
+        if (m_buffers.size() >= MAX_THREADS) {
+            t_untraced = true;
+            return nullptr;
+        }
+        m_buffers.emplace_back(new ThreadBuffer());
+        buffer = m_buffers.back().get();
+        buffer->events.reset(new Event[EVENTS_PER_THREAD]);
+    }
+
+    buffer->tid = m_nextTid++;
+    buffer->name.store(t_threadName, std::memory_order_relaxed);
+    buffer->generation.store(m_generation.load(std::memory_order_acquire), std::memory_order_relaxed);
+    s_thread.buffer = buffer;
+    return buffer;
+}
+
+void PerfTrace::record(const char* name, uint64_t startUs, uint64_t endUs) {
+    ThreadBuffer* buffer = bufferForThisThread();
+    if (!buffer) return;
+
+    uint64_t generation = m_generation.load(std::memory_order_acquire);
+    if (buffer->generation.load(std::memory_order_relaxed) != generation) {
+        buffer->head.store(0, std::memory_order_relaxed);
+        buffer->generation.store(generation, std::memory_order_release);
+    }
+
+    uint64_t head = buffer->head.load(std::memory_order_relaxed);
+    Event& event = buffer->events[head % EVENTS_PER_THREAD];
+    uint64_t durUs = endUs > startUs ? endUs - startUs : 0;
+    event.name.store(name, std::memory_order_relaxed);
+    event.startUs.store(startUs, std::memory_order_relaxed);
+    event.durUs.store(durUs > UINT32_MAX ? UINT32_MAX : static_cast<uint32_t>(durUs), std::memory_order_relaxed);
+    buffer->head.store(head + 1, std::memory_order_release);
+}
+
+bool PerfTrace::exportJson(const std::string& path) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    uint64_t generation = m_generation.load(std::memory_order_acquire);
+    size_t exported = 0;
+
+    bool ok = platform::writeFileStreamed(path, [&](platform::WriteCallback write) {
+        char line[256];
+        bool first = true;
+        auto emit = [&](int len) {
+            if (len <= 0) return true;
+            size_t size = std::min(static_cast<size_t>(len), sizeof(line) - 1);
+            bool sep = !first;
+            first = false;
+            return (!sep || write(",\n", 2)) && write(line, size);
+        };
+
+        static const char HEADER[] = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+        if (!write(HEADER, strlen(HEADER))) return false;
+
+        struct Span {
+            uint64_t index;
+            const char* name;
+            uint64_t startUs;
+            uint32_t durUs;
+        };
+        std::vector<Span> spans;
+        for (const auto& buffer : m_buffers) {
+            if (buffer->generation.load(std::memory_order_acquire) != generation) continue;
+
+            const char* threadName = buffer->name.load(std::memory_order_relaxed);
+            if (!emit(snprintf(line, sizeof(line),
+                               "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"%s\"}}",
+                               buffer->tid, threadName ? threadName : "thread"))) {
+                return false;
+            }
+
+            // Copy out first; anything the thread overwrote meanwhile is dropped
+            uint64_t headBefore = buffer->head.load(std::memory_order_acquire);
+            uint64_t begin = headBefore > EVENTS_PER_THREAD ? headBefore - EVENTS_PER_THREAD : 0;
+            spans.clear();
+            for (uint64_t i = begin; i < headBefore; i++) {
+                const Event& src = buffer->events[i % EVENTS_PER_THREAD];
+                spans.push_back({i, src.name.load(std::memory_order_relaxed),
+                                 src.startUs.load(std::memory_order_relaxed),
+                                 src.durUs.load(std::memory_order_relaxed)});
+            }
+            // Orders the event reads above before this load, so a slot the
+            // thread rewrote while it was copied shows up as overwritten
+            std::atomic_thread_fence(std::memory_order_acquire);
+            uint64_t headAfter = buffer->head.load(std::memory_order_acquire);
+            uint64_t firstIntact = headAfter >= EVENTS_PER_THREAD ? headAfter - EVENTS_PER_THREAD + 1 : 0;
+
+            for (const Span& span : spans) {
+                if (span.index < firstIntact || !span.name) continue;
+                if (!emit(snprintf(line, sizeof(line),
+                                   "{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%llu,\"dur\":%u}",
+                                   span.name, buffer->tid, static_cast<unsigned long long>(span.startUs),
+                                   span.durUs))) {
+                    return false;
+                }
+                exported++;
+            }
+        }
+
+        return write("\n]}\n", 4);
+    });
+
+    if (ok) {
+        brls::Logger::info("PerfTrace: Exported {} events from {} threads to {}", exported, m_buffers.size(), path);
+    } else {
+        brls::Logger::error("PerfTrace: Failed to write {}", path);
+    }
+    return ok;
+}
+
+} // namespace vitasuwayomi
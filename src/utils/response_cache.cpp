@@ -0,0 +1,214 @@
+/**
+ * VitaSuwayomi - Response Cache implementation
+ */
+
+#include "utils/response_cache.hpp"
+#include <borealis.hpp>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <vector>
+
+#include "platform/platform.hpp"
+
+namespace vitasuwayomi {
+
+static const char RESPONSE_MAGIC[4] = {'R', 'S', 'C', '1'};
+
+// In-memory budget across all operations; least recently used goes first
+static constexpr size_t MAX_MEMORY_BYTES = 2 * 1024 * 1024;
+
+// Disk copies older than this are ignored rather than shown as stale
+static constexpr int64_t MAX_DISK_AGE_SECONDS = 7 * 24 * 3600;
+
+static const ResponseCache::Policy POLICIES[] = {
+    {"categories", 60, true},
+    {"sources", 600, true},
+    {"mangafull", 120, false},
+    {"trackers", 300, true},
+    {"filters", 1800, true},
+};
+static_assert(sizeof(POLICIES) / sizeof(POLICIES[0]) == static_cast<size_t>(CachedOp::COUNT),
+              "one policy per CachedOp");
+
+const ResponseCache::Policy& ResponseCache::policy(CachedOp op) {
+    return POLICIES[static_cast<int>(op)];
+}
+
+uint64_t ResponseCache::makeKey(CachedOp op, const std::string& scope, const std::string& variables) {
+    // FNV-1a 64 over op, scope and variables with separators between them
+    uint64_t hash = 14695981039346656037ull;
+    auto mix = [&hash](const char* data, size_t size) {
+        for (size_t i = 0; i < size; i++) {
+            hash ^= static_cast<unsigned char>(data[i]);
+            hash *= 1099511628211ull;
+        }
+    };
+    char opByte = static_cast<char>(op);
+    mix(&opByte, 1);
+    mix(scope.data(), scope.size());
+    mix("\n", 1);
+    mix(variables.data(), variables.size());
+    return hash;
+}
+
+std::string ResponseCache::getCacheDir() {
+    return platform::path("cache") + "/responses";
+}
+
+std::string ResponseCache::getFilePath(CachedOp op, uint64_t key) {
+    char name[40];
+    snprintf(name, sizeof(name), "_%016" PRIx64 ".bin", key);
+    return getCacheDir() + "/" + policy(op).name + name;
+}
+
+bool ResponseCache::loadFromDisk(CachedOp op, uint64_t key, Entry& entry) {
+    std::vector<uint8_t> data = platform::readFile(getFilePath(op, key));
+    if (data.size() < 12 || std::memcmp(data.data(), RESPONSE_MAGIC, 4) != 0) return false;
+
+    int64_t storedAt = 0;
+    std::memcpy(&storedAt, data.data() + 4, sizeof(storedAt));
+    if (static_cast<int64_t>(std::time(nullptr)) - storedAt > MAX_DISK_AGE_SECONDS) return false;
+
+    entry.op = op;
+    entry.storedAt = storedAt;
+    entry.body.assign(reinterpret_cast<const char*>(data.data() + 12), data.size() - 12);
+    return true;
+}
+
+ResponseCache::Freshness ResponseCache::lookup(CachedOp op, const std::string& scope,
+                                               const std::string& variables, std::string& body) {
+    uint64_t key = makeKey(op, scope, variables);
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    auto it = m_entries.find(key);
+    if (it == m_entries.end()) {
+        if (!policy(op).persist) return Freshness::MISS;
+
+        // Read the file unlocked; an invalidate meanwhile makes it unusable
+        uint64_t generation = m_generations[static_cast<int>(op)];
+        lock.unlock();
+        Entry entry;
+        bool loaded = loadFromDisk(op, key, entry);
+        lock.lock();
+        if (!loaded || m_generations[static_cast<int>(op)] != generation) return Freshness::MISS;
+
+        it = m_entries.find(key);
+        if (it == m_entries.end()) {
+            entry.lastUsed = ++m_useCounter;
+            m_bytes += entry.body.size();
+            m_entries.emplace(key, std::move(entry));
+            evictIfNeeded();
+            it = m_entries.find(key);
+            if (it == m_entries.end()) return Freshness::MISS;
+        }
+    }
+
+    Entry& entry = it->second;
+    entry.lastUsed = ++m_useCounter;
+    body = entry.body;
+
+    int64_t age = static_cast<int64_t>(std::time(nullptr)) - entry.storedAt;
+    return (age >= 0 && age < policy(op).ttlSeconds) ? Freshness::FRESH : Freshness::STALE;
+}
+
+uint64_t ResponseCache::generation(CachedOp op) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_generations[static_cast<int>(op)];
+}
+
+void ResponseCache::store(CachedOp op, const std::string& scope, const std::string& variables,
+                          const std::string& body, uint64_t generation) {
+    if (body.empty()) return;
+    uint64_t key = makeKey(op, scope, variables);
+    int64_t now = static_cast<int64_t>(std::time(nullptr));
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_generations[static_cast<int>(op)] != generation) return;
+        Entry& entry = m_entries[key];
+        m_bytes -= entry.body.size();
+        entry.op = op;
+        entry.body = body;
+        entry.storedAt = now;
+        entry.lastUsed = ++m_useCounter;
+        m_bytes += body.size();
+        evictIfNeeded();
+    }
+
+    if (!policy(op).persist) return;
+
+    std::string out;
+    out.reserve(body.size() + 12);
+    out.append(RESPONSE_MAGIC, 4);
+    out.append(reinterpret_cast<const char*>(&now), sizeof(now));
+    out += body;
+
+    // An invalidate that bumps the generation after this check waits on
+    // m_diskMutex before unlinking, so it still removes this file
+    std::lock_guard<std::mutex> diskLock(m_diskMutex);
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_generations[static_cast<int>(op)] != generation) return;
+    }
+    if (!m_dirReady) {
+        platform::createDirRecursive(getCacheDir());
+        m_dirReady = true;
+    }
+    platform::writeFile(getFilePath(op, key), out);
+}
+
+void ResponseCache::evictIfNeeded() {
+    while (m_bytes > MAX_MEMORY_BYTES && m_entries.size() > 1) {
+        auto oldest = m_entries.begin();
+        for (auto it = m_entries.begin(); it != m_entries.end(); ++it) {
+            if (it->second.lastUsed < oldest->second.lastUsed) oldest = it;
+        }
+        m_bytes -= oldest->second.body.size();
+        m_entries.erase(oldest);
+    }
+}
+
+void ResponseCache::invalidate(CachedOp op) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_generations[static_cast<int>(op)]++;
+        for (auto it = m_entries.begin(); it != m_entries.end();) {
+            if (it->second.op == op) {
+                m_bytes -= it->second.body.size();
+                it = m_entries.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    if (!policy(op).persist) return;
+    std::lock_guard<std::mutex> diskLock(m_diskMutex);
+    std::string dir = getCacheDir();
+    std::string prefix = std::string(policy(op).name) + "_";
+    for (const auto& name : platform::listDir(dir)) {
+        if (name.compare(0, prefix.size(), prefix) == 0) {
+            platform::deleteFile(dir + "/" + name);
+        }
+    }
+}
+
+void ResponseCache::clear() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (uint64_t& generation : m_generations) generation++;
+        m_entries.clear();
+        m_bytes = 0;
+    }
+
+    std::lock_guard<std::mutex> diskLock(m_diskMutex);
+    std::string dir = getCacheDir();
+    for (const auto& name : platform::listDir(dir)) {
+        if (name.empty() || name[0] == '.') continue;
+        platform::deleteFile(dir + "/" + name);
+    }
+}
+
+} // namespace vitasuwayomi
@@ -0,0 +1,441 @@
+/**
+ * VitaSuwayomi - Settings Store implementation
+ */
+
+#include "utils/settings_store.hpp"
+#include <borealis.hpp>
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+
+#include "platform/platform.hpp"
+
+namespace vitasuwayomi {
+
+static const char STORE_MAGIC[4] = {'S', 'E', 'T', '1'};
+
+template<typename T>
+static void appendRaw(std::string& out, T value) {
+    out.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template<typename T>
+static bool readRaw(const std::vector<uint8_t>& data, size_t& offset, T& value) {
+    if (offset + sizeof(T) > data.size()) return false;
+    std::memcpy(&value, data.data() + offset, sizeof(T));
+    offset += sizeof(T);
+    return true;
+}
+
+static void appendString(std::string& out, const std::string& s) {
+    appendRaw<uint32_t>(out, static_cast<uint32_t>(s.size()));
+    out.append(s);
+}
+
+static bool readString(const std::vector<uint8_t>& data, size_t& offset, std::string& s) {
+    uint32_t len = 0;
+    if (!readRaw(data, offset, len) || len > data.size() - offset) return false;
+    s.assign(reinterpret_cast<const char*>(data.data() + offset), len);
+    offset += len;
+    return true;
+}
+
+// FNV-1a over the record body, so a torn write is rejected instead of
+// half-loaded
+static uint32_t checksum(const uint8_t* data, size_t size) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= data[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+// ---------------------------------------------------------------------------
+// Typed access
+// ---------------------------------------------------------------------------
+
+bool SettingsStore::getBool(const std::string& key, bool defaultVal) const {
+    auto it = m_values.find(key);
+    if (it == m_values.end()) return defaultVal;
+    const Value& v = it->second;
+    if (v.type != Type::BOOL && v.type != Type::INT) return defaultVal;
+    return v.i != 0;
+}
+
+int64_t SettingsStore::getInt(const std::string& key, int64_t defaultVal) const {
+    auto it = m_values.find(key);
+    if (it == m_values.end()) return defaultVal;
+    const Value& v = it->second;
+    if (v.type != Type::BOOL && v.type != Type::INT) return defaultVal;
+    return v.i;
+}
+
+std::string SettingsStore::getString(const std::string& key, const std::string& defaultVal) const {
+    auto it = m_values.find(key);
+    if (it == m_values.end() || it->second.type != Type::STRING) return defaultVal;
+    return it->second.s;
+}
+
+std::vector<std::string> SettingsStore::getList(const std::string& key) const {
+    auto it = m_values.find(key);
+    if (it == m_values.end() || it->second.type != Type::LIST) return {};
+    return it->second.list;
+}
+
+SettingsStore::Value& SettingsStore::slot(const std::string& key, Type type, bool& isNew) {
+    auto it = m_values.find(key);
+    isNew = false;
+    if (it == m_values.end()) {
+        it = m_values.emplace(key, Value()).first;
+        it->second.type = type;
+        isNew = true;
+    } else if (it->second.type != type) {
+        it->second = Value();
+        it->second.type = type;
+        isNew = true;
+    }
+    it->second.generation = m_generation;
+    if (isNew) m_dirty = true;
+    return it->second;
+}
+
+void SettingsStore::setBool(const std::string& key, bool value) {
+    bool isNew = false;
+    Value& v = slot(key, Type::BOOL, isNew);
+    int64_t i = value ? 1 : 0;
+    if (isNew || v.i != i) {
+        v.i = i;
+        m_dirty = true;
+    }
+}
+
+void SettingsStore::setInt(const std::string& key, int64_t value) {
+    bool isNew = false;
+    Value& v = slot(key, Type::INT, isNew);
+    if (isNew || v.i != value) {
+        v.i = value;
+        m_dirty = true;
+    }
+}
+
+void SettingsStore::setString(const std::string& key, const std::string& value) {
+    bool isNew = false;
+    Value& v = slot(key, Type::STRING, isNew);
+    if (isNew || v.s != value) {
+        v.s = value;
+        m_dirty = true;
+    }
+}
+
+void SettingsStore::setList(const std::string& key, const std::vector<std::string>& value) {
+    bool isNew = false;
+    Value& v = slot(key, Type::LIST, isNew);
+    if (isNew || v.list != value) {
+        v.list = value;
+        m_dirty = true;
+    }
+}
+
+std::vector<std::string> SettingsStore::children(const std::string& section) const {
+    std::vector<std::string> result;
+    std::string prefix = section + ".";
+    for (auto it = m_values.lower_bound(prefix); it != m_values.end(); ++it) {
+        const std::string& key = it->first;
+        if (key.compare(0, prefix.size(), prefix) != 0) break;
+        size_t end = key.find('.', prefix.size());
+        std::string child = key.substr(prefix.size(), end == std::string::npos ? std::string::npos
+                                                                                 : end - prefix.size());
+        // Keys of one child are contiguous in sorted order
+        if (result.empty() || result.back() != child) result.push_back(child);
+    }
+    return result;
+}
+
+void SettingsStore::beginSnapshot() {
+    m_generation++;
+    m_inSnapshot = true;
+}
+
+void SettingsStore::endSnapshot() {
+    if (!m_inSnapshot) return;
+    m_inSnapshot = false;
+    for (auto it = m_values.begin(); it != m_values.end();) {
+        if (it->second.generation != m_generation) {
+            it = m_values.erase(it);
+            m_dirty = true;
+        } else {
+            ++it;
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Binary persistence
+// ---------------------------------------------------------------------------
+
+bool SettingsStore::save(const std::string& path) {
+    std::string body;
+    body.reserve(m_values.size() * 32);
+    appendRaw<uint32_t>(body, static_cast<uint32_t>(m_values.size()));
+    for (const auto& [key, v] : m_values) {
+        appendString(body, key);
+        appendRaw<uint8_t>(body, static_cast<uint8_t>(v.type));
+        switch (v.type) {
+            case Type::BOOL:
+            case Type::INT:
+                appendRaw<int64_t>(body, v.i);
+                break;
+            case Type::STRING:
+                appendString(body, v.s);
+                break;
+            case Type::LIST:
+                appendRaw<uint32_t>(body, static_cast<uint32_t>(v.list.size()));
+                for (const auto& item : v.list) appendString(body, item);
+                break;
+        }
+    }
+
+    std::string out;
+    out.reserve(body.size() + 8);
+    out.append(STORE_MAGIC, 4);
+    out += body;
+    appendRaw<uint32_t>(out, checksum(reinterpret_cast<const uint8_t*>(body.data()), body.size()));
+
+    std::string tmpPath = path + ".tmp";
+    if (!platform::writeFile(tmpPath, out) || !platform::renameFile(tmpPath, path)) {
+        brls::Logger::error("SettingsStore: failed to write {}", path);
+        return false;
+    }
+    m_dirty = false;
+    return true;
+}
+
+bool SettingsStore::parseBinary(const std::vector<uint8_t>& data) {
+    if (data.size() < 12 || std::memcmp(data.data(), STORE_MAGIC, 4) != 0) return false;
+
+    size_t bodyEnd = data.size() - 4;
+    uint32_t stored = 0;
+    std::memcpy(&stored, data.data() + bodyEnd, 4);
+    if (checksum(data.data() + 4, bodyEnd - 4) != stored) return false;
+
+    std::vector<uint8_t> body(data.begin() + 4, data.begin() + bodyEnd);
+    size_t offset = 0;
+    uint32_t count = 0;
+    if (!readRaw(body, offset, count)) return false;
+
+    std::map<std::string, Value> values;
+    for (uint32_t n = 0; n < count; n++) {
+        std::string key;
+        uint8_t type = 0;
+        if (!readString(body, offset, key) || !readRaw(body, offset, type)) return false;
+
+        Value v;
+        v.type = static_cast<Type>(type);
+        switch (v.type) {
+            case Type::BOOL:
+            case Type::INT:
+                if (!readRaw(body, offset, v.i)) return false;
+                break;
+            case Type::STRING:
+                if (!readString(body, offset, v.s)) return false;
+                break;
+            case Type::LIST: {
+                uint32_t items = 0;
+                if (!readRaw(body, offset, items)) return false;
+                for (uint32_t k = 0; k < items; k++) {
+                    std::string item;
+                    if (!readString(body, offset, item)) return false;
+                    v.list.push_back(std::move(item));
+                }
+                break;
+            }
+            default:
+                return false;
+        }
+        values.emplace(std::move(key), std::move(v));
+    }
+
+    m_values = std::move(values);
+    m_dirty = false;
+    return true;
+}
+
+bool SettingsStore::load(const std::string& path) {
+    if (parseBinary(platform::readFile(path))) return true;
+
+    // Where the rename cannot overwrite, the old file is removed first; a crash
+    // in between leaves only the temp copy
+    std::string tmpPath = path + ".tmp";
+    if (parseBinary(platform::readFile(tmpPath))) {
+        brls::Logger::warning("SettingsStore: recovered {} from temp file", path);
+        m_dirty = true;
+        return true;
+    }
+    return false;
+}
+
+// ---------------------------------------------------------------------------
+// Legacy JSON import
+// ---------------------------------------------------------------------------
+
+namespace {
+
+class JsonImporter {
+public:
+    JsonImporter(const std::string& text, SettingsStore& store) : m_text(text), m_store(store) {}
+
+    bool run() {
+        skipSpace();
+        return parseObject("", 0);
+    }
+
+private:
+    static constexpr int MAX_DEPTH = 8;
+
+    void skipSpace() {
+        while (m_pos < m_text.size() && std::isspace(static_cast<unsigned char>(m_text[m_pos]))) m_pos++;
+    }
+
+    bool consume(char c) {
+        skipSpace();
+        if (m_pos >= m_text.size() || m_text[m_pos] != c) return false;
+        m_pos++;
+        return true;
+    }
+
+    static void appendUtf8(std::string& out, unsigned cp) {
+        if (cp < 0x80) {
+            out += static_cast<char>(cp);
+        } else if (cp < 0x800) {
+            out += static_cast<char>(0xC0 | (cp >> 6));
+            out += static_cast<char>(0x80 | (cp & 0x3F));
+        } else {
+            out += static_cast<char>(0xE0 | (cp >> 12));
+            out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (cp & 0x3F));
+        }
+    }
+
+    bool parseString(std::string& out) {
+        if (!consume('"')) return false;
+        out.clear();
+        while (m_pos < m_text.size()) {
+            char c = m_text[m_pos++];
+            if (c == '"') return true;
+            if (c != '\\') {
+                out += c;
+                continue;
+            }
+            if (m_pos >= m_text.size()) return false;
+            char e = m_text[m_pos++];
+            switch (e) {
+                case 'n': out += '\n'; break;
+                case 't': out += '\t'; break;
+                case 'r': out += '\r'; break;
+                case 'b': out += '\b'; break;
+                case 'f': out += '\f'; break;
+                case 'u':
+                    if (m_pos + 4 > m_text.size()) return false;
+                    appendUtf8(out, static_cast<unsigned>(std::strtoul(m_text.substr(m_pos, 4).c_str(), nullptr, 16)));
+                    m_pos += 4;
+                    break;
+                default: out += e; break;  // \" \\ \/
+            }
+        }
+        return false;
+    }
+
+    // Bare token: number, true, false or null
+    std::string parseLiteral() {
+        skipSpace();
+        size_t start = m_pos;
+        while (m_pos < m_text.size() && m_text[m_pos] != ',' && m_text[m_pos] != '}' &&
+               m_text[m_pos] != ']' && !std::isspace(static_cast<unsigned char>(m_text[m_pos]))) {
+            m_pos++;
+        }
+        return m_text.substr(start, m_pos - start);
+    }
+
+    bool parseArray(const std::string& key, int depth) {
+        if (!consume('[')) return false;
+        std::vector<std::string> items;
+        if (consume(']')) {
+            m_store.setList(key, items);
+            return true;
+        }
+        do {
+            skipSpace();
+            if (m_pos >= m_text.size()) return false;
+            std::string item;
+            if (m_text[m_pos] == '"') {
+                if (!parseString(item)) return false;
+            } else if (m_text[m_pos] == '{' || m_text[m_pos] == '[') {
+                // No nested containers in settings arrays; keep going past it
+                if (depth >= MAX_DEPTH) return false;
+                if (m_text[m_pos] == '{' ? !parseObject(key + ".", depth + 1)
+                                         : !parseArray(key + ".", depth + 1)) {
+                    return false;
+                }
+                continue;
+            } else {
+                item = parseLiteral();
+            }
+            items.push_back(std::move(item));
+        } while (consume(','));
+        if (!consume(']')) return false;
+        m_store.setList(key, items);
+        return true;
+    }
+
+    bool parseValue(const std::string& key, int depth) {
+        skipSpace();
+        if (m_pos >= m_text.size()) return false;
+        char c = m_text[m_pos];
+        if (c == '{') {
+            if (depth >= MAX_DEPTH) return false;
+            return parseObject(key + ".", depth + 1);
+        }
+        if (c == '[') return parseArray(key, depth);
+        if (c == '"') {
+            std::string value;
+            if (!parseString(value)) return false;
+            m_store.setString(key, value);
+            return true;
+        }
+
+        std::string literal = parseLiteral();
+        if (literal == "true" || literal == "false") {
+            m_store.setBool(key, literal == "true");
+        } else if (literal != "null") {
+            if (literal.empty()) return false;
+            m_store.setInt(key, std::strtoll(literal.c_str(), nullptr, 10));
+        }
+        return true;
+    }
+
+    bool parseObject(const std::string& prefix, int depth) {
+        if (!consume('{')) return false;
+        if (consume('}')) return true;
+        do {
+            std::string name;
+            if (!parseString(name) || !consume(':')) return false;
+            if (!parseValue(prefix + name, depth)) return false;
+        } while (consume(','));
+        return consume('}');
+    }
+
+    const std::string& m_text;
+    SettingsStore& m_store;
+    size_t m_pos = 0;
+};
+
+} // namespace
+
+bool SettingsStore::importJson(const std::string& content) {
+    JsonImporter importer(content, *this);
+    return importer.run();
+}
+
+} // namespace vitasuwayomi
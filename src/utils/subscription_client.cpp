@@ -0,0 +1,681 @@
+/**
+ * VitaSuwayomi - GraphQL Subscription Client implementation
+ *
+ * Speaks RFC 6455 framing over the raw socket that libcurl hands back with
+ * CURLOPT_CONNECT_ONLY, so TLS, proxies and DNS behave exactly like the
+ * regular HttpClient requests.
+ */
+
+#include "utils/subscription_client.hpp"
+#include "utils/async.hpp"
+#include "app/suwayomi_client.hpp"
+#include "platform/platform.hpp"
+
+#include <borealis.hpp>
+#include <curl/curl.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+
+#ifdef _WIN32
+#include <winsock2.h>
+#else
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+namespace vitasuwayomi {
+
+static const char* WS_PROTOCOL = "graphql-transport-ws";
+static const int CONNECT_TIMEOUT_SECONDS = 10;
+static const int ACK_TIMEOUT_MS = 10000;
+static const int RETRY_SLICE_MS = 200;       // Reconnect backoff is waited out in slices
+static const int KEEPALIVE_INTERVAL_MS = 20000;  // Ping after this long without traffic
+static const int KEEPALIVE_TIMEOUT_MS = 10000;   // Drop the connection if the ping gets no reply
+// Upper bound on a socket wait when the wake socket could not be created,
+// so subscribe/unsubscribe still go out reasonably soon
+static const int WAKE_FALLBACK_MS = 250;
+static const int RECONNECT_MIN_MS = 1000;
+static const int RECONNECT_MAX_MS = 30000;
+static const size_t MAX_MESSAGE_BYTES = 4 * 1024 * 1024;
+
+enum WsOpcode {
+    WS_CONTINUATION = 0x0,
+    WS_TEXT = 0x1,
+    WS_BINARY = 0x2,
+    WS_CLOSE = 0x8,
+    WS_PING = 0x9,
+    WS_PONG = 0xA
+};
+
+static std::mt19937& wsRandom() {
+    static std::mt19937 rng(std::random_device{}());
+    return rng;
+}
+
+// Loopback UDP socket that subscribe/unsubscribe write a byte to, so the
+// worker's select() returns without polling. Created once and kept.
+static curl_socket_t s_wakeSocket = CURL_SOCKET_BAD;
+static sockaddr_in s_wakeAddr;
+
+static void createWakeSocket() {
+    if (s_wakeSocket != CURL_SOCKET_BAD) return;
+    curl_socket_t sock = socket(AF_INET, SOCK_DGRAM, 0);
+    if (sock == CURL_SOCKET_BAD) return;
+
+    sockaddr_in addr;
+    std::memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = 0;
+    socklen_t len = sizeof(addr);
+    if (bind(sock, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 ||
+        getsockname(sock, reinterpret_cast<sockaddr*>(&addr), &len) != 0) {
+        brls::Logger::debug("SubscriptionClient: No wake socket, waits are capped at {}ms", WAKE_FALLBACK_MS);
+#ifdef _WIN32
+        closesocket(sock);
+#else
+        close(sock);
+#endif
+        return;
+    }
+    s_wakeAddr = addr;
+    s_wakeSocket = sock;
+}
+
+static std::string base64Encode(const unsigned char* data, size_t len) {
+    static const char* table = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    std::string out;
+    for (size_t i = 0; i < len; i += 3) {
+        uint32_t n = static_cast<uint32_t>(data[i]) << 16;
+        if (i + 1 < len) n |= static_cast<uint32_t>(data[i + 1]) << 8;
+        if (i + 2 < len) n |= data[i + 2];
+        out += table[(n >> 18) & 63];
+        out += table[(n >> 12) & 63];
+        out += (i + 1 < len) ? table[(n >> 6) & 63] : '=';
+        out += (i + 2 < len) ? table[n & 63] : '=';
+    }
+    return out;
+}
+
+static std::string jsonEscape(const std::string& str) {
+    std::string out;
+    out.reserve(str.size() + 16);
+    for (char c : str) {
+        switch (c) {
+            case '"': out += "\\\""; break;
+            case '\\': out += "\\\\"; break;
+            case '\n': out += "\\n"; break;
+            case '\r': out += "\\r"; break;
+            case '\t': out += "\\t"; break;
+            default: out += c; break;
+        }
+    }
+    return out;
+}
+
+// Reads the JSON string starting at the quote at pos; pos ends past the
+// closing quote. Escapes are only stepped over: id and type never use them.
+static bool readJsonString(const std::string& json, size_t& pos, std::string& out) {
+    out.clear();
+    for (size_t i = pos + 1; i < json.size(); i++) {
+        if (json[i] == '\\') {
+            if (++i >= json.size()) return false;
+        } else if (json[i] == '"') {
+            pos = i + 1;
+            return true;
+        }
+        out += json[i];
+    }
+    return false;
+}
+
+// String value of a top-level field of a protocol message. Walks the object
+// rather than searching for the key, so "id" or "type" fields inside the
+// payload never match whatever order the server writes the fields in.
+static std::string findStringField(const std::string& json, const char* key) {
+    int depth = 0;
+    char last = 0;  // Previous structural character, '"' after a string
+    size_t pos = 0;
+    std::string token;
+    while (pos < json.size()) {
+        char c = json[pos];
+        if (c == '"') {
+            bool isKey = depth == 1 && (last == '{' || last == ',');
+            if (!readJsonString(json, pos, token)) return "";
+            last = '"';
+            if (!isKey || token != key) continue;
+
+            while (pos < json.size() && (json[pos] == ' ' || json[pos] == '\t' ||
+                                         json[pos] == '\n' || json[pos] == '\r' || json[pos] == ':')) {
+                pos++;
+            }
+            if (pos >= json.size() || json[pos] != '"' || !readJsonString(json, pos, token)) return "";
+            return token;
+        }
+        if (c == '{' || c == '[') {
+            depth++;
+        } else if (c == '}' || c == ']') {
+            depth--;
+        }
+        if (c != ' ' && c != '\t' && c != '\n' && c != '\r') last = c;
+        pos++;
+    }
+    return "";
+}
+
+SubscriptionClient& SubscriptionClient::getInstance() {
+    static SubscriptionClient instance;
+    return instance;
+}
+
+void SubscriptionClient::setEndpoint(const std::string& serverUrl,
+                                     const std::map<std::string, std::string>& headers) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_endpointOverride = serverUrl;
+    m_headersOverride = headers;
+}
+
+int SubscriptionClient::subscribe(const std::string& query, MessageHandler onNext, StateHandler onState) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_endpointOverride.empty() && SuwayomiClient::getInstance().getServerUrl().empty()) {
+        return -1;
+    }
+
+    int id = m_nextId++;
+    Subscription sub;
+    sub.query = query;
+    sub.onNext = std::move(onNext);
+    sub.onState = std::move(onState);
+    m_subs[id] = std::move(sub);
+
+    if (!m_running) {
+        m_running = true;
+        asyncRunLargeStack([this]() { runLoop(); });
+    }
+    // A running worker sends the subscribe message on its next pass
+    wakeLocked();
+    return id;
+}
+
+void SubscriptionClient::unsubscribe(int id) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_subs.find(id);
+    if (it == m_subs.end()) return;
+    if (it->second.started) {
+        m_outbox.push_back("{\"id\":\"" + std::to_string(id) + "\",\"type\":\"complete\"}");
+    }
+    m_subs.erase(it);
+    wakeLocked();
+}
+
+void SubscriptionClient::wakeLocked() {
+    if (!m_running || s_wakeSocket == CURL_SOCKET_BAD) return;
+    char byte = 0;
+    sendto(s_wakeSocket, &byte, 1, 0, reinterpret_cast<const sockaddr*>(&s_wakeAddr), sizeof(s_wakeAddr));
+}
+
+void SubscriptionClient::notifyState(bool live) {
+    std::vector<StateHandler> handlers;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto& kv : m_subs) {
+            if (!live) kv.second.started = false;
+            if (kv.second.onState) handlers.push_back(kv.second.onState);
+        }
+    }
+    for (auto& handler : handlers) handler(live);
+}
+
+void SubscriptionClient::runLoop() {
+    int backoffMs = RECONNECT_MIN_MS;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        createWakeSocket();
+    }
+
+    while (true) {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_subs.empty()) {
+                m_running = false;
+                return;
+            }
+        }
+
+        bool hadSession = false;
+        if (openConnection()) {
+            hadSession = runSession();
+            closeConnection();
+        }
+
+        m_live.store(false);
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_subs.empty()) {
+                m_running = false;
+                return;
+            }
+        }
+        notifyState(false);
+
+        // A session that got acked resets the backoff; repeated failures
+        // (server without subscriptions, auth errors) back off to RECONNECT_MAX_MS
+        backoffMs = hadSession ? RECONNECT_MIN_MS : std::min(backoffMs * 2, RECONNECT_MAX_MS);
+        brls::Logger::debug("SubscriptionClient: Reconnecting in {}ms", backoffMs);
+
+        // Sliced so the last unsubscribe ends the wait early (platform waits
+        // are timeout-only; Switch polls)
+        auto retryAt = std::chrono::steady_clock::now() + std::chrono::milliseconds(backoffMs);
+        std::unique_lock<std::mutex> lock(m_mutex);
+        while (!m_subs.empty() && std::chrono::steady_clock::now() < retryAt) {
+            platform::condWaitFor(m_mutex, lock, RETRY_SLICE_MS, [this]() { return m_subs.empty(); });
+        }
+    }
+}
+
+bool SubscriptionClient::openConnection() {
+    std::string serverUrl;
+    std::map<std::string, std::string> headers;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        serverUrl = m_endpointOverride;
+        headers = m_headersOverride;
+    }
+    if (serverUrl.empty()) {
+        serverUrl = SuwayomiClient::getInstance().getServerUrl();
+        headers = SuwayomiClient::getInstance().createHttpClient().getDefaultHeaders();
+        headers.erase("Accept");
+    }
+    while (!serverUrl.empty() && serverUrl.back() == '/') serverUrl.pop_back();
+    if (serverUrl.empty()) return false;
+
+    // Split "scheme://host[:port][/prefix]" into the authority and request path
+    size_t schemeEnd = serverUrl.find("://");
+    size_t hostStart = (schemeEnd == std::string::npos) ? 0 : schemeEnd + 3;
+    size_t pathStart = serverUrl.find('/', hostStart);
+    std::string hostPort = serverUrl.substr(hostStart, pathStart == std::string::npos ? std::string::npos : pathStart - hostStart);
+    std::string path = (pathStart == std::string::npos ? "" : serverUrl.substr(pathStart)) + "/api/graphql";
+
+    CURL* curl = curl_easy_init();
+    if (!curl) return false;
+    curl_easy_setopt(curl, CURLOPT_URL, serverUrl.c_str());
+    curl_easy_setopt(curl, CURLOPT_CONNECT_ONLY, 1L);
+    curl_easy_setopt(curl, CURLOPT_CONNECTTIMEOUT, static_cast<long>(CONNECT_TIMEOUT_SECONDS));
+    curl_easy_setopt(curl, CURLOPT_SSL_VERIFYPEER, 0L);
+    curl_easy_setopt(curl, CURLOPT_SSL_VERIFYHOST, 0L);
+    curl_easy_setopt(curl, CURLOPT_SSLVERSION, CURL_SSLVERSION_TLSv1_2);
+
+    CURLcode res = curl_easy_perform(curl);
+    if (res != CURLE_OK) {
+        brls::Logger::debug("SubscriptionClient: Connect failed: {}", curl_easy_strerror(res));
+        curl_easy_cleanup(curl);
+        return false;
+    }
+    m_curl = curl;
+    m_rx.clear();
+    m_fragment.clear();
+    m_closeReceived = false;
+
+    unsigned char keyBytes[16];
+    for (auto& b : keyBytes) b = static_cast<unsigned char>(wsRandom()() & 0xFF);
+
+    std::string request = "GET " + path + " HTTP/1.1\r\n"
+                          "Host: " + hostPort + "\r\n"
+                          "Upgrade: websocket\r\n"
+                          "Connection: Upgrade\r\n"
+                          "Sec-WebSocket-Key: " + base64Encode(keyBytes, sizeof(keyBytes)) + "\r\n"
+                          "Sec-WebSocket-Version: 13\r\n"
+                          "Sec-WebSocket-Protocol: " + WS_PROTOCOL + "\r\n"
+                          "User-Agent: VitaSuwayomi/" VITA_SUWAYOMI_VERSION "\r\n";
+    for (const auto& kv : headers) {
+        request += kv.first + ": " + kv.second + "\r\n";
+    }
+    request += "\r\n";
+
+    if (!sendRaw(request.data(), request.size())) {
+        closeConnection();
+        return false;
+    }
+
+    // Read the handshake response; bytes after the blank line are already frames
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(CONNECT_TIMEOUT_SECONDS);
+    size_t headerEnd = std::string::npos;
+    while ((headerEnd = m_rx.find("\r\n\r\n")) == std::string::npos) {
+        bool gotData = false;
+        auto now = std::chrono::steady_clock::now();
+        if (!pumpReceive(gotData) || now > deadline) {
+            brls::Logger::debug("SubscriptionClient: No handshake response");
+            closeConnection();
+            return false;
+        }
+        if (!gotData) {
+            waitForSocket(static_cast<int>(
+                std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now).count()) + 1);
+        }
+    }
+
+    std::string statusLine = m_rx.substr(0, m_rx.find("\r\n"));
+    if (statusLine.find(" 101") == std::string::npos) {
+        brls::Logger::info("SubscriptionClient: Server refused WebSocket upgrade ({})", statusLine);
+        closeConnection();
+        return false;
+    }
+    m_rx.erase(0, headerEnd + 4);
+    brls::Logger::info("SubscriptionClient: Connected to {}", hostPort);
+    return true;
+}
+
+void SubscriptionClient::closeConnection() {
+    if (!m_curl) return;
+    curl_easy_cleanup(static_cast<CURL*>(m_curl));
+    m_curl = nullptr;
+    m_rx.clear();
+    m_fragment.clear();
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_acked = false;
+        m_outbox.clear();
+    }
+}
+
+bool SubscriptionClient::runSession() {
+    if (!sendFrame(WS_TEXT, "{\"type\":\"connection_init\",\"payload\":{}}")) return false;
+
+    using Clock = std::chrono::steady_clock;
+    auto ackDeadline = Clock::now() + std::chrono::milliseconds(ACK_TIMEOUT_MS);
+    bool everAcked = false;
+    // Keepalive: ping after KEEPALIVE_INTERVAL_MS of silence, give up if the
+    // server stays silent for KEEPALIVE_TIMEOUT_MS more
+    auto lastActivity = Clock::now();
+    bool pingOutstanding = false;
+
+    while (true) {
+        // Flush queued completes, and start any subscription not yet running
+        std::vector<std::string> outgoing;
+        std::vector<StateHandler> started;
+        bool noSubs = false;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            outgoing.swap(m_outbox);
+            if (m_acked) {
+                for (auto& kv : m_subs) {
+                    if (kv.second.started) continue;
+                    kv.second.started = true;
+                    outgoing.push_back("{\"id\":\"" + std::to_string(kv.first) +
+                                       "\",\"type\":\"subscribe\",\"payload\":{\"query\":\"" +
+                                       jsonEscape(kv.second.query) + "\"}}");
+                    if (kv.second.onState) started.push_back(kv.second.onState);
+                }
+            }
+            noSubs = m_subs.empty();
+        }
+        for (const auto& msg : outgoing) {
+            if (!sendFrame(WS_TEXT, msg)) return everAcked;
+        }
+        for (auto& handler : started) handler(true);
+
+        if (noSubs) {
+            // Last subscriber left: close politely so the server drops its side too
+            sendFrame(WS_CLOSE, std::string("\x03\xe8", 2));
+            brls::Logger::debug("SubscriptionClient: No subscriptions left, disconnecting");
+            return true;
+        }
+
+        bool gotData = false;
+        if (!pumpReceive(gotData)) return everAcked;
+        if (gotData && !parseFrames()) return everAcked;
+        if (m_closeReceived) return everAcked;
+
+        auto now = Clock::now();
+        if (gotData) {
+            lastActivity = now;
+            pingOutstanding = false;
+        }
+
+        bool localWork = false;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_acked && !everAcked) {
+                everAcked = true;
+                m_live.store(true);
+            }
+            localWork = !m_outbox.empty() || m_subs.empty();
+            if (m_acked) {
+                for (const auto& kv : m_subs) {
+                    if (!kv.second.started) localWork = true;
+                }
+            }
+        }
+
+        Clock::time_point deadline;
+        if (!everAcked) {
+            if (now > ackDeadline) {
+                brls::Logger::info("SubscriptionClient: No connection_ack from server");
+                return false;
+            }
+            deadline = ackDeadline;
+        } else if (pingOutstanding) {
+            deadline = lastActivity + std::chrono::milliseconds(KEEPALIVE_INTERVAL_MS + KEEPALIVE_TIMEOUT_MS);
+            if (now > deadline) {
+                brls::Logger::info("SubscriptionClient: Keepalive timed out");
+                return everAcked;
+            }
+        } else {
+            deadline = lastActivity + std::chrono::milliseconds(KEEPALIVE_INTERVAL_MS);
+            if (now >= deadline) {
+                if (!sendFrame(WS_TEXT, "{\"type\":\"ping\"}")) return everAcked;
+                pingOutstanding = true;
+                continue;
+            }
+        }
+
+        // Anything queued after this check also writes to the wake socket
+        if (!gotData && !localWork) {
+            waitForSocket(static_cast<int>(
+                std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now).count()) + 1);
+        }
+    }
+}
+
+void SubscriptionClient::waitForSocket(int timeoutMs, bool forWrite) {
+    CURL* curl = static_cast<CURL*>(m_curl);
+    curl_socket_t sock = CURL_SOCKET_BAD;
+    if (!curl || curl_easy_getinfo(curl, CURLINFO_ACTIVESOCKET, &sock) != CURLE_OK || sock == CURL_SOCKET_BAD) {
+        return;
+    }
+    if (s_wakeSocket == CURL_SOCKET_BAD) timeoutMs = std::min(timeoutMs, WAKE_FALLBACK_MS);
+
+    fd_set readSet;
+    fd_set writeSet;
+    FD_ZERO(&readSet);
+    FD_ZERO(&writeSet);
+    FD_SET(sock, forWrite ? &writeSet : &readSet);
+    curl_socket_t maxSock = sock;
+    if (s_wakeSocket != CURL_SOCKET_BAD) {
+        FD_SET(s_wakeSocket, &readSet);
+        maxSock = std::max(maxSock, s_wakeSocket);
+    }
+
+    timeval tv;
+    tv.tv_sec = timeoutMs / 1000;
+    tv.tv_usec = (timeoutMs % 1000) * 1000;
+    int ready = select(static_cast<int>(maxSock + 1), &readSet, &writeSet, nullptr, &tv);
+    if (ready > 0 && s_wakeSocket != CURL_SOCKET_BAD && FD_ISSET(s_wakeSocket, &readSet)) {
+        char byte;
+        recv(s_wakeSocket, &byte, 1, 0);
+    }
+}
+
+bool SubscriptionClient::sendRaw(const char* data, size_t size) {
+    CURL* curl = static_cast<CURL*>(m_curl);
+    if (!curl) return false;
+    size_t offset = 0;
+    while (offset < size) {
+        size_t sent = 0;
+        CURLcode res = curl_easy_send(curl, data + offset, size - offset, &sent);
+        if (res == CURLE_AGAIN) {
+            waitForSocket(CONNECT_TIMEOUT_SECONDS * 1000, true);
+            continue;
+        }
+        if (res != CURLE_OK) {
+            brls::Logger::debug("SubscriptionClient: Send failed: {}", curl_easy_strerror(res));
+            return false;
+        }
+        offset += sent;
+    }
+    return true;
+}
+
+bool SubscriptionClient::sendFrame(int opcode, const std::string& payload) {
+    // Client frames are always masked (RFC 6455 5.3)
+    std::string frame;
+    frame.reserve(payload.size() + 14);
+    frame += static_cast<char>(0x80 | (opcode & 0x0F));
+
+    size_t len = payload.size();
+    if (len < 126) {
+        frame += static_cast<char>(0x80 | len);
+    } else if (len <= 0xFFFF) {
+        frame += static_cast<char>(0x80 | 126);
+        frame += static_cast<char>((len >> 8) & 0xFF);
+        frame += static_cast<char>(len & 0xFF);
+    } else {
+        frame += static_cast<char>(0x80 | 127);
+        for (int shift = 56; shift >= 0; shift -= 8) {
+            frame += static_cast<char>((static_cast<uint64_t>(len) >> shift) & 0xFF);
+        }
+    }
+
+    uint32_t maskWord = wsRandom()();
+    unsigned char mask[4];
+    std::memcpy(mask, &maskWord, 4);
+    frame.append(reinterpret_cast<const char*>(mask), 4);
+    for (size_t i = 0; i < len; i++) {
+        frame += static_cast<char>(payload[i] ^ mask[i & 3]);
+    }
+    return sendRaw(frame.data(), frame.size());
+}
+
+bool SubscriptionClient::pumpReceive(bool& gotData) {
+    CURL* curl = static_cast<CURL*>(m_curl);
+    if (!curl) return false;
+    gotData = false;
+    char buf[4096];
+    while (true) {
+        size_t received = 0;
+        CURLcode res = curl_easy_recv(curl, buf, sizeof(buf), &received);
+        if (res == CURLE_AGAIN) return true;
+        if (res != CURLE_OK) {
+            brls::Logger::debug("SubscriptionClient: Receive failed: {}", curl_easy_strerror(res));
+            return false;
+        }
+        if (received == 0) {
+            brls::Logger::debug("SubscriptionClient: Connection closed by server");
+            return false;
+        }
+        m_rx.append(buf, received);
+        gotData = true;
+        if (m_rx.size() > MAX_MESSAGE_BYTES) return true;  // Let parseFrames drain it
+    }
+}
+
+bool SubscriptionClient::parseFrames() {
+    while (m_rx.size() >= 2) {
+        const unsigned char* p = reinterpret_cast<const unsigned char*>(m_rx.data());
+        bool fin = (p[0] & 0x80) != 0;
+        int opcode = p[0] & 0x0F;
+        bool masked = (p[1] & 0x80) != 0;
+        uint64_t len = p[1] & 0x7F;
+        size_t headerSize = 2;
+
+        if (len == 126) {
+            if (m_rx.size() < 4) return true;
+            len = (static_cast<uint64_t>(p[2]) << 8) | p[3];
+            headerSize = 4;
+        } else if (len == 127) {
+            if (m_rx.size() < 10) return true;
+            len = 0;
+            for (int i = 0; i < 8; i++) len = (len << 8) | p[2 + i];
+            headerSize = 10;
+        }
+        if (len > MAX_MESSAGE_BYTES) {
+            brls::Logger::error("SubscriptionClient: Frame too large ({} bytes)", len);
+            return false;
+        }
+        size_t maskOffset = headerSize;
+        if (masked) headerSize += 4;
+        if (m_rx.size() < headerSize + len) return true;  // Wait for the rest
+
+        std::string payload = m_rx.substr(headerSize, static_cast<size_t>(len));
+        if (masked) {
+            for (size_t i = 0; i < payload.size(); i++) {
+                payload[i] = static_cast<char>(payload[i] ^ p[maskOffset + (i & 3)]);
+            }
+        }
+        m_rx.erase(0, headerSize + static_cast<size_t>(len));
+
+        switch (opcode) {
+            case WS_TEXT:
+            case WS_CONTINUATION:
+                m_fragment += payload;
+                if (m_fragment.size() > MAX_MESSAGE_BYTES) return false;
+                if (fin) {
+                    std::string message;
+                    message.swap(m_fragment);
+                    handleMessage(message);
+                }
+                break;
+            case WS_PING:
+                if (!sendFrame(WS_PONG, payload)) return false;
+                break;
+            case WS_CLOSE:
+                sendFrame(WS_CLOSE, payload.substr(0, 2));
+                m_closeReceived = true;
+                return true;
+            default:
+                break;  // Binary and pong frames are not used by the protocol
+        }
+    }
+    return true;
+}
+
+void SubscriptionClient::handleMessage(const std::string& message) {
+    std::string type = findStringField(message, "type");
+
+    if (type == "connection_ack") {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_acked = true;
+        brls::Logger::debug("SubscriptionClient: connection_ack");
+    } else if (type == "ping") {
+        sendFrame(WS_TEXT, "{\"type\":\"pong\"}");
+    } else if (type == "next") {
+        int id = std::atoi(findStringField(message, "id").c_str());
+        MessageHandler handler;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            auto it = m_subs.find(id);
+            if (it != m_subs.end()) handler = it->second.onNext;
+        }
+        if (handler) handler(message);
+    } else if (type == "error" || type == "complete") {
+        // Server ended this subscription; it will be restarted on reconnect
+        int id = std::atoi(findStringField(message, "id").c_str());
+        brls::Logger::info("SubscriptionClient: Subscription {} {}: {}", id, type,
+                           message.substr(0, 200));
+        StateHandler handler;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            auto it = m_subs.find(id);
+            if (it != m_subs.end()) handler = it->second.onState;
+        }
+        if (handler) handler(false);
+    }
+}
+
+} // namespace vitasuwayomi
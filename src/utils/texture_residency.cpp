@@ -0,0 +1,126 @@
+/**
+ * VitaSuwayomi - Texture Residency implementation
+ */
+
+#include "utils/texture_residency.hpp"
+
+#include <borealis.hpp>
+
+namespace vitasuwayomi {
+
+// Budgets leave room for borealis' own textures, fonts and framebuffers.
+// Vita: the webtoon prefetch window (3/4, 48MB) plus a screen of covers.
+#if defined(__vita__)
+static constexpr size_t VRAM_BUDGET = 64 * 1024 * 1024;
+#elif defined(__PS4__) || defined(__SWITCH__)
+static constexpr size_t VRAM_BUDGET = 256 * 1024 * 1024;
+#else
+static constexpr size_t VRAM_BUDGET = 512 * 1024 * 1024;
+#endif
+
+// A texture drawn this recently is assumed to be on screen (a few frames
+// at 30fps, so a dropped frame doesn't expose it)
+static constexpr int PROTECT_MS = 250;
+
+TextureResidency& TextureResidency::getInstance() {
+    static TextureResidency instance;
+    return instance;
+}
+
+void TextureResidency::track(const void* owner, size_t bytes, EvictCallback evict) {
+    if (!owner) return;
+
+    auto it = m_index.find(owner);
+    if (it != m_index.end()) {
+        m_residentBytes -= it->second->bytes;
+        m_lru.splice(m_lru.begin(), m_lru, it->second);
+    } else {
+        m_lru.push_front(Entry());
+        m_index[owner] = m_lru.begin();
+    }
+
+    Entry& entry = m_lru.front();
+    entry.owner = owner;
+    entry.bytes = bytes;
+    entry.lastDrawn = Clock::now();
+    entry.evict = std::move(evict);
+    m_residentBytes += bytes;
+    if (m_residentBytes > m_peakBytes) m_peakBytes = m_residentBytes;
+
+    // Covers uploads that didn't know their size up front
+    evictFor(0);
+}
+
+void TextureResidency::untrack(const void* owner) {
+    auto it = m_index.find(owner);
+    if (it == m_index.end()) return;
+    m_residentBytes -= it->second->bytes;
+    m_lru.erase(it->second);
+    m_index.erase(it);
+}
+
+void TextureResidency::touch(const void* owner) {
+    auto it = m_index.find(owner);
+    if (it == m_index.end()) return;
+    it->second->lastDrawn = Clock::now();
+    if (it->second != m_lru.begin()) {
+        m_lru.splice(m_lru.begin(), m_lru, it->second);
+    }
+}
+
+void TextureResidency::touchPrefetched(const void* owner) {
+    auto it = m_index.find(owner);
+    if (it == m_index.end()) return;
+    if (it->second != m_lru.begin()) {
+        m_lru.splice(m_lru.begin(), m_lru, it->second);
+    }
+}
+
+void TextureResidency::reserve(size_t bytes, const void* exclude) {
+    evictFor(bytes, exclude);
+}
+
+void TextureResidency::evictFor(size_t incoming, const void* exclude) {
+    if (m_residentBytes + incoming <= VRAM_BUDGET) return;
+
+    auto protectAfter = Clock::now() - std::chrono::milliseconds(PROTECT_MS);
+    size_t freed = 0;
+    int evicted = 0;
+    auto it = m_lru.end();
+    while (it != m_lru.begin() && m_residentBytes + incoming > VRAM_BUDGET) {
+        --it;
+        // Prefetched entries sit ahead of drawn ones without their
+        // protection, so skip on-screen textures rather than stopping
+        if (it->lastDrawn > protectAfter) continue;
+        if (it->owner == exclude) continue;
+
+        EvictCallback evict = std::move(it->evict);
+        freed += it->bytes;
+        m_residentBytes -= it->bytes;
+        m_index.erase(it->owner);
+        m_lru.erase(it);
+        evicted++;
+
+        // The callback may untrack other owners; rescan from the tail
+        if (evict) evict();
+        it = m_lru.end();
+    }
+
+    if (evicted > 0) {
+        m_evictions += evicted;
+        brls::Logger::debug("TextureResidency: Evicted {} textures ({}KB), {}KB resident",
+                            evicted, freed / 1024, m_residentBytes / 1024);
+    }
+}
+
+TextureResidency::Stats TextureResidency::getStats() const {
+    Stats stats;
+    stats.residentBytes = m_residentBytes;
+    stats.peakBytes = m_peakBytes;
+    stats.budgetBytes = VRAM_BUDGET;
+    stats.textures = static_cast<int>(m_index.size());
+    stats.evictions = m_evictions;
+    return stats;
+}
+
+} // namespace vitasuwayomi
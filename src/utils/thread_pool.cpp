@@ -0,0 +1,137 @@
+/**
+ * VitaSuwayomi - Worker Thread Pool implementation
+ */
+
+#include "utils/thread_pool.hpp"
+#include "platform/platform.hpp"
+#include "utils/perf_trace.hpp"
+
+#include <borealis.hpp>
+
+namespace vitasuwayomi {
+
+ThreadPool& ThreadPool::getInstance() {
+    // Never destroyed: detached workers may still be blocked on the condition
+    // variable at exit, and destroying it under them hangs in pthread_cond_destroy
+    static ThreadPool* instance = new ThreadPool();
+    return *instance;
+}
+
+void ThreadPool::start() {
+    int count = platform::workerThreadCount();
+    if (count < 1) count = 1;
+
+    for (int i = 0; i < count; i++) {
+        m_workers.push_back(std::unique_ptr<Worker>(new Worker()));
+    }
+    // Workers only touch m_workers after it is fully built
+    for (int i = 0; i < count; i++) {
+        platform::launchThread([this, i]() { workerLoop(i); });
+    }
+    m_workerCount.store(count);
+    brls::Logger::info("ThreadPool: started {} workers", count);
+}
+
+void ThreadPool::submit(std::function<void()> task, TaskPriority priority) {
+    Task t;
+    t.fn = std::move(task);
+    enqueue(std::move(t), priority);
+}
+
+void ThreadPool::submit(std::function<void()> task, CancelToken token, TaskPriority priority) {
+    Task t;
+    t.fn = std::move(task);
+    t.token = std::move(token);
+    t.hasToken = true;
+    enqueue(std::move(t), priority);
+}
+
+void ThreadPool::enqueue(Task task, TaskPriority priority) {
+    std::call_once(m_startOnce, [this]() { start(); });
+
+    int p = static_cast<int>(priority);
+    size_t index = m_nextWorker.fetch_add(1) % m_workers.size();
+    {
+        std::lock_guard<std::mutex> lock(m_workers[index]->mutex);
+        m_workers[index]->queues[p].push_back(std::move(task));
+    }
+    m_queuedByPriority[p].fetch_add(1);
+
+    {
+        // Count under the sleep mutex so a worker checking the predicate
+        // cannot miss the wakeup
+        std::lock_guard<std::mutex> lock(m_sleepMutex);
+        size_t depth = m_queued.fetch_add(1) + 1;
+        if (depth > m_peakQueued.load()) m_peakQueued.store(depth);
+    }
+    m_sleepCv.notify_one();
+}
+
+bool ThreadPool::takeTask(int index, Task& out) {
+    int count = static_cast<int>(m_workers.size());
+
+    // Highest priority first across the whole pool: own deque from the front
+    // (submission order), then steal from the back of the others
+    for (int p = 0; p < PRIORITY_COUNT; p++) {
+        if (m_queuedByPriority[p].load() == 0) continue;
+
+        for (int n = 0; n < count; n++) {
+            Worker& w = *m_workers[(index + n) % count];
+            std::lock_guard<std::mutex> lock(w.mutex);
+            auto& queue = w.queues[p];
+            if (queue.empty()) continue;
+
+            if (n == 0) {
+                out = std::move(queue.front());
+                queue.pop_front();
+            } else {
+                out = std::move(queue.back());
+                queue.pop_back();
+            }
+            m_queuedByPriority[p].fetch_sub(1);
+            m_queued.fetch_sub(1);
+            return true;
+        }
+    }
+    return false;
+}
+
+void ThreadPool::workerLoop(int index) {
+    PerfTrace::setThreadName("pool worker");
+    while (true) {
+        Task task;
+        if (!takeTask(index, task)) {
+            std::unique_lock<std::mutex> lock(m_sleepMutex);
+            m_sleepCv.wait(lock, [this]() { return m_queued.load() > 0; });
+            continue;
+        }
+
+        if (task.hasToken) {
+            auto alive = task.token.lock();
+            if (!alive || !*alive) {
+                m_cancelled.fetch_add(1);
+                continue;
+            }
+        }
+
+        m_busy.fetch_add(1);
+        task.fn();
+        m_busy.fetch_sub(1);
+        m_completed.fetch_add(1);
+    }
+}
+
+ThreadPool::Stats ThreadPool::getStats() {
+    Stats stats;
+    stats.workers = m_workerCount.load();
+    stats.busy = m_busy.load();
+    for (int p = 0; p < PRIORITY_COUNT; p++) {
+        stats.queued[p] = m_queuedByPriority[p].load();
+    }
+    stats.peakQueued = m_peakQueued.load();
+    stats.completed = m_completed.load();
+    stats.cancelled = m_cancelled.load();
+    return stats;
+}
+
+} // namespace vitasuwayomi
@@ -0,0 +1,222 @@
+/**
+ * VitaSuwayomi - Timer Wheel implementation
+ */
+
+#include "utils/timer_wheel.hpp"
+#include "utils/async.hpp"
+#include "platform/platform.hpp"
+
+#include <borealis.hpp>
+#include <algorithm>
+#include <chrono>
+
+namespace vitasuwayomi {
+
+TimerWheel& TimerWheel::getInstance() {
+    // Leaked like ThreadPool: the service thread never exits
+    static TimerWheel* instance = new TimerWheel();
+    return *instance;
+}
+
+uint64_t TimerWheel::nowTicks() const {
+    static const auto epoch = std::chrono::steady_clock::now();
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - epoch).count();
+    return static_cast<uint64_t>(elapsed) / TICK_MS;
+}
+
+TimerWheel::TimerId TimerWheel::schedule(int delayMs, std::function<void()> callback, TimerDispatch dispatch) {
+    return add(delayMs, 0, std::move(callback), dispatch);
+}
+
+TimerWheel::TimerId TimerWheel::schedulePeriodic(int intervalMs, std::function<void()> callback,
+                                                 TimerDispatch dispatch) {
+    return add(intervalMs, std::max(intervalMs, TICK_MS), std::move(callback), dispatch);
+}
+
+TimerWheel::TimerId TimerWheel::add(int delayMs, int intervalMs, std::function<void()> callback,
+                                    TimerDispatch dispatch) {
+    auto timer = std::make_shared<Timer>();
+    timer->callback = std::move(callback);
+    timer->dispatch = dispatch;
+    timer->intervalTicks = static_cast<uint64_t>(intervalMs / TICK_MS);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_timers.empty()) {
+        // Idle wheel: only cancelled leftovers remain, so it is safe to drop
+        // them and jump straight to the current time instead of replaying ticks
+        for (auto& level : m_slots) {
+            for (auto& slot : level) slot.clear();
+        }
+        m_currentTick = nowTicks();
+    }
+
+    timer->id = m_nextId++;
+    // From the clock, not m_currentTick: the wheel lags real time while the
+    // service thread sleeps. Round up so a timer never fires early.
+    timer->expiry = nowTicks() + static_cast<uint64_t>((std::max(delayMs, 0) + TICK_MS - 1) / TICK_MS);
+    insert(timer, false);
+    m_timers[timer->id] = timer;
+
+    if (!m_threadStarted) {
+        m_threadStarted = true;
+        // Dedicated thread rather than asyncRun: it lives for the whole session
+        platform::launchThread([this]() { serviceLoop(); });
+    } else if (timer->expiry < m_sleepUntil) {
+        // Due before the service thread would wake on its own
+        m_wake = true;
+        m_cv.notify_one();
+    }
+    return timer->id;
+}
+
+bool TimerWheel::cancel(TimerId id) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_timers.find(id);
+    if (it == m_timers.end()) return false;
+    // Slot entries are dropped lazily when their slot is next visited
+    it->second->cancelled.store(true);
+    m_timers.erase(it);
+    return true;
+}
+
+size_t TimerWheel::pendingCount() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_timers.size();
+}
+
+void TimerWheel::insert(const TimerPtr& timer, bool allowCurrentTick) {
+    // allowCurrentTick is for cascades: they run before the current level-0
+    // slot is drained, so a timer landing there still fires this tick
+    uint64_t earliest = allowCurrentTick ? m_currentTick : m_currentTick + 1;
+    uint64_t expiry = std::max(timer->expiry, earliest);
+    uint64_t delta = expiry - m_currentTick;
+
+    const int level1Shift = LEVEL0_BITS;
+    const int level2Shift = LEVEL0_BITS + LEVELN_BITS;
+    const int level3Shift = LEVEL0_BITS + 2 * LEVELN_BITS;
+    const uint64_t levelMask = (1u << LEVELN_BITS) - 1;
+
+    if (delta < (1ull << level1Shift)) {
+        m_slots[0][expiry & ((1u << LEVEL0_BITS) - 1)].push_back(timer);
+    } else if (delta < (1ull << level2Shift)) {
+        m_slots[1][(expiry >> level1Shift) & levelMask].push_back(timer);
+    } else if (delta < (1ull << level3Shift)) {
+        m_slots[2][(expiry >> level2Shift) & levelMask].push_back(timer);
+    } else if (delta < (1ull << (level3Shift + LEVELN_BITS))) {
+        m_slots[3][(expiry >> level3Shift) & levelMask].push_back(timer);
+    } else {
+        // Beyond the wheel: park in the furthest top slot, re-inserted on cascade
+        m_slots[3][((m_currentTick >> level3Shift) + levelMask) & levelMask].push_back(timer);
+    }
+}
+
+void TimerWheel::cascade(int level) {
+    int shift = LEVEL0_BITS + (level - 1) * LEVELN_BITS;
+    size_t index = (m_currentTick >> shift) & ((1u << LEVELN_BITS) - 1);
+    std::vector<TimerPtr> entries;
+    entries.swap(m_slots[level][index]);
+    for (const auto& timer : entries) {
+        if (!timer->cancelled.load()) insert(timer, true);
+    }
+}
+
+void TimerWheel::advanceTo(uint64_t tick, std::vector<TimerPtr>& due) {
+    const uint64_t level0Mask = (1u << LEVEL0_BITS) - 1;
+    const uint64_t levelMask = (1u << LEVELN_BITS) - 1;
+
+    while (m_currentTick < tick) {
+        m_currentTick++;
+        uint64_t t = m_currentTick;
+
+        if ((t & level0Mask) == 0) {
+            cascade(1);
+            if (((t >> LEVEL0_BITS) & levelMask) == 0) {
+                cascade(2);
+                if (((t >> (LEVEL0_BITS + LEVELN_BITS)) & levelMask) == 0) {
+                    cascade(3);
+                }
+            }
+        }
+
+        auto& slot = m_slots[0][t & level0Mask];
+        for (const auto& timer : slot) {
+            if (!timer->cancelled.load()) due.push_back(timer);
+        }
+        slot.clear();
+    }
+}
+
+uint64_t TimerWheel::nextWakeTick() {
+    // Next occupied level-0 slot before the next cascade; otherwise wake at
+    // the cascade itself so higher-level timers move down in time
+    const uint64_t level0Size = 1u << LEVEL0_BITS;
+    uint64_t boundary = (m_currentTick | (level0Size - 1)) + 1;
+    for (uint64_t t = m_currentTick + 1; t < boundary; t++) {
+        for (const auto& timer : m_slots[0][t & (level0Size - 1)]) {
+            if (!timer->cancelled.load()) return t;
+        }
+    }
+    return boundary;
+}
+
+void TimerWheel::run(const TimerPtr& timer) {
+    // Skip a periodic run while the previous one is still queued (slow UI
+    // thread or busy workers) rather than piling them up
+    if (timer->inFlight.exchange(true)) return;
+
+    auto fire = [timer]() {
+        if (!timer->cancelled.load()) timer->callback();
+        timer->inFlight.store(false);
+    };
+    if (timer->dispatch == TimerDispatch::MAIN_THREAD) {
+        brls::sync(fire);
+    } else {
+        asyncRun(fire);
+    }
+}
+
+void TimerWheel::serviceLoop() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+        if (m_timers.empty()) {
+            m_sleepUntil = UINT64_MAX;
+            m_cv.wait(lock, [this]() { return !m_timers.empty(); });
+            m_sleepUntil = 0;
+            m_wake = false;
+        }
+
+        std::vector<TimerPtr> due;
+        advanceTo(nowTicks(), due);
+
+        for (const auto& timer : due) {
+            if (timer->intervalTicks > 0) {
+                timer->expiry = m_currentTick + timer->intervalTicks;
+                insert(timer, false);
+            } else {
+                m_timers.erase(timer->id);
+            }
+        }
+
+        if (!due.empty()) {
+            lock.unlock();
+            for (const auto& timer : due) run(timer);
+            lock.lock();
+        }
+
+        if (m_timers.empty()) continue;
+
+        uint64_t wake = nextWakeTick();
+        uint64_t now = nowTicks();
+        if (wake > now) {
+            // Sleep until the earliest deadline; add() cuts it short for an earlier one
+            m_sleepUntil = wake;
+            int waitMs = static_cast<int>((wake - now) * TICK_MS);
+            platform::condWaitFor(m_cv, lock, waitMs, [this]() { return m_wake; });
+            m_sleepUntil = 0;
+            m_wake = false;
+        }
+    }
+}
+
+} // namespace vitasuwayomi
@@ -9,10 +9,11 @@
 #include "app/application.hpp"
 #include "utils/image_loader.hpp"
 #include "utils/async.hpp"
+#include "utils/subscription_client.hpp"
+#include "utils/timer_wheel.hpp"
 #include "utils/button_icons.hpp"
 #include "platform/platform.hpp"
 #include <memory>
-#include <thread>
 #include <chrono>
 
 // Auto-refresh interval in milliseconds (3 seconds for small queues, 5 seconds for large)
@@ -402,6 +403,12 @@ void DownloadsTab::willAppear(bool resetState) {
 
 DownloadsTab::~DownloadsTab() {
     if (m_alive) *m_alive = false;
+    if (m_autoRefreshTimerId != 0) {
+        TimerWheel::getInstance().cancel(m_autoRefreshTimerId);
+    }
+    if (m_queueSubscriptionId >= 0) {
+        SubscriptionClient::getInstance().unsubscribe(m_queueSubscriptionId);
+    }
 }
 
 void DownloadsTab::willDisappear(bool resetState) {
@@ -479,263 +486,267 @@ void DownloadsTab::refreshQueue() {
             return;
         }
 
-        // Build new cache
-        std::vector<CachedQueueItem> newCache;
-        newCache.reserve(queue.size());
-        for (const auto& item : queue) {
-            CachedQueueItem cached;
-            cached.chapterId = item.chapterId;
-            cached.mangaId = item.mangaId;
-            cached.downloadedPages = item.downloadedPages;
-            cached.pageCount = item.pageCount;
-            cached.state = static_cast<int>(item.state);
-            newCache.push_back(cached);
-        }
-
-        // Determine downloader state
-        bool isDownloading = false;
-        for (const auto& item : queue) {
-            if (item.state == DownloadState::DOWNLOADING) {
-                isDownloading = true;
-                break;
-            }
-        }
-
-        brls::sync([this, queue, isDownloading, newCache, aliveWeak]() {
+        brls::sync([this, queue, aliveWeak]() {
             auto alive = aliveWeak.lock();
             if (!alive || !*alive) return;
-            m_downloaderRunning = isDownloading;
-            if (m_startStopLabel && m_lastLocalQueue.empty()) {
-                m_startStopLabel->setText(m_downloaderRunning ? "Pause" : "Start");
-            }
+            applyServerQueue(queue);
+        });
+    });
+}
 
-            // Update status label
-            if (m_downloadStatusLabel) {
-                if (queue.empty()) {
-                    if (m_lastLocalQueue.empty()) {
-                        m_downloadStatusLabel->setText("");
-                    }
-                } else if (m_downloaderRunning) {
-                    m_downloadStatusLabel->setText("• Downloading");
-                    m_downloadStatusLabel->setTextColor(nvgRGBA(100, 200, 100, 255));
-                } else {
-                    // Check for error states in server queue
-                    bool hasError = false;
-                    for (const auto& item : queue) {
-                        if (item.state == DownloadState::ERROR) { hasError = true; break; }
-                    }
-                    if (hasError) {
-                        m_downloadStatusLabel->setText("• Error");
-                        m_downloadStatusLabel->setTextColor(nvgRGBA(200, 100, 100, 255));
-                    } else {
-                        m_downloadStatusLabel->setText("• Stopped");
-                        m_downloadStatusLabel->setTextColor(nvgRGBA(200, 150, 100, 255));
-                    }
-                }
-            }
+void DownloadsTab::applyServerQueue(const std::vector<DownloadQueueItem>& queue) {
+    // Build new cache
+    std::vector<CachedQueueItem> newCache;
+    newCache.reserve(queue.size());
+    for (const auto& item : queue) {
+        CachedQueueItem cached;
+        cached.chapterId = item.chapterId;
+        cached.mangaId = item.mangaId;
+        cached.downloadedPages = item.downloadedPages;
+        cached.pageCount = item.pageCount;
+        cached.state = static_cast<int>(item.state);
+        newCache.push_back(cached);
+    }
 
-            // Handle empty queue
-            if (queue.empty()) {
-                // Check if focus is inside server queue BEFORE destroying views
-                brls::View* currentFocus = brls::Application::getCurrentFocus();
-                bool focusInServerQueue = false;
-                for (const auto& elem : m_serverRowElements) {
-                    if (elem.row == currentFocus) { focusInServerQueue = true; break; }
-                }
+    // Determine downloader state
+    bool isDownloading = false;
+    for (const auto& item : queue) {
+        if (item.state == DownloadState::DOWNLOADING) {
+            isDownloading = true;
+            break;
+        }
+    }
 
-                // FIX: Transfer focus BEFORE destroying views to prevent use-after-free
-                // (borealis sends focus-lost events to the old focus target)
-                if (focusInServerQueue) {
-                    if (!m_localRowElements.empty() && m_localRowElements[0].row) {
-                        brls::Application::giveFocus(m_localRowElements[0].row);
-                    } else if (m_startStopBtn) {
-                        brls::Application::giveFocus(m_startStopBtn);
-                    }
-                }
+    m_downloaderRunning = isDownloading;
+    if (m_startStopLabel && m_lastLocalQueue.empty()) {
+        m_startStopLabel->setText(m_downloaderRunning ? "Pause" : "Start");
+    }
 
-                m_queueSection->setVisibility(brls::Visibility::GONE);
-                m_currentFocusedIcon = nullptr;
-                m_lastServerQueue.clear();
-                m_serverRowElements.clear();
-                while (m_queueContainer->getChildren().size() > 0) {
-                    m_queueContainer->removeView(m_queueContainer->getChildren()[0]);
-                }
-                // Show empty state if local queue is also empty
-                if (m_lastLocalQueue.empty() && m_emptyStateBox) {
-                    m_emptyStateBox->setVisibility(brls::Visibility::VISIBLE);
-                }
-                // Update navigation routes (may now point to local queue)
-                updateNavigationRoutes();
-                return;
+    // Update status label
+    if (m_downloadStatusLabel) {
+        if (queue.empty()) {
+            if (m_lastLocalQueue.empty()) {
+                m_downloadStatusLabel->setText("");
             }
+        } else if (m_downloaderRunning) {
+            m_downloadStatusLabel->setText("• Downloading");
+            m_downloadStatusLabel->setTextColor(nvgRGBA(100, 200, 100, 255));
+        } else {
+            // Check for error states in server queue
+            bool hasError = false;
+            for (const auto& item : queue) {
+                if (item.state == DownloadState::ERROR) { hasError = true; break; }
+            }
+            if (hasError) {
+                m_downloadStatusLabel->setText("• Error");
+                m_downloadStatusLabel->setTextColor(nvgRGBA(200, 100, 100, 255));
+            } else {
+                m_downloadStatusLabel->setText("• Stopped");
+                m_downloadStatusLabel->setTextColor(nvgRGBA(200, 150, 100, 255));
+            }
+        }
+    }
+
+    // Handle empty queue
+    if (queue.empty()) {
+        // Check if focus is inside server queue BEFORE destroying views
+        brls::View* currentFocus = brls::Application::getCurrentFocus();
+        bool focusInServerQueue = false;
+        for (const auto& elem : m_serverRowElements) {
+            if (elem.row == currentFocus) { focusInServerQueue = true; break; }
+        }
 
-            // Hide empty state when we have items
-            if (m_emptyStateBox) {
-                m_emptyStateBox->setVisibility(brls::Visibility::GONE);
+        // FIX: Transfer focus BEFORE destroying views to prevent use-after-free
+        // (borealis sends focus-lost events to the old focus target)
+        if (focusInServerQueue) {
+            if (!m_localRowElements.empty() && m_localRowElements[0].row) {
+                brls::Application::giveFocus(m_localRowElements[0].row);
+            } else if (m_startStopBtn) {
+                brls::Application::giveFocus(m_startStopBtn);
             }
+        }
 
-            // Show section
-            m_queueSection->setVisibility(brls::Visibility::VISIBLE);
-            m_queueEmptyLabel->setVisibility(brls::Visibility::GONE);
-            m_queueScroll->setVisibility(brls::Visibility::VISIBLE);
-
-            // INCREMENTAL UPDATE for server queue
-            // 1. Update existing items in place
-            for (size_t i = 0; i < newCache.size() && i < m_lastServerQueue.size(); i++) {
-                const auto& newItem = newCache[i];
-                const auto& oldItem = m_lastServerQueue[i];
-
-                // If same item, just update progress
-                if (newItem.chapterId == oldItem.chapterId && newItem.mangaId == oldItem.mangaId) {
-                    if (newItem.downloadedPages != oldItem.downloadedPages ||
-                        newItem.state != oldItem.state) {
-                        // Update progress label in place
-                        if (i < m_serverRowElements.size() && m_serverRowElements[i].progressLabel) {
-                            auto* progressLabel = m_serverRowElements[i].progressLabel;
-                            std::string progressText;
-                            if (newItem.state == static_cast<int>(DownloadState::DOWNLOADING)) {
-                                progressText = std::to_string(newItem.downloadedPages) + "/" +
-                                               std::to_string(newItem.pageCount) + " pages";
-                                progressLabel->setTextColor(nvgRGBA(100, 200, 100, 255));
-                            } else if (newItem.state == static_cast<int>(DownloadState::QUEUED)) {
-                                progressText = "Queued";
-                                progressLabel->setTextColor(nvgRGBA(255, 255, 255, 255));
-                            } else if (newItem.state == static_cast<int>(DownloadState::DOWNLOADED)) {
-                                progressText = "Done";
-                                progressLabel->setTextColor(nvgRGBA(100, 180, 220, 255));
-                            } else if (newItem.state == static_cast<int>(DownloadState::ERROR)) {
-                                progressText = "Error";
-                                progressLabel->setTextColor(nvgRGBA(200, 100, 100, 255));
-                            } else {
-                                progressText = std::to_string(newItem.downloadedPages) + "/" +
-                                               std::to_string(newItem.pageCount);
-                                progressLabel->setTextColor(nvgRGBA(255, 255, 255, 255));
-                            }
-                            progressLabel->setText(progressText);
-
-                            // Update background color
-                            if (m_serverRowElements[i].row) {
-                                if (newItem.state == static_cast<int>(DownloadState::DOWNLOADING)) {
-                                    m_serverRowElements[i].row->setBackgroundColor(nvgRGBA(30, 60, 30, 200));
-                                } else if (newItem.state == static_cast<int>(DownloadState::ERROR)) {
-                                    m_serverRowElements[i].row->setBackgroundColor(nvgRGBA(60, 30, 30, 200));
-                                } else if (newItem.state == static_cast<int>(DownloadState::DOWNLOADED)) {
-                                    m_serverRowElements[i].row->setBackgroundColor(nvgRGBA(30, 50, 60, 200));
-                                } else {
-                                    m_serverRowElements[i].row->setBackgroundColor(Application::getInstance().getInactiveRowBackground());
-                                }
-                            }
+        m_queueSection->setVisibility(brls::Visibility::GONE);
+        m_currentFocusedIcon = nullptr;
+        m_lastServerQueue.clear();
+        m_serverRowElements.clear();
+        while (m_queueContainer->getChildren().size() > 0) {
+            m_queueContainer->removeView(m_queueContainer->getChildren()[0]);
+        }
+        // Show empty state if local queue is also empty
+        if (m_lastLocalQueue.empty() && m_emptyStateBox) {
+            m_emptyStateBox->setVisibility(brls::Visibility::VISIBLE);
+        }
+        // Update navigation routes (may now point to local queue)
+        updateNavigationRoutes();
+        return;
+    }
+
+    // Hide empty state when we have items
+    if (m_emptyStateBox) {
+        m_emptyStateBox->setVisibility(brls::Visibility::GONE);
+    }
+
+    // Show section
+    m_queueSection->setVisibility(brls::Visibility::VISIBLE);
+    m_queueEmptyLabel->setVisibility(brls::Visibility::GONE);
+    m_queueScroll->setVisibility(brls::Visibility::VISIBLE);
+
+    // INCREMENTAL UPDATE for server queue
+    // 1. Update existing items in place
+    for (size_t i = 0; i < newCache.size() && i < m_lastServerQueue.size(); i++) {
+        const auto& newItem = newCache[i];
+        const auto& oldItem = m_lastServerQueue[i];
+
+        // If same item, just update progress
+        if (newItem.chapterId == oldItem.chapterId && newItem.mangaId == oldItem.mangaId) {
+            if (newItem.downloadedPages != oldItem.downloadedPages ||
+                newItem.state != oldItem.state) {
+                // Update progress label in place
+                if (i < m_serverRowElements.size() && m_serverRowElements[i].progressLabel) {
+                    auto* progressLabel = m_serverRowElements[i].progressLabel;
+                    std::string progressText;
+                    if (newItem.state == static_cast<int>(DownloadState::DOWNLOADING)) {
+                        progressText = std::to_string(newItem.downloadedPages) + "/" +
+                                       std::to_string(newItem.pageCount) + " pages";
+                        progressLabel->setTextColor(nvgRGBA(100, 200, 100, 255));
+                    } else if (newItem.state == static_cast<int>(DownloadState::QUEUED)) {
+                        progressText = "Queued";
+                        progressLabel->setTextColor(nvgRGBA(255, 255, 255, 255));
+                    } else if (newItem.state == static_cast<int>(DownloadState::DOWNLOADED)) {
+                        progressText = "Done";
+                        progressLabel->setTextColor(nvgRGBA(100, 180, 220, 255));
+                    } else if (newItem.state == static_cast<int>(DownloadState::ERROR)) {
+                        progressText = "Error";
+                        progressLabel->setTextColor(nvgRGBA(200, 100, 100, 255));
+                    } else {
+                        progressText = std::to_string(newItem.downloadedPages) + "/" +
+                                       std::to_string(newItem.pageCount);
+                        progressLabel->setTextColor(nvgRGBA(255, 255, 255, 255));
+                    }
+                    progressLabel->setText(progressText);
+
+                    // Update background color
+                    if (m_serverRowElements[i].row) {
+                        if (newItem.state == static_cast<int>(DownloadState::DOWNLOADING)) {
+                            m_serverRowElements[i].row->setBackgroundColor(nvgRGBA(30, 60, 30, 200));
+                        } else if (newItem.state == static_cast<int>(DownloadState::ERROR)) {
+                            m_serverRowElements[i].row->setBackgroundColor(nvgRGBA(60, 30, 30, 200));
+                        } else if (newItem.state == static_cast<int>(DownloadState::DOWNLOADED)) {
+                            m_serverRowElements[i].row->setBackgroundColor(nvgRGBA(30, 50, 60, 200));
+                        } else {
+                            m_serverRowElements[i].row->setBackgroundColor(Application::getInstance().getInactiveRowBackground());
                         }
                     }
                 }
             }
+        }
+    }
 
-            // Determine structural changes: items to remove and add
-            std::vector<int> toRemoveIds;
-            for (const auto& elem : m_serverRowElements) {
-                bool found = false;
-                for (const auto& newItem : newCache) {
-                    if (elem.chapterId == newItem.chapterId) { found = true; break; }
-                }
-                if (!found) toRemoveIds.push_back(elem.chapterId);
-            }
+    // Determine structural changes: items to remove and add
+    std::vector<int> toRemoveIds;
+    for (const auto& elem : m_serverRowElements) {
+        bool found = false;
+        for (const auto& newItem : newCache) {
+            if (elem.chapterId == newItem.chapterId) { found = true; break; }
+        }
+        if (!found) toRemoveIds.push_back(elem.chapterId);
+    }
 
-            std::vector<size_t> toAddIndices;
-            for (size_t i = 0; i < queue.size(); i++) {
-                bool found = false;
-                for (const auto& elem : m_serverRowElements) {
-                    if (elem.chapterId == queue[i].chapterId) { found = true; break; }
-                }
-                if (!found) toAddIndices.push_back(i);
-            }
+    std::vector<size_t> toAddIndices;
+    for (size_t i = 0; i < queue.size(); i++) {
+        bool found = false;
+        for (const auto& elem : m_serverRowElements) {
+            if (elem.chapterId == queue[i].chapterId) { found = true; break; }
+        }
+        if (!found) toAddIndices.push_back(i);
+    }
 
-            bool setChanged = !toRemoveIds.empty() || !toAddIndices.empty();
+    bool setChanged = !toRemoveIds.empty() || !toAddIndices.empty();
 
-            // Check if order changed (only when the set of items is the same)
-            bool orderChanged = false;
-            if (!setChanged && newCache.size() == m_serverRowElements.size()) {
-                for (size_t i = 0; i < newCache.size(); i++) {
-                    if (newCache[i].chapterId != m_serverRowElements[i].chapterId) {
-                        orderChanged = true;
-                        break;
-                    }
-                }
+    // Check if order changed (only when the set of items is the same)
+    bool orderChanged = false;
+    if (!setChanged && newCache.size() == m_serverRowElements.size()) {
+        for (size_t i = 0; i < newCache.size(); i++) {
+            if (newCache[i].chapterId != m_serverRowElements[i].chapterId) {
+                orderChanged = true;
+                break;
             }
+        }
+    }
 
-            // Update cache
-            m_lastServerQueue = newCache;
+    // Update cache
+    m_lastServerQueue = newCache;
 
-            if (!setChanged && !orderChanged) {
-                // Only progress updates, no structural change needed
-                updateNavigationRoutes();
-                return;
-            }
+    if (!setChanged && !orderChanged) {
+        // Only progress updates, no structural change needed
+        updateNavigationRoutes();
+        return;
+    }
 
-            // FIX 1: Null m_currentFocusedIcon before any structural change
-            // to prevent dangling pointer access during rebuild
-            m_currentFocusedIcon = nullptr;
+    // FIX 1: Null m_currentFocusedIcon before any structural change
+    // to prevent dangling pointer access during rebuild
+    m_currentFocusedIcon = nullptr;
 
-            if (setChanged) {
-                // Incremental update: remove gone items, then add new items
-                for (int chapterId : toRemoveIds) {
-                    removeServerItem(chapterId);
-                }
+    if (setChanged) {
+        // Incremental update: remove gone items, then add new items
+        for (int chapterId : toRemoveIds) {
+            removeServerItem(chapterId);
+        }
 
-                int totalQueueSize = static_cast<int>(queue.size());
-                for (size_t idx : toAddIndices) {
-                    const auto& item = queue[idx];
-                    addServerItem(item.chapterId, item.mangaId, item.mangaTitle,
-                                  item.chapterName, item.chapterNumber,
-                                  item.downloadedPages, item.pageCount,
-                                  static_cast<int>(item.state),
-                                  static_cast<int>(idx), totalQueueSize);
-                }
-            } else {
-                // Order changed: full rebuild needed to update currentIndex in actions
-                // Save focus state before destroying views
-                brls::View* currentFocus = brls::Application::getCurrentFocus();
-                int focusedIdx = -1;
-                for (size_t i = 0; i < m_serverRowElements.size(); i++) {
-                    if (m_serverRowElements[i].row == currentFocus) {
-                        focusedIdx = static_cast<int>(i);
-                        break;
-                    }
-                }
+        int totalQueueSize = static_cast<int>(queue.size());
+        for (size_t idx : toAddIndices) {
+            const auto& item = queue[idx];
+            addServerItem(item.chapterId, item.mangaId, item.mangaTitle,
+                          item.chapterName, item.chapterNumber,
+                          item.downloadedPages, item.pageCount,
+                          static_cast<int>(item.state),
+                          static_cast<int>(idx), totalQueueSize);
+        }
+    } else {
+        // Order changed: full rebuild needed to update currentIndex in actions
+        // Save focus state before destroying views
+        brls::View* currentFocus = brls::Application::getCurrentFocus();
+        int focusedIdx = -1;
+        for (size_t i = 0; i < m_serverRowElements.size(); i++) {
+            if (m_serverRowElements[i].row == currentFocus) {
+                focusedIdx = static_cast<int>(i);
+                break;
+            }
+        }
 
-                // FIX: Transfer focus to a safe target BEFORE destroying views
-                // to prevent use-after-free on borealis focus-lost events
-                if (focusedIdx >= 0 && m_startStopBtn) {
-                    brls::Application::giveFocus(m_startStopBtn);
-                }
+        // FIX: Transfer focus to a safe target BEFORE destroying views
+        // to prevent use-after-free on borealis focus-lost events
+        if (focusedIdx >= 0 && m_startStopBtn) {
+            brls::Application::giveFocus(m_startStopBtn);
+        }
 
-                m_serverRowElements.clear();
-                while (m_queueContainer->getChildren().size() > 0) {
-                    m_queueContainer->removeView(m_queueContainer->getChildren()[0]);
-                }
+        m_serverRowElements.clear();
+        while (m_queueContainer->getChildren().size() > 0) {
+            m_queueContainer->removeView(m_queueContainer->getChildren()[0]);
+        }
 
-                int queueIndex = 0;
-                int totalQueueSize = static_cast<int>(queue.size());
-                for (const auto& item : queue) {
-                    addServerItem(item.chapterId, item.mangaId, item.mangaTitle,
-                                  item.chapterName, item.chapterNumber,
-                                  item.downloadedPages, item.pageCount,
-                                  static_cast<int>(item.state),
-                                  queueIndex++, totalQueueSize);
-                }
+        int queueIndex = 0;
+        int totalQueueSize = static_cast<int>(queue.size());
+        for (const auto& item : queue) {
+            addServerItem(item.chapterId, item.mangaId, item.mangaTitle,
+                          item.chapterName, item.chapterNumber,
+                          item.downloadedPages, item.pageCount,
+                          static_cast<int>(item.state),
+                          queueIndex++, totalQueueSize);
+        }
 
-                // Restore focus to same index position after rebuild
-                if (focusedIdx >= 0 && !m_serverRowElements.empty()) {
-                    int newIdx = std::min(focusedIdx, static_cast<int>(m_serverRowElements.size()) - 1);
-                    if (m_serverRowElements[newIdx].row) {
-                        brls::Application::giveFocus(m_serverRowElements[newIdx].row);
-                    }
-                }
+        // Restore focus to same index position after rebuild
+        if (focusedIdx >= 0 && !m_serverRowElements.empty()) {
+            int newIdx = std::min(focusedIdx, static_cast<int>(m_serverRowElements.size()) - 1);
+            if (m_serverRowElements[newIdx].row) {
+                brls::Application::giveFocus(m_serverRowElements[newIdx].row);
             }
+        }
+    }
 
-            // Update d-pad navigation routes after queue is built
-            updateNavigationRoutes();
-        });
-    });
+    // Update d-pad navigation routes after queue is built
+    updateNavigationRoutes();
 }
 
 void DownloadsTab::refreshLocalDownloads() {
@@ -947,52 +958,62 @@ void DownloadsTab::showDownloadOptions(const std::string& ratingKey, const std::
 }
 
 void DownloadsTab::startAutoRefresh() {
-    // Use compare_exchange to atomically check and set (prevent race conditions)
-    bool expected = false;
-    if (!m_autoRefreshTimerActive.compare_exchange_strong(expected, true)) {
+    if (m_autoRefreshTimerId != 0) {
         return;  // Already running
     }
 
     m_autoRefreshEnabled.store(true);
 
-    // Start auto-refresh loop in background thread
-    // Use shared_ptr to m_alive for loop termination (safe even after object destruction)
-    auto aliveShared = m_alive;
-    asyncRun([this, aliveShared]() {
-        while (true) {
-            // Check if object is still alive before accessing any members
-            if (!aliveShared || !*aliveShared) break;
-
-            // Use default interval - avoid accessing member vectors on background thread
-            int refreshInterval = AUTO_REFRESH_INTERVAL_MS;
-
-            // Sleep for the interval
-            std::this_thread::sleep_for(std::chrono::milliseconds(refreshInterval));
-
-            // Check again after sleep
-            if (!aliveShared || !*aliveShared) break;
-
-            // Trigger refresh on main thread for both server and local queues
-            std::weak_ptr<bool> aliveWeak = aliveShared;
-            brls::sync([this, aliveWeak]() {
-                auto alive = aliveWeak.lock();
+    // Subscribe to server queue changes. While the subscription is live the
+    // timer below skips the server fetch, so an idle queue costs no requests.
+    if (m_queueSubscriptionId < 0 && Application::getInstance().isConnected()) {
+        std::weak_ptr<bool> subAlive = m_alive;
+        m_queueSubscriptionId = SubscriptionClient::getInstance().subscribe(
+            SuwayomiClient::getDownloadQueueSubscription(),
+            [this, subAlive](const std::string& message) {
+                std::vector<DownloadQueueItem> queue;
+                SuwayomiClient::getInstance().parseDownloadQueue(message, queue);
+                brls::sync([this, queue, subAlive]() {
+                    auto alive = subAlive.lock();
+                    if (!alive || !*alive) return;
+                    if (m_autoRefreshEnabled.load()) {
+                        applyServerQueue(queue);
+                    }
+                });
+            },
+            [this, subAlive](bool live) {
+                auto alive = subAlive.lock();
                 if (!alive || !*alive) return;
-                if (m_autoRefreshEnabled.load() && this->getVisibility() == brls::Visibility::VISIBLE) {
+                m_queueSubscriptionLive.store(live);
+            });
+    }
+
+    // Periodic refresh on the shared timer wheel (runs on the main thread)
+    std::weak_ptr<bool> aliveWeak = m_alive;
+    m_autoRefreshTimerId = TimerWheel::getInstance().schedulePeriodic(AUTO_REFRESH_INTERVAL_MS,
+        [this, aliveWeak]() {
+            auto alive = aliveWeak.lock();
+            if (!alive || !*alive) return;
+            if (m_autoRefreshEnabled.load() && this->getVisibility() == brls::Visibility::VISIBLE) {
+                if (!m_queueSubscriptionLive.load()) {
                     refreshQueue();
-                    refreshLocalDownloads();
                 }
-            });
-        }
-    });
+                refreshLocalDownloads();
+            }
+        });
 }
 
 void DownloadsTab::stopAutoRefresh() {
-    // Set to false - timer will stop on next iteration
     m_autoRefreshEnabled.store(false);
-    // Reset timer active flag so startAutoRefresh() can launch a new thread on next willAppear
-    m_autoRefreshTimerActive.store(false);
-    // Note: We don't wait for the thread to stop here to avoid blocking the UI
-    // The old thread will exit on its next loop iteration when it sees *m_alive == false
+    if (m_autoRefreshTimerId != 0) {
+        TimerWheel::getInstance().cancel(m_autoRefreshTimerId);
+        m_autoRefreshTimerId = 0;
+    }
+    if (m_queueSubscriptionId >= 0) {
+        SubscriptionClient::getInstance().unsubscribe(m_queueSubscriptionId);
+        m_queueSubscriptionId = -1;
+    }
+    m_queueSubscriptionLive.store(false);
 }
 
 
@@ -10,6 +10,7 @@
 #include "app/application.hpp"
 #include "utils/image_loader.hpp"
 #include "utils/button_icons.hpp"
+#include "utils/extension_catalog.hpp"
 
 #include <borealis.hpp>
 #include <algorithm>
@@ -435,37 +436,8 @@ void ExtensionsDataSource::rebuildRows() {
     if (m_tab->isSearchActive()) {
         const std::string& query = m_tab->getSearchQuery();
 
-        // Helper lambda to check if extension matches search query
-        auto matchesSearch = [&query](const Extension& ext) {
-            std::string nameLower = ext.name;
-            std::transform(nameLower.begin(), nameLower.end(), nameLower.begin(), ::tolower);
-            return nameLower.find(query) != std::string::npos;
-        };
-
-        // Collect all matching extensions from all categories
-        std::vector<Extension> results;
-
-        for (const auto& ext : updates) {
-            if (matchesSearch(ext)) {
-                results.push_back(ext);
-            }
-        }
-        for (const auto& ext : installed) {
-            if (matchesSearch(ext)) {
-                results.push_back(ext);
-            }
-        }
-        for (const auto& pair : grouped) {
-            for (const auto& ext : pair.second) {
-                if (matchesSearch(ext)) {
-                    results.push_back(ext);
-                }
-            }
-        }
-
-        // Sort results by name
-        std::sort(results.begin(), results.end(),
-            [](const Extension& a, const Extension& b) { return a.name < b.name; });
+        // Name index lookup; results come back in name order
+        std::vector<Extension> results = m_tab->searchExtensions(query);
 
         // Add "Clear Search" header at the top
         ExtensionRow searchHeader;
@@ -868,119 +840,119 @@ void ExtensionsTab::onFocusGained() {
 void ExtensionsTab::loadExtensionsFast() {
     brls::Logger::debug("Loading extensions list (fast mode)...");
 
-    // Show offline message if not connected and no cached data
-    if (!Application::getInstance().isConnected() && !m_cacheLoaded) {
-        showError("App is offline - connect to a server to manage extensions");
+    bool connected = Application::getInstance().isConnected();
+
+    // Already have the catalog in memory and nothing asked for a refetch
+    if (m_cacheLoaded && !m_catalog->empty()) {
+        refreshUIFromCache();
         return;
     }
 
-    showLoading("Loading extensions...");
-
-    // Capture cache state by value for safe background thread access
-    bool cacheLoaded = m_cacheLoaded;
-    std::vector<Extension> cachedCopy = m_cachedExtensions;
+    if (m_catalog->empty()) {
+        showLoading("Loading extensions...");
+    }
 
-    brls::async([this, aliveWeak = std::weak_ptr<bool>(m_alive), cacheLoaded, cachedCopy]() {
-        SuwayomiClient& client = SuwayomiClient::getInstance();
-        const AppSettings& settings = Application::getInstance().getSettings();
+    std::set<std::string> filterLanguages = getEnabledLanguages();
+    // The loader merges into its own copy, made off the UI thread
+    std::shared_ptr<const ExtensionCatalog> snapshot = m_catalog;
+
+    brls::async([this, aliveWeak = std::weak_ptr<bool>(m_alive), connected, filterLanguages,
+                 snapshot]() {
+        // Draw from the on-disk catalog first so the tab is usable before the
+        // server answers (or at all, when offline)
+        ExtensionCatalog catalog;
+        bool fromDisk = false;
+        if (snapshot->empty() && catalog.load()) {
+            fromDisk = true;
+            brls::Logger::info("ExtensionsTab: Loaded {} extensions from disk (catalog {:08x})",
+                               catalog.entries().size(), catalog.version());
+            // Online the merge below still needs it
+            publishCatalog(connected ? ExtensionCatalog(catalog) : std::move(catalog),
+                           filterLanguages, aliveWeak, !connected);
+        }
 
-        // Work entirely with local variables on the background thread
-        std::vector<Extension> allExtensions;
-        if (cacheLoaded && !cachedCopy.empty()) {
-            allExtensions = cachedCopy;
-            brls::Logger::debug("Using cached extensions ({} total)", allExtensions.size());
-        } else {
-            bool success = client.fetchExtensionList(allExtensions);
-            if (!success) {
-                Application::getInstance().setConnected(false);
+        if (!connected) {
+            if (!fromDisk) {
                 brls::sync([this, aliveWeak]() {
                     auto alive = aliveWeak.lock();
                     if (!alive || !*alive) return;
                     showError("App is offline - connect to a server to manage extensions");
                 });
-                return;
             }
-            brls::Logger::debug("Fetched {} extensions", allExtensions.size());
+            return;
         }
 
-        std::set<std::string> filterLanguages = settings.enabledSourceLanguages;
-        if (filterLanguages.empty()) {
-            filterLanguages.insert("en");
+        std::vector<Extension> fresh;
+        if (!SuwayomiClient::getInstance().fetchExtensionList(fresh)) {
+            Application::getInstance().setConnected(false);
+            brls::sync([this, aliveWeak, fromDisk]() {
+                auto alive = aliveWeak.lock();
+                if (!alive || !*alive) return;
+                if (m_catalog->empty()) {
+                    showError("App is offline - connect to a server to manage extensions");
+                } else if (!fromDisk) {
+                    brls::Application::notify("Failed to refresh extensions");
+                }
+            });
+            return;
         }
 
-        // Use local vectors, not member variables
-        std::vector<Extension> updates;
-        std::vector<Extension> installed;
-        std::vector<Extension> uninstalled;
-
-        for (const auto& ext : allExtensions) {
-            if (ext.installed) {
-                if (ext.hasUpdate) {
-                    updates.push_back(ext);
-                } else {
-                    installed.push_back(ext);
-                }
-            } else {
-                bool languageMatch = false;
-                if (filterLanguages.count(ext.lang) > 0) {
-                    languageMatch = true;
-                } else {
-                    std::string baseLang = ext.lang;
-                    size_t dashPos = baseLang.find('-');
-                    if (dashPos != std::string::npos) {
-                        baseLang = baseLang.substr(0, dashPos);
-                    }
-                    if (filterLanguages.count(baseLang) > 0) {
-                        languageMatch = true;
-                    }
-                }
-                if (ext.lang == "multi" || ext.lang == "all") {
-                    languageMatch = true;
-                }
-                if (languageMatch) {
-                    uninstalled.push_back(ext);
-                }
-            }
+        // Apply only what changed since the stored catalog
+        if (!fromDisk) catalog = *snapshot;
+        ExtensionCatalog::Delta delta = catalog.merge(fresh);
+        brls::Logger::info("ExtensionsTab: Fetched {} extensions (+{} -{} ~{})",
+                           fresh.size(), delta.added, delta.removed, delta.changed);
+        if (delta.empty() && fromDisk) {
+            // Disk copy was current - the tab is already showing it
+            brls::sync([this, aliveWeak]() {
+                auto alive = aliveWeak.lock();
+                if (!alive || !*alive) return;
+                m_cacheLoaded = true;
+            });
+            return;
         }
+        if (!delta.empty()) {
+            catalog.save();
+        }
+        publishCatalog(std::move(catalog), filterLanguages, aliveWeak, true);
+    });
+}
 
-        // Sort lists alphabetically
-        auto sortByName = [](const Extension& a, const Extension& b) {
-            return a.name < b.name;
-        };
-        std::sort(updates.begin(), updates.end(), sortByName);
-        std::sort(installed.begin(), installed.end(), sortByName);
-        std::sort(uninstalled.begin(), uninstalled.end(), sortByName);
-
-        // Group uninstalled by language
-        auto grouped = groupExtensionsByLanguage(uninstalled);
-        auto sortedLangs = getSortedLanguageKeys(grouped);
-
-        brls::Logger::debug("Fast mode: {} updates, {} installed, {} uninstalled",
-            updates.size(), installed.size(), uninstalled.size());
-
-        // Transfer all results to member variables on UI thread only
-        brls::sync([this, aliveWeak, allExtensions = std::move(allExtensions),
-                    updates = std::move(updates), installed = std::move(installed),
-                    uninstalled = std::move(uninstalled), grouped = std::move(grouped),
-                    sortedLangs = std::move(sortedLangs), cacheLoaded]() {
-            auto alive = aliveWeak.lock();
-            if (!alive || !*alive) return;
-            m_cachedExtensions = std::move(allExtensions);
-            m_cacheLoaded = true;
-            m_updates = std::move(updates);
-            m_installed = std::move(installed);
-            m_uninstalled = std::move(uninstalled);
-            m_cachedGrouped = std::move(grouped);
-            m_cachedSortedLanguages = std::move(sortedLangs);
-            reloadRecycler();
-        });
+void ExtensionsTab::publishCatalog(ExtensionCatalog catalog, const std::set<std::string>& filterLanguages,
+                                   std::weak_ptr<bool> aliveWeak, bool complete) {
+    // Runs on the loader thread; the categorized lists are handed to the UI thread
+    ExtensionLists lists = categorizeExtensions(catalog, filterLanguages);
+    std::vector<std::string> sortedLangs = getSortedLanguageKeys(lists.grouped);
+
+    brls::Logger::debug("Fast mode: {} updates, {} installed, {} uninstalled",
+        lists.updates.size(), lists.installed.size(), lists.uninstalled.size());
+
+    brls::sync([this, aliveWeak, catalog = std::move(catalog), lists = std::move(lists),
+                sortedLangs = std::move(sortedLangs), complete]() mutable {
+        auto alive = aliveWeak.lock();
+        if (!alive || !*alive) return;
+        m_catalog = std::make_shared<ExtensionCatalog>(std::move(catalog));
+        m_cacheLoaded = complete;
+        m_updates = std::move(lists.updates);
+        m_installed = std::move(lists.installed);
+        m_uninstalled = std::move(lists.uninstalled);
+        m_cachedGrouped = std::move(lists.grouped);
+        m_cachedSortedLanguages = std::move(sortedLangs);
+        reloadRecycler();
     });
 }
 
+Extension* ExtensionsTab::findCatalogEntryForEdit(const std::string& pkgName) {
+    if (m_catalog.use_count() > 1) {
+        m_catalog = std::make_shared<ExtensionCatalog>(*m_catalog);
+    }
+    return m_catalog->find(pkgName);
+}
+
 void ExtensionsTab::refreshExtensions() {
     brls::Logger::info("Refreshing extensions from server...");
 
-    m_cachedExtensions.clear();
+    // Keep the current catalog on screen; the fetch merges into it
     m_cacheLoaded = false;
 
     brls::Application::notify("Refreshing extensions...");
@@ -988,62 +960,78 @@ void ExtensionsTab::refreshExtensions() {
 }
 
 void ExtensionsTab::refreshUIFromCache() {
-    if (!m_cacheLoaded) {
+    if (m_catalog->empty()) {
         loadExtensionsFast();
         return;
     }
 
-    const AppSettings& settings = Application::getInstance().getSettings();
-    std::set<std::string> filterLanguages = settings.enabledSourceLanguages;
+    ExtensionLists lists = categorizeExtensions(*m_catalog, getEnabledLanguages());
+    m_updates = std::move(lists.updates);
+    m_installed = std::move(lists.installed);
+    m_uninstalled = std::move(lists.uninstalled);
+    m_cachedGrouped = std::move(lists.grouped);
+    m_cachedSortedLanguages = getSortedLanguageKeys(m_cachedGrouped);
+
+    reloadRecycler();
+}
+
+std::set<std::string> ExtensionsTab::getEnabledLanguages() {
+    std::set<std::string> filterLanguages = Application::getInstance().getSettings().enabledSourceLanguages;
     if (filterLanguages.empty()) {
         filterLanguages.insert("en");
     }
+    return filterLanguages;
+}
 
-    m_updates.clear();
-    m_installed.clear();
-    m_uninstalled.clear();
+bool ExtensionsTab::isLanguageEnabled(const std::string& lang, const std::set<std::string>& filterLanguages) {
+    if (lang == "multi" || lang == "all") return true;
+    if (filterLanguages.count(lang) > 0) return true;
+    size_t dashPos = lang.find('-');
+    return dashPos != std::string::npos && filterLanguages.count(lang.substr(0, dashPos)) > 0;
+}
 
-    for (const auto& ext : m_cachedExtensions) {
+ExtensionsTab::ExtensionLists ExtensionsTab::categorizeExtensions(const ExtensionCatalog& catalog,
+                                                                 const std::set<std::string>& filterLanguages) {
+    // Catalog entries are already in name order and grouped by language, so
+    // this is a filter pass with no sorting
+    ExtensionLists lists;
+    const auto& entries = catalog.entries();
+    for (const auto& ext : entries) {
         if (ext.installed) {
             if (ext.hasUpdate) {
-                m_updates.push_back(ext);
+                lists.updates.push_back(ext);
             } else {
-                m_installed.push_back(ext);
-            }
-        } else {
-            bool languageMatch = false;
-            if (filterLanguages.count(ext.lang) > 0) {
-                languageMatch = true;
-            } else {
-                std::string baseLang = ext.lang;
-                size_t dashPos = baseLang.find('-');
-                if (dashPos != std::string::npos) {
-                    baseLang = baseLang.substr(0, dashPos);
-                }
-                if (filterLanguages.count(baseLang) > 0) {
-                    languageMatch = true;
-                }
-            }
-            if (ext.lang == "multi" || ext.lang == "all") {
-                languageMatch = true;
-            }
-            if (languageMatch) {
-                m_uninstalled.push_back(ext);
+                lists.installed.push_back(ext);
             }
+        } else if (isLanguageEnabled(ext.lang, filterLanguages)) {
+            lists.uninstalled.push_back(ext);
         }
     }
 
-    auto sortByName = [](const Extension& a, const Extension& b) {
-        return a.name < b.name;
-    };
-    std::sort(m_updates.begin(), m_updates.end(), sortByName);
-    std::sort(m_installed.begin(), m_installed.end(), sortByName);
-    std::sort(m_uninstalled.begin(), m_uninstalled.end(), sortByName);
-
-    m_cachedGrouped = groupExtensionsByLanguage(m_uninstalled);
-    m_cachedSortedLanguages = getSortedLanguageKeys(m_cachedGrouped);
+    for (const auto& group : catalog.languageGroups()) {
+        if (!isLanguageEnabled(group.lang, filterLanguages)) continue;
+        std::vector<Extension> members;
+        for (int index : group.members) {
+            if (!entries[index].installed) members.push_back(entries[index]);
+        }
+        if (!members.empty()) {
+            lists.grouped[group.lang] = std::move(members);
+        }
+    }
+    return lists;
+}
 
-    reloadRecycler();
+std::vector<Extension> ExtensionsTab::searchExtensions(const std::string& query) {
+    std::set<std::string> filterLanguages = getEnabledLanguages();
+    std::vector<Extension> results;
+    const auto& entries = m_catalog->entries();
+    for (int index : m_catalog->search(query)) {
+        const Extension& ext = entries[index];
+        if (ext.installed || isLanguageEnabled(ext.lang, filterLanguages)) {
+            results.push_back(ext);
+        }
+    }
+    return results;
 }
 
 void ExtensionsTab::reloadRecycler() {
@@ -1111,20 +1099,6 @@ void ExtensionsTab::showError(const std::string& message) {
     }
 }
 
-std::map<std::string, std::vector<Extension>> ExtensionsTab::groupExtensionsByLanguage(
-    const std::vector<Extension>& extensions) {
-    std::map<std::string, std::vector<Extension>> grouped;
-    for (const auto& ext : extensions) {
-        grouped[ext.lang].push_back(ext);
-    }
-    // Sort each group alphabetically
-    for (auto& pair : grouped) {
-        std::sort(pair.second.begin(), pair.second.end(),
-            [](const Extension& a, const Extension& b) { return a.name < b.name; });
-    }
-    return grouped;
-}
-
 std::vector<std::string> ExtensionsTab::getSortedLanguageKeys(
     const std::map<std::string, std::vector<Extension>>& grouped) {
     std::vector<std::string> keys;
@@ -1219,12 +1193,9 @@ void ExtensionsTab::installExtension(const Extension& ext) {
                 auto alive = aliveWeak.lock();
                 if (!alive || !*alive) return;
                 // Update cache on UI thread only
-                for (auto& cachedExt : m_cachedExtensions) {
-                    if (cachedExt.pkgName == ext.pkgName) {
-                        cachedExt.installed = true;
-                        cachedExt.hasUpdate = false;
-                        break;
-                    }
+                if (Extension* cachedExt = findCatalogEntryForEdit(ext.pkgName)) {
+                    cachedExt->installed = true;
+                    cachedExt->hasUpdate = false;
                 }
                 brls::Application::notify(ext.name + " installed");
                 refreshUIFromCache();
@@ -1261,11 +1232,8 @@ void ExtensionsTab::updateExtension(const Extension& ext) {
                 auto alive = aliveWeak.lock();
                 if (!alive || !*alive) return;
                 // Update cache on UI thread only
-                for (auto& cachedExt : m_cachedExtensions) {
-                    if (cachedExt.pkgName == ext.pkgName) {
-                        cachedExt.hasUpdate = false;
-                        break;
-                    }
+                if (Extension* cachedExt = findCatalogEntryForEdit(ext.pkgName)) {
+                    cachedExt->hasUpdate = false;
                 }
                 brls::Application::notify(ext.name + " updated");
                 refreshUIFromCache();
@@ -1311,12 +1279,9 @@ void ExtensionsTab::uninstallExtension(const Extension& ext) {
                     auto alive = aliveWeak.lock();
                     if (!alive || !*alive) return;
                     // Update cache on UI thread only
-                    for (auto& cachedExt : m_cachedExtensions) {
-                        if (cachedExt.pkgName == ext.pkgName) {
-                            cachedExt.installed = false;
-                            cachedExt.hasUpdate = false;
-                            break;
-                        }
+                    if (Extension* cachedExt = findCatalogEntryForEdit(ext.pkgName)) {
+                        cachedExt->installed = false;
+                        cachedExt->hasUpdate = false;
                     }
                     brls::Application::notify(ext.name + " uninstalled");
                     refreshUIFromCache();
@@ -38,7 +38,7 @@ void HorizontalScrollRow::draw(NVGcontext* vg, float x, float y, float width, fl
         float ch = cell->getDrawH();
         if (ch <= 0) continue;
 
-        int nvgImg = cell->getCoverImage();
+        int nvgImg = cell->getCoverImageForDraw();
         if (nvgImg != 0) {
             float imgW = static_cast<float>(cell->getCoverWidth());
             float imgH = static_cast<float>(cell->getCoverHeight());
@@ -15,11 +15,15 @@
 #include "utils/async.hpp"
 #include "utils/image_loader.hpp"
 #include "utils/library_cache.hpp"
+#include "utils/library_search.hpp"
+#include "utils/subscription_client.hpp"
+#include "utils/timer_wheel.hpp"
 #include "utils/button_icons.hpp"
 #include "view/migrate_search_view.hpp"
 #include <atomic>
 #include <chrono>
 #include <condition_variable>
+#include <ctime>
 #include <map>
 #include <mutex>
 #include <set>
@@ -39,6 +43,38 @@ static void setChildrenFocusableRecursive(brls::Box* container, bool focusable)
     }
 }
 
+// Fields without a server timestamp (download counts, chapters marked unread)
+// only come back with a full fetch, so delta sync falls back to one this often
+static constexpr int64_t FULL_LIBRARY_SYNC_INTERVAL_S = 30 * 60;
+
+// Runs on a worker. Brings the cached list for a category up to date from
+// only what changed on the server since its watermark. Returns false when a
+// full fetch is needed instead (no watermark, full sync due, or the server
+// can't answer the delta query). changed is false when the list is as cached.
+static bool syncCategoryMangaDelta(int categoryId, std::vector<Manga>& manga, bool& changed) {
+    LibraryCache& cache = LibraryCache::getInstance();
+    SuwayomiClient& client = SuwayomiClient::getInstance();
+    std::string serverUrl = client.getServerIdentity();
+
+    LibrarySyncWatermark since;
+    int64_t lastFullSync = 0;
+    if (!cache.loadCategorySyncState(categoryId, serverUrl, since, lastFullSync)) return false;
+    if (static_cast<int64_t>(std::time(nullptr)) - lastFullSync > FULL_LIBRARY_SYNC_INTERVAL_S) return false;
+    if (!cache.loadCategoryManga(categoryId, manga)) return false;
+
+    std::vector<int> knownIds;
+    knownIds.reserve(manga.size());
+    for (const auto& m : manga) knownIds.push_back(m.id);
+
+    CategoryMangaDelta delta;
+    if (!client.fetchCategoryMangaDelta(categoryId, since, knownIds, delta)) return false;
+
+    changed = !delta.changed.empty() || delta.memberIds.size() != knownIds.size();
+    if (changed && !cache.applyCategoryDelta(categoryId, delta, manga)) return false;
+    cache.saveCategorySyncState(categoryId, serverUrl, delta.watermark, lastFullSync);
+    return true;
+}
+
 LibrarySectionTab::LibrarySectionTab() {
     // Create alive flag for async callback safety
     m_alive = std::make_shared<bool>(true);
@@ -148,11 +184,46 @@ LibrarySectionTab::LibrarySectionTab() {
     buttonBox->setAlignItems(brls::AlignItems::FLEX_END);
     buttonBox->setShrink(0.0f);  // Don't shrink buttons
 
+    // Search button container (no controller shortcut, spacer keeps it aligned
+    // with the hinted buttons). Searches the on-device index, so it also works
+    // offline in downloads-only mode.
+    auto* searchContainer = new brls::Box();
+    searchContainer->setAxis(brls::Axis::COLUMN);
+    searchContainer->setAlignItems(brls::AlignItems::CENTER);
+    searchContainer->setMarginLeft(10);
+
+    auto* searchHintSpacer = new brls::Box();
+    searchHintSpacer->setWidth(16);
+    searchHintSpacer->setHeight(16);
+    searchHintSpacer->setMarginBottom(2);
+    searchContainer->addView(searchHintSpacer);
+
+    m_searchBtn = new brls::Button();
+    m_searchBtn->setWidth(44);
+    m_searchBtn->setHeight(40);
+    m_searchBtn->setCornerRadius(8);
+    m_searchBtn->setJustifyContent(brls::JustifyContent::CENTER);
+    m_searchBtn->setAlignItems(brls::AlignItems::CENTER);
+
+    auto* searchIcon = new brls::Image();
+    searchIcon->setWidth(24);
+    searchIcon->setHeight(24);
+    searchIcon->setScalingType(brls::ImageScalingType::FIT);
+    searchIcon->setImageFromFile(RESOURCE_PREFIX "icons/search.png");
+    m_searchBtn->addView(searchIcon);
+
+    m_searchBtn->registerClickAction([this](brls::View* view) {
+        showSearchDialog();
+        return true;
+    });
+    searchContainer->addView(m_searchBtn);
+    buttonBox->addView(searchContainer);
+
     // Sort button container with Y button hint
     auto* sortContainer = new brls::Box();
     sortContainer->setAxis(brls::Axis::COLUMN);
     sortContainer->setAlignItems(brls::AlignItems::CENTER);
-    sortContainer->setMarginLeft(10);
+    sortContainer->setMarginLeft(8);
 
     auto* sortHintIcon = new brls::Image();
     sortHintIcon->setWidth(16);
@@ -366,17 +437,14 @@ LibrarySectionTab::LibrarySectionTab() {
                 // Delay exit by ~2 seconds so user can re-select if they misclicked
                 int generation = ++m_selectionExitGeneration;
                 std::weak_ptr<bool> aliveWeak = m_alive;
-                asyncRun([this, generation, aliveWeak]() {
-                    std::this_thread::sleep_for(std::chrono::milliseconds(2000));
-                    brls::sync([this, generation, aliveWeak]() {
-                        auto alive = aliveWeak.lock();
-                        if (!alive || !*alive) return;
-                        // Only exit if no new selections happened since we scheduled this
-                        if (m_selectionMode && m_selectionExitGeneration == generation &&
-                            m_contentGrid && m_contentGrid->getSelectionCount() == 0) {
-                            exitSelectionMode();
-                        }
-                    });
+                TimerWheel::getInstance().schedule(2000, [this, generation, aliveWeak]() {
+                    auto alive = aliveWeak.lock();
+                    if (!alive || !*alive) return;
+                    // Only exit if no new selections happened since we scheduled this
+                    if (m_selectionMode && m_selectionExitGeneration == generation &&
+                        m_contentGrid && m_contentGrid->getSelectionCount() == 0) {
+                        exitSelectionMode();
+                    }
                 });
             } else {
                 // User selected something, cancel any pending auto-exit
@@ -501,6 +569,7 @@ LibrarySectionTab::~LibrarySectionTab() {
     if (m_alive) {
         *m_alive = false;
     }
+    stopUpdateSubscription();
     brls::Logger::debug("LibrarySectionTab: Destroyed");
 }
 
@@ -1178,6 +1247,9 @@ void LibrarySectionTab::loadCategories() {
             LibraryCache::getInstance().saveCategories(categories);
             if (usedCombinedQuery && !prefetchedManga.empty()) {
                 LibraryCache::getInstance().saveCategoryManga(resolvedCategoryId, prefetchedManga);
+                LibraryCache::getInstance().saveCategorySyncState(
+                    resolvedCategoryId, SuwayomiClient::getInstance().getServerIdentity(),
+                    LibrarySyncWatermark::fromManga(prefetchedManga), static_cast<int64_t>(std::time(nullptr)));
             }
 
             // Cross-cache: fetch all library manga and save as all-library cache
@@ -1504,6 +1576,7 @@ void LibrarySectionTab::createCategoryTabs() {
 }
 
 void LibrarySectionTab::selectCategory(int categoryId) {
+    clearSearch(false);
     m_currentCategoryId = categoryId;
 
     // Find category name and index
@@ -1644,88 +1717,97 @@ void LibrarySectionTab::loadCategoryManga(int categoryId) {
         return;
     }
 
-    asyncRun([this, categoryId, aliveWeak, cacheEnabled, isSameCategory]() {
-        SuwayomiClient& client = SuwayomiClient::getInstance();
-        std::vector<Manga> manga;
-
-        // Retry with exponential backoff (1s, 2s, 4s)
-        const int maxRetries = 3;
-        const int baseDelayMs = 1000;
-        bool success = false;
+    asyncRun([this, categoryId, aliveWeak, cacheEnabled]() {
+        fetchCategoryMangaAttempt(categoryId, 0, cacheEnabled, aliveWeak);
+    }, aliveWeak, TaskPriority::HIGH);
+}
 
-        for (int attempt = 0; attempt < maxRetries; attempt++) {
-            // Check if we're still alive before each attempt
-            auto alive = aliveWeak.lock();
-            if (!alive || !*alive) return;
+void LibrarySectionTab::fetchCategoryMangaAttempt(int categoryId, int attempt, bool cacheEnabled,
+                                                  std::weak_ptr<bool> aliveWeak) {
+    // Runs on a worker. Failed attempts are retried with exponential backoff
+    // (1s, 2s) through the timer wheel rather than sleeping on the worker.
+    const int maxAttempts = 3;
+    const int baseDelayMs = 1000;
 
-            // Skip retries if we've detected we're offline
-            if (attempt > 0 && !Application::getInstance().isConnected()) {
-                brls::Logger::info("LibrarySectionTab: Skipping retry, app is offline");
-                break;
-            }
+    {
+        auto alive = aliveWeak.lock();
+        if (!alive || !*alive) return;
+    }
 
-            if (attempt > 0) {
-                int delayMs = baseDelayMs * (1 << (attempt - 1));  // 1s, 2s, 4s
-                brls::Logger::info("LibrarySectionTab: Retry {} for category {} in {}ms",
-                                  attempt, categoryId, delayMs);
-                std::this_thread::sleep_for(std::chrono::milliseconds(delayMs));
-            }
+    // Delta sync against the cached list when possible, full fetch otherwise
+    std::vector<Manga> manga;
+    bool changed = true;
+    bool synced = cacheEnabled && syncCategoryMangaDelta(categoryId, manga, changed);
+    bool success = synced || SuwayomiClient::getInstance().fetchCategoryManga(categoryId, manga);
 
-            manga.clear();
-            success = client.fetchCategoryManga(categoryId, manga);
-            if (success) break;
+    if (!success && attempt + 1 < maxAttempts) {
+        // Skip retries if we've detected we're offline
+        if (Application::getInstance().isConnected()) {
+            int delayMs = baseDelayMs * (1 << attempt);
+            brls::Logger::info("LibrarySectionTab: Retry {} for category {} in {}ms",
+                              attempt + 1, categoryId, delayMs);
+            TimerWheel::getInstance().schedule(delayMs, [this, categoryId, attempt, cacheEnabled, aliveWeak]() {
+                fetchCategoryMangaAttempt(categoryId, attempt + 1, cacheEnabled, aliveWeak);
+            }, TimerDispatch::WORKER);
+            return;
         }
+        brls::Logger::info("LibrarySectionTab: Skipping retry, app is offline");
+    }
 
-        // If all retries failed, mark connection as lost
-        if (!success) {
-            Application::getInstance().setConnected(false);
-        }
+    // If all retries failed, mark connection as lost
+    if (!success) {
+        Application::getInstance().setConnected(false);
+    }
 
-        if (success) {
-            brls::Logger::info("LibrarySectionTab: Got {} manga for category {} from server",
-                              manga.size(), categoryId);
+    if (success) {
+        brls::Logger::info("LibrarySectionTab: Got {} manga for category {} from server ({})",
+                          manga.size(), categoryId, synced ? "delta" : "full");
 
-            // Save to cache if enabled
-            if (cacheEnabled) {
-                LibraryCache::getInstance().saveCategoryManga(categoryId, manga);
-            }
+        // Save to cache if enabled; a delta sync has already merged into it
+        if (cacheEnabled && !synced) {
+            LibraryCache& cache = LibraryCache::getInstance();
+            cache.saveCategoryManga(categoryId, manga);
+            cache.saveCategorySyncState(categoryId, SuwayomiClient::getInstance().getServerIdentity(),
+                                        LibrarySyncWatermark::fromManga(manga),
+                                        static_cast<int64_t>(std::time(nullptr)));
+        }
 
-            brls::sync([this, manga, categoryId, aliveWeak]() {
-                auto alive = aliveWeak.lock();
-                if (!alive || !*alive) {
-                    return;
-                }
+        brls::sync([this, manga, categoryId, changed, aliveWeak]() {
+            auto alive = aliveWeak.lock();
+            if (!alive || !*alive) {
+                return;
+            }
 
-                // Only update if we're still on the same category
-                if (m_currentCategoryId == categoryId) {
-                    // Use incremental update when grid already has data (from cache or combined query)
-                    // This avoids destroying and recreating 100+ cells on server refresh
-                    if (!m_cachedMangaList.empty()) {
-                        updateMangaCellsIncrementally(manga);
-                    } else {
-                        m_fullMangaList = manga;
-                        m_mangaList = manga;
-                        sortMangaList();
-                    }
+            // Only update if we're still on the same category, and skip the
+            // cell diff when the server reported nothing new
+            if (m_currentCategoryId == categoryId && (changed || m_cachedMangaList.empty())) {
+                // Use incremental update when grid already has data (from cache or combined query)
+                // This avoids destroying and recreating 100+ cells on server refresh
+                if (!m_cachedMangaList.empty()) {
+                    updateMangaCellsIncrementally(manga);
+                } else {
+                    m_fullMangaList = manga;
+                    m_mangaList = manga;
+                    sortMangaList();
                 }
-                m_loaded = true;
-            });
-        } else {
-            brls::Logger::error("LibrarySectionTab: Failed to load manga for category {} after {} retries",
-                               categoryId, maxRetries);
+            }
+            m_loaded = true;
+        });
+    } else {
+        brls::Logger::error("LibrarySectionTab: Failed to load manga for category {} after {} attempts",
+                           categoryId, attempt + 1);
 
-            brls::sync([this, aliveWeak]() {
-                auto alive = aliveWeak.lock();
-                if (!alive || !*alive) return;
+        brls::sync([this, aliveWeak]() {
+            auto alive = aliveWeak.lock();
+            if (!alive || !*alive) return;
 
-                // Only notify if we didn't have cached data
-                if (m_mangaList.empty()) {
-                    brls::Application::notify("Failed to load manga - check connection");
-                }
-                m_loaded = true;
-            });
-        }
-    });
+            // Only notify if we didn't have cached data
+            if (m_mangaList.empty()) {
+                brls::Application::notify("Failed to load manga - check connection");
+            }
+            m_loaded = true;
+        });
+    }
 }
 
 void LibrarySectionTab::onMangaSelected(const Manga& manga) {
@@ -1803,7 +1885,9 @@ void LibrarySectionTab::triggerLibraryUpdate() {
             if (generation != m_updatePollGeneration) return;
 
             if (success) {
-                // Start polling for progress
+                // Progress is pushed over the update-status subscription; poll
+                // only until it is live (or for good on servers without it)
+                startUpdateSubscription(generation);
                 pollUpdateProgress(generation);
             } else {
                 // Update failed - hide status and show error
@@ -1823,10 +1907,8 @@ void LibrarySectionTab::pollUpdateProgress(int generation) {
 
     std::weak_ptr<bool> aliveWeak = m_alive;
 
-    asyncRun([aliveWeak, generation, this]() {
-        // Small delay between polls to avoid hammering the server
-        std::this_thread::sleep_for(std::chrono::milliseconds(1500));
-
+    // Small delay between polls to avoid hammering the server
+    TimerWheel::getInstance().schedule(1500, [aliveWeak, generation, this]() {
         SuwayomiClient& client = SuwayomiClient::getInstance();
         int pending = 0, running = 0;
         bool isRunning = false;
@@ -1835,79 +1917,127 @@ void LibrarySectionTab::pollUpdateProgress(int generation) {
         brls::sync([aliveWeak, generation, gotStatus, pending, running, isRunning, this]() {
             auto alive = aliveWeak.lock();
             if (!alive || !*alive) return;
-            if (generation != m_updatePollGeneration) return;
+            if (generation != m_updatePollGeneration || !m_isUpdating) return;
 
-            if (!gotStatus) {
-                // Couldn't fetch status - stop polling, hide label
-                m_isUpdating = false;
-                if (m_updateStatusLabel) {
-                    m_updateStatusLabel->setVisibility(brls::Visibility::GONE);
-                }
-                return;
+            // Continue polling unless finished or the subscription took over
+            if (applyUpdateProgress(generation, gotStatus, pending, running, isRunning) &&
+                !m_updateSubscriptionLive) {
+                pollUpdateProgress(generation);
             }
+        });
+    }, TimerDispatch::WORKER);
+}
 
-            if (!isRunning) {
-                // Update finished
-                m_isUpdating = false;
-                if (m_updateStatusLabel) {
-                    m_updateStatusLabel->setText("Updated!");
-                    // Hide after a short moment via next poll cycle
-                    // Use a delayed sync to hide it
-                }
+bool LibrarySectionTab::applyUpdateProgress(int generation, bool gotStatus, int pending, int running,
+                                            bool isRunning) {
+    if (!gotStatus) {
+        // Couldn't fetch status - stop polling, hide label
+        m_isUpdating = false;
+        stopUpdateSubscription();
+        if (m_updateStatusLabel) {
+            m_updateStatusLabel->setVisibility(brls::Visibility::GONE);
+        }
+        return false;
+    }
 
-                // Reload current view to show updated data
-                if (m_groupMode == LibraryGroupMode::BY_CATEGORY) {
-                    loadCategoryManga(m_currentCategoryId);
-                } else if (m_groupMode == LibraryGroupMode::NO_GROUPING) {
-                    loadAllManga();
-                } else if (m_groupMode == LibraryGroupMode::BY_SOURCE) {
-                    loadBySource();
-                }
+    if (!isRunning) {
+        // Update finished
+        m_isUpdating = false;
+        stopUpdateSubscription();
+        if (m_updateStatusLabel) {
+            m_updateStatusLabel->setText("Updated!");
+            // Hide after a short moment via next poll cycle
+            // Use a delayed sync to hide it
+        }
 
-                // Hide the "Updated!" text after 2 seconds
-                std::weak_ptr<bool> hideAlive = m_alive;
-                int hideGen = generation;
-                asyncRun([hideAlive, hideGen, this]() {
-                    std::this_thread::sleep_for(std::chrono::seconds(2));
-                    brls::sync([hideAlive, hideGen, this]() {
-                        auto alive2 = hideAlive.lock();
-                        if (!alive2 || !*alive2) return;
-                        if (hideGen != m_updatePollGeneration) return;
-                        if (m_updateStatusLabel) {
-                            m_updateStatusLabel->setVisibility(brls::Visibility::GONE);
-                        }
-                    });
-                });
-                return;
-            }
+        // Reload current view to show updated data
+        if (m_groupMode == LibraryGroupMode::BY_CATEGORY) {
+            loadCategoryManga(m_currentCategoryId);
+        } else if (m_groupMode == LibraryGroupMode::NO_GROUPING) {
+            loadAllManga();
+        } else if (m_groupMode == LibraryGroupMode::BY_SOURCE) {
+            loadBySource();
+        }
 
-            // Update is still running - calculate progress
-            int totalActive = pending + running;
-            if (m_updateTotalJobs == 0 && totalActive > 0) {
-                // First poll - capture total
-                m_updateTotalJobs = totalActive;
+        // Hide the "Updated!" text after 2 seconds
+        std::weak_ptr<bool> hideAlive = m_alive;
+        int hideGen = generation;
+        TimerWheel::getInstance().schedule(2000, [hideAlive, hideGen, this]() {
+            auto alive2 = hideAlive.lock();
+            if (!alive2 || !*alive2) return;
+            if (hideGen != m_updatePollGeneration) return;
+            if (m_updateStatusLabel) {
+                m_updateStatusLabel->setVisibility(brls::Visibility::GONE);
             }
+        });
+        return false;
+    }
 
-            if (m_updateTotalJobs > 0) {
-                int completed = m_updateTotalJobs - totalActive;
-                if (completed < 0) completed = 0;
-                int percent = (completed * 100) / m_updateTotalJobs;
-                if (percent > 100) percent = 100;
+    // Update is still running - calculate progress
+    int totalActive = pending + running;
+    if (m_updateTotalJobs == 0 && totalActive > 0) {
+        // First poll - capture total
+        m_updateTotalJobs = totalActive;
+    }
 
-                std::string statusText = "Updating " + std::to_string(percent) + "%";
-                if (m_updateStatusLabel) {
-                    m_updateStatusLabel->setText(statusText);
-                }
-            } else {
-                if (m_updateStatusLabel) {
-                    m_updateStatusLabel->setText("Updating...");
-                }
-            }
+    if (m_updateTotalJobs > 0) {
+        int completed = m_updateTotalJobs - totalActive;
+        if (completed < 0) completed = 0;
+        int percent = (completed * 100) / m_updateTotalJobs;
+        if (percent > 100) percent = 100;
+
+        std::string statusText = "Updating " + std::to_string(percent) + "%";
+        if (m_updateStatusLabel) {
+            m_updateStatusLabel->setText(statusText);
+        }
+    } else {
+        if (m_updateStatusLabel) {
+            m_updateStatusLabel->setText("Updating...");
+        }
+    }
+
+    return true;
+}
+
+void LibrarySectionTab::startUpdateSubscription(int generation) {
+    stopUpdateSubscription();
 
-            // Continue polling
-            pollUpdateProgress(generation);
+    std::weak_ptr<bool> aliveWeak = m_alive;
+    m_updateSubscriptionId = SubscriptionClient::getInstance().subscribe(
+        SuwayomiClient::getUpdateStatusSubscription(),
+        [aliveWeak, generation, this](const std::string& message) {
+            int pending = 0, running = 0;
+            bool isRunning = false;
+            if (!SuwayomiClient::getInstance().parseUpdateStatus(message, pending, running, isRunning)) return;
+
+            brls::sync([aliveWeak, generation, pending, running, isRunning, this]() {
+                auto alive = aliveWeak.lock();
+                if (!alive || !*alive) return;
+                if (generation != m_updatePollGeneration || !m_isUpdating) return;
+                applyUpdateProgress(generation, true, pending, running, isRunning);
+            });
+        },
+        [aliveWeak, generation, this](bool live) {
+            brls::sync([aliveWeak, generation, live, this]() {
+                auto alive = aliveWeak.lock();
+                if (!alive || !*alive) return;
+                if (generation != m_updatePollGeneration) return;
+                bool wasLive = m_updateSubscriptionLive;
+                m_updateSubscriptionLive = live;
+                // Connection dropped mid-update: resume polling until it returns
+                if (wasLive && !live && m_isUpdating) {
+                    pollUpdateProgress(generation);
+                }
+            });
         });
-    });
+}
+
+void LibrarySectionTab::stopUpdateSubscription() {
+    if (m_updateSubscriptionId >= 0) {
+        SubscriptionClient::getInstance().unsubscribe(m_updateSubscriptionId);
+        m_updateSubscriptionId = -1;
+    }
+    m_updateSubscriptionLive = false;
 }
 
 void LibrarySectionTab::sortMangaList() {
@@ -1943,6 +2073,18 @@ void LibrarySectionTab::sortMangaList() {
         m_mangaList = m_fullMangaList;
     }
 
+    // Keep the offline search index in step with whatever list was just loaded
+    // (server or LibraryCache), off the UI thread. While a query is active the
+    // filter below runs on the index as it is and again once new entries land.
+    if (!m_fullMangaList.empty()) {
+        std::weak_ptr<bool> aliveWeak = m_alive;
+        LibrarySearchIndex::getInstance().updateAsync(m_fullMangaList, [this, aliveWeak]() {
+            auto alive = aliveWeak.lock();
+            if (!alive || !*alive || m_searchQuery.empty()) return;
+            sortMangaList();
+        });
+    }
+
     // Track if we're filtering items (which changes the list size)
     size_t originalSize = m_mangaList.size();
     bool isFilterOperation = false;
@@ -2057,6 +2199,22 @@ void LibrarySectionTab::sortMangaList() {
             break;
     }
 
+    // Active search: keep only matches, ordered by relevance instead of sort mode
+    if (!m_searchQuery.empty()) {
+        auto results = LibrarySearchIndex::getInstance().search(m_searchQuery);
+        std::map<int, size_t> rankById;
+        for (size_t i = 0; i < results.size(); i++) {
+            rankById[results[i].mangaId] = i;
+        }
+        m_mangaList.erase(
+            std::remove_if(m_mangaList.begin(), m_mangaList.end(),
+                [&rankById](const Manga& m) { return rankById.find(m.id) == rankById.end(); }),
+            m_mangaList.end());
+        std::stable_sort(m_mangaList.begin(), m_mangaList.end(),
+            [&rankById](const Manga& a, const Manga& b) { return rankById[a.id] < rankById[b.id]; });
+        isFilterOperation = true;
+    }
+
     // Update grid display
     if (m_contentGrid) {
         // Use in-place update for pure reordering (no items removed)
@@ -2120,6 +2278,35 @@ void LibrarySectionTab::sortMangaList() {
     }
 }
 
+void LibrarySectionTab::showSearchDialog() {
+    brls::Application::getImeManager()->openForText([this](std::string text) {
+        if (text.empty()) {
+            clearSearch(true);
+            return;
+        }
+
+        if (m_searchQuery.empty() && m_titleLabel) {
+            m_titleBeforeSearch = m_titleLabel->getFullText();
+        }
+        m_searchQuery = text;
+        if (m_titleLabel) {
+            m_titleLabel->setText(m_titleBeforeSearch + " - Search: " + text);
+        }
+        m_focusGridAfterLoad = true;
+        sortMangaList();
+    }, "Search Library", "Title, author, artist, genre or description (empty to clear)", 128, m_searchQuery);
+}
+
+void LibrarySectionTab::clearSearch(bool refilter) {
+    if (m_searchQuery.empty()) return;
+    m_searchQuery.clear();
+    if (m_titleLabel && !m_titleBeforeSearch.empty()) {
+        m_titleLabel->setText(m_titleBeforeSearch);
+    }
+    m_titleBeforeSearch.clear();
+    if (refilter) sortMangaList();
+}
+
 void LibrarySectionTab::cycleSortMode() {
     // Cycle through sort modes
     switch (m_sortMode) {
@@ -4012,6 +4199,7 @@ void LibrarySectionTab::openTracking(const Manga& manga) {
 }
 
 void LibrarySectionTab::setGroupMode(LibraryGroupMode mode) {
+    clearSearch(false);
     m_groupMode = mode;
     Application::getInstance().getSettings().libraryGroupMode = mode;
     Application::getInstance().saveSettings();
@@ -4507,6 +4695,7 @@ void LibrarySectionTab::createSourceTabs() {
 }
 
 void LibrarySectionTab::selectSource(const std::string& sourceName) {
+    clearSearch(false);
     m_currentSourceName = sourceName;
 
     // Find the index and update selected state
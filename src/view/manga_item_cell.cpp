@@ -1,5 +1,6 @@
 #include "view/manga_item_cell.hpp"
 #include "utils/image_loader.hpp"
+#include "utils/texture_residency.hpp"
 #include "app/suwayomi_client.hpp"
 
 namespace vitasuwayomi {
@@ -14,10 +15,17 @@ MangaItemCell::~MangaItemCell() {
     if (m_alive) {
         *m_alive = false;
     }
-    if (m_nvgCover != 0) {
-        NVGcontext* vg = brls::Application::getNVGContext();
-        if (vg) nvgDeleteImage(vg, m_nvgCover);
-    }
+    releaseCover();
+}
+
+void MangaItemCell::releaseCover() {
+    if (m_nvgCover == 0) return;
+    TextureResidency::getInstance().untrack(this);
+    NVGcontext* vg = brls::Application::getNVGContext();
+    if (vg) nvgDeleteImage(vg, m_nvgCover);
+    m_nvgCover = 0;
+    m_coverW = 0;
+    m_coverH = 0;
 }
 
 void MangaItemCell::setManga(const Manga& manga) {
@@ -38,13 +46,8 @@ void MangaItemCell::updateMangaData(const Manga& manga) {
         m_titleCached = false;
     }
     if (coverChanged) {
-        if (m_nvgCover != 0) {
-            NVGcontext* vg = brls::Application::getNVGContext();
-            if (vg) nvgDeleteImage(vg, m_nvgCover);
-            m_nvgCover = 0;
-            m_coverW = 0;
-            m_coverH = 0;
-        }
+        releaseCover();
+        m_coverEvicted = false;
         m_thumbnailLoaded = false;
     }
     if (unreadChanged) {
@@ -78,6 +81,7 @@ void MangaItemCell::loadThumbnailIfNeeded() {
     if (m_thumbnailLoaded) return;
     if (m_manga.id <= 0 && m_manga.thumbnailUrl.empty()) return;
     m_thumbnailLoaded = true;
+    m_coverEvicted = false;
 
     SuwayomiClient& client = SuwayomiClient::getInstance();
     std::string url;
@@ -107,13 +111,34 @@ void MangaItemCell::loadThumbnailIfNeeded() {
                 if (vg && nvgImg != 0) nvgDeleteImage(vg, nvgImg);
                 return;
             }
+            // A reload replaces the cover that was kept visible meanwhile
+            if (self->m_nvgCover != nvgImg) self->releaseCover();
             self->m_nvgCover = nvgImg;
             self->m_coverW = w;
             self->m_coverH = h;
+            TextureResidency::getInstance().track(self, static_cast<size_t>(w) * h * 4, [self]() {
+                // Already untracked; the next draw of this cell reloads it
+                NVGcontext* vg = brls::Application::getNVGContext();
+                if (vg) nvgDeleteImage(vg, self->m_nvgCover);
+                self->m_nvgCover = 0;
+                self->m_coverW = 0;
+                self->m_coverH = 0;
+                self->m_coverEvicted = true;
+                self->m_thumbnailLoaded = false;
+            });
         },
         m_alive);
 }
 
+int MangaItemCell::getCoverImageForDraw() {
+    if (m_nvgCover != 0) {
+        TextureResidency::getInstance().touch(this);
+    } else if (m_coverEvicted) {
+        loadThumbnailIfNeeded();
+    }
+    return m_nvgCover;
+}
+
 void MangaItemCell::resetThumbnailLoadState() {
     m_thumbnailLoaded = false;
 }
@@ -696,8 +696,8 @@ void RecyclingGrid::resetThumbnailLoadStates() {
 
 void RecyclingGrid::draw(NVGcontext* vg, float x, float y, float width, float height, brls::Style style, brls::FrameContext* ctx) {
     auto& perf = PerfOverlay::getInstance();
-    perf.endFrame();   // End previous frame timing
-    perf.beginFrame(); // Start this frame timing
+    perf.endFrame(PerfScreen::GRID);   // End previous frame timing
+    perf.beginFrame(PerfScreen::GRID); // Start this frame timing
 
     // Visibility culling: hide off-screen rows so ScrollingFrame::draw() skips them.
     // Without this, ALL rows (including off-screen) get full NanoVG draw calls issued,
@@ -785,7 +785,7 @@ void RecyclingGrid::draw(NVGcontext* vg, float x, float y, float width, float he
 
             float coverH = ch - titleAreaH;
 
-            int nvgImg = cell->getCoverImage();
+            int nvgImg = cell->getCoverImageForDraw();
             if (nvgImg != 0) {
                 float imgW = static_cast<float>(cell->getCoverWidth());
                 float imgH = static_cast<float>(cell->getCoverHeight());
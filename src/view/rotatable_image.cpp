@@ -5,7 +5,12 @@
 
 #include "view/rotatable_image.hpp"
 #include "utils/perf_overlay.hpp"
+#include "utils/texture_residency.hpp"
+#include "utils/perf_trace.hpp"
 #include <cmath>
+#include <cstring>
+#include <algorithm>
+#include <unordered_map>
 
 #ifndef NVG_PI
 #define NVG_PI 3.14159265358979323846264338327f
@@ -13,6 +18,35 @@
 
 namespace vitasuwayomi {
 
+// Images with tiles waiting for upload. Main thread only; entries are
+// removed in clearImage() (and therefore the destructor) so the pump in
+// uploadPendingTiles() never sees a dangling pointer.
+static std::vector<RotatableImage*> s_tileStreamingImages;
+
+// Scratch buffer reused for building per-tile TGAs (main thread only)
+static std::vector<uint8_t> s_tileScratch;
+
+// Images still receiving segments from a streaming decode, by stream ID.
+// Main thread only; entries go away in clearImage() like the list above.
+static std::unordered_map<uint64_t, RotatableImage*> s_openStreams;
+
+static void unregisterTileStreaming(RotatableImage* img) {
+    auto it = std::find(s_tileStreamingImages.begin(), s_tileStreamingImages.end(), img);
+    if (it != s_tileStreamingImages.end()) s_tileStreamingImages.erase(it);
+}
+
+// Read width/height of an uncompressed 32-bit top-left-origin TGA (the
+// layout writeTGAHeader produces). Returns false for anything else, since
+// other layouts can't be cut into row ranges without a flip.
+static bool readTileableTGA(const std::vector<uint8_t>& data, int& width, int& height) {
+    if (data.size() < 18) return false;
+    if (data[1] != 0 || data[2] != 2 || data[16] != 32 || !(data[17] & 0x20)) return false;
+    width = data[12] | (data[13] << 8);
+    height = data[14] | (data[15] << 8);
+    if (width <= 0 || height <= 0) return false;
+    return data.size() >= 18 + static_cast<size_t>(data[0]) + static_cast<size_t>(width) * height * 4;
+}
+
 RotatableImage::RotatableImage() {
     // Set default properties
     this->setFocusable(false);
@@ -31,19 +65,45 @@ void RotatableImage::clearImage() {
     }
     m_nvgImage = 0;
 
-    // Clear segments
+    // Clear segment tiles (and any that were still waiting for upload)
     if (vg) {
-        for (int handle : m_segmentNvgImages) {
-            if (handle != 0) nvgDeleteImage(vg, handle);
+        for (const Tile& tile : m_tiles) {
+            if (tile.nvgImage != 0) nvgDeleteImage(vg, tile.nvgImage);
         }
     }
-    m_segmentNvgImages.clear();
-    m_segmentSrcHeights.clear();
+    m_tiles.clear();
+    m_segmentData.clear();
+    m_segmentTilesLeft.clear();
+    closeStream();
+    if (m_pendingTiles > 0) unregisterTileStreaming(this);
+    m_pendingTiles = 0;
+    m_visiblePendingTile = -1;
     m_origWidth = 0;
     m_origHeight = 0;
 
     m_imageWidth = 0;
     m_imageHeight = 0;
+
+    if (m_residentBytes > 0) {
+        TextureResidency::getInstance().untrack(this);
+        m_residentBytes = 0;
+    }
+}
+
+void RotatableImage::addResidentBytes(size_t bytes) {
+    if (bytes == 0) return;
+    m_residentBytes += bytes;
+    // Evicted pages reload through their owner's hasImage() checks
+    RotatableImage* self = this;
+    TextureResidency::getInstance().track(this, m_residentBytes, [self]() {
+        self->m_residentBytes = 0;
+        self->clearImage();
+        self->invalidate();
+    });
+}
+
+void RotatableImage::touchResidency() {
+    if (m_residentBytes > 0) TextureResidency::getInstance().touchPrefetched(this);
 }
 
 void RotatableImage::setImageFromMem(const unsigned char* data, size_t size) {
@@ -61,6 +121,7 @@ void RotatableImage::setImageFromMem(const unsigned char* data, size_t size) {
     if (m_nvgImage != 0) {
         // Get image dimensions
         nvgImageSize(vg, m_nvgImage, &m_imageWidth, &m_imageHeight);
+        addResidentBytes(static_cast<size_t>(m_imageWidth) * m_imageHeight * 4);
         brls::Logger::debug("RotatableImage: Loaded image {}x{}", m_imageWidth, m_imageHeight);
     } else {
         brls::Logger::error("RotatableImage: Failed to create NVG image");
@@ -69,6 +130,31 @@ void RotatableImage::setImageFromMem(const unsigned char* data, size_t size) {
     this->invalidate();
 }
 
+void RotatableImage::setImageFromBuffer(std::vector<uint8_t>&& data) {
+    int w = 0, h = 0;
+    if (readTileableTGA(data, w, h) && h > TILE_ROWS) {
+        std::vector<std::vector<uint8_t>> segments;
+        segments.push_back(std::move(data));
+        setImageSegments(std::move(segments), w, h, {h});
+        return;
+    }
+    setImageFromMem(data.data(), data.size());
+}
+
+void RotatableImage::setImageFromBuffer(SharedBuffer data) {
+    if (!data) return;
+    int w = 0, h = 0;
+    if (readTileableTGA(*data, w, h) && h > TILE_ROWS) {
+        clearImage();
+        m_origWidth = m_imageWidth = w;
+        m_origHeight = m_imageHeight = h;
+        addSegmentTiles({std::move(data)}, {h});
+        this->invalidate();
+        return;
+    }
+    setImageFromMem(data->data(), data->size());
+}
+
 void RotatableImage::setImageFromFile(const std::string& path) {
     NVGcontext* vg = brls::Application::getNVGContext();
     if (!vg || path.empty()) {
@@ -83,6 +169,7 @@ void RotatableImage::setImageFromFile(const std::string& path) {
 
     if (m_nvgImage != 0) {
         nvgImageSize(vg, m_nvgImage, &m_imageWidth, &m_imageHeight);
+        addResidentBytes(static_cast<size_t>(m_imageWidth) * m_imageHeight * 4);
         brls::Logger::debug("RotatableImage: Loaded image from file {}x{}", m_imageWidth, m_imageHeight);
     } else {
         brls::Logger::error("RotatableImage: Failed to load image from {}", path);
@@ -91,42 +178,205 @@ void RotatableImage::setImageFromFile(const std::string& path) {
     this->invalidate();
 }
 
-void RotatableImage::setImageSegments(const std::vector<std::vector<uint8_t>>& segments,
+void RotatableImage::setImageSegments(std::vector<std::vector<uint8_t>> segments,
                                        int origWidth, int origHeight,
-                                       const std::vector<int>& segmentSrcHeights) {
-    NVGcontext* vg = brls::Application::getNVGContext();
-    if (!vg || segments.empty() || origWidth <= 0 || origHeight <= 0) return;
+                                       const std::vector<int>& segmentSrcHeights,
+                                       uint64_t streamId) {
+    if (segments.empty() || origWidth <= 0 || origHeight <= 0) return;
+    if (segmentSrcHeights.size() != segments.size()) return;
 
     // Clear any existing image/segments
     clearImage();
 
-    for (const auto& segData : segments) {
-        int nvgImg = nvgCreateImageMem(vg, 0, const_cast<unsigned char*>(segData.data()), segData.size());
-        if (nvgImg == 0) {
-            brls::Logger::error("RotatableImage: Failed to create segment NVG image");
-            // Clean up on failure
-            for (int handle : m_segmentNvgImages) {
-                nvgDeleteImage(vg, handle);
-            }
-            m_segmentNvgImages.clear();
-            m_segmentSrcHeights.clear();
-            return;
-        }
-        m_segmentNvgImages.push_back(nvgImg);
-    }
-
-    m_segmentSrcHeights = segmentSrcHeights;
     m_origWidth = origWidth;
     m_origHeight = origHeight;
     // Set m_imageWidth/Height to original dims for calculateImageBounds compatibility
     m_imageWidth = origWidth;
     m_imageHeight = origHeight;
 
-    brls::Logger::info("RotatableImage: Loaded {} segments for {}x{} image",
-                       m_segmentNvgImages.size(), origWidth, origHeight);
+    addSegmentTiles(segments, segmentSrcHeights);
+
+    if (streamId != 0) {
+        m_streamId = streamId;
+        s_openStreams[streamId] = this;
+    }
+
+    brls::Logger::info("RotatableImage: {} segments -> {} tiles for {}x{} image{}",
+                       m_segmentData.size(), m_tiles.size(), origWidth, origHeight,
+                       streamId != 0 ? " (streaming)" : "");
     this->invalidate();
 }
 
+void RotatableImage::appendStreamSegments(uint64_t streamId, std::vector<std::vector<uint8_t>> segments,
+                                          const std::vector<int>& segmentSrcHeights, bool last) {
+    auto it = s_openStreams.find(streamId);
+    if (it == s_openStreams.end()) return;
+    RotatableImage* img = it->second;
+
+    if (segmentSrcHeights.size() == segments.size()) {
+        img->addSegmentTiles(segments, segmentSrcHeights);
+    }
+    if (last) img->closeStream();
+    img->invalidate();
+}
+
+void RotatableImage::closeStream() {
+    if (m_streamId == 0) return;
+    s_openStreams.erase(m_streamId);
+    m_streamId = 0;
+}
+
+void RotatableImage::addSegmentTiles(std::vector<std::vector<uint8_t>>& segments,
+                                     const std::vector<int>& segmentSrcHeights) {
+    std::vector<SharedBuffer> shared;
+    shared.reserve(segments.size());
+    for (auto& segment : segments) {
+        shared.push_back(std::make_shared<const std::vector<uint8_t>>(std::move(segment)));
+    }
+    addSegmentTiles(std::move(shared), segmentSrcHeights);
+}
+
+void RotatableImage::addSegmentTiles(std::vector<SharedBuffer> segments,
+                                     const std::vector<int>& segmentSrcHeights) {
+    bool wasRegistered = m_pendingTiles > 0;
+
+    // Cut every segment into TILE_ROWS-row tiles. Only the row ranges are
+    // recorded here; the GPU upload happens later in uploadPendingTiles().
+    for (size_t s = 0; s < segments.size(); s++) {
+        int segIndex = static_cast<int>(m_segmentData.size());
+        int segW = 0, segH = 0;
+        int tilesInSegment = 0;
+        if (readTileableTGA(*segments[s], segW, segH)) {
+            for (int row = 0; row < segH; row += TILE_ROWS) {
+                Tile tile;
+                tile.segment = segIndex;
+                tile.rowStart = row;
+                tile.rows = std::min(TILE_ROWS, segH - row);
+                tile.srcHeight = (float)segmentSrcHeights[s] * tile.rows / segH;
+                m_tiles.push_back(tile);
+                tilesInSegment++;
+            }
+        } else {
+            // Not a TGA we can cut: upload the whole segment as one tile
+            Tile tile;
+            tile.segment = segIndex;
+            tile.srcHeight = (float)segmentSrcHeights[s];
+            m_tiles.push_back(tile);
+            tilesInSegment = 1;
+        }
+        m_segmentTilesLeft.push_back(tilesInSegment);
+        m_segmentData.push_back(std::move(segments[s]));
+        m_pendingTiles += tilesInSegment;
+    }
+
+    if (!wasRegistered && m_pendingTiles > 0) s_tileStreamingImages.push_back(this);
+}
+
+bool RotatableImage::uploadTile(size_t index) {
+    NVGcontext* vg = brls::Application::getNVGContext();
+    if (!vg || index >= m_tiles.size() || m_tiles[index].uploaded) return false;
+
+    // Make room before binding any references: eviction callbacks clear
+    // other images' tiles and segments (never this one's)
+    {
+        const Tile& pending = m_tiles[index];
+        const std::vector<uint8_t>& header = *m_segmentData[pending.segment];
+        int segW = header[12] | (header[13] << 8);
+        int rows = pending.rows > 0 ? pending.rows : (header[14] | (header[15] << 8));
+        TextureResidency::getInstance().reserve(static_cast<size_t>(segW) * rows * 4, this);
+    }
+    if (index >= m_tiles.size() || m_tiles[index].uploaded) return false;
+
+    Tile& tile = m_tiles[index];
+    const std::vector<uint8_t>& seg = *m_segmentData[tile.segment];
+    size_t tileBytes = 0;
+    if (tile.rows > 0) {
+        // Build a standalone TGA for this row range: header + contiguous rows
+        int segW = seg[12] | (seg[13] << 8);
+        size_t rowBytes = static_cast<size_t>(segW) * 4;
+        tileBytes = rowBytes * tile.rows;
+        size_t pixelOffset = 18 + seg[0] + rowBytes * tile.rowStart;
+        s_tileScratch.resize(18 + rowBytes * tile.rows);
+        memcpy(s_tileScratch.data(), seg.data(), 18);
+        s_tileScratch[0] = 0;  // Drop image ID field
+        s_tileScratch[14] = tile.rows & 0xFF;
+        s_tileScratch[15] = (tile.rows >> 8) & 0xFF;
+        memcpy(s_tileScratch.data() + 18, seg.data() + pixelOffset, rowBytes * tile.rows);
+        tile.nvgImage = nvgCreateImageMem(vg, 0, s_tileScratch.data(), s_tileScratch.size());
+    } else {
+        // NanoVG only reads the buffer; the const is the page ring's
+        tile.nvgImage = nvgCreateImageMem(vg, 0, const_cast<unsigned char*>(seg.data()), seg.size());
+        int w = 0, h = 0;
+        if (tile.nvgImage != 0) nvgImageSize(vg, tile.nvgImage, &w, &h);
+        tileBytes = static_cast<size_t>(w) * h * 4;
+    }
+    tile.uploaded = true;
+    if (tile.nvgImage == 0) {
+        brls::Logger::error("RotatableImage: Failed to create tile NVG image ({}/{})",
+                            index + 1, m_tiles.size());
+    } else {
+        // Also refreshes recency, so a page still uploading isn't evicted
+        addResidentBytes(tileBytes);
+    }
+
+    // Release the segment's TGA as soon as its last tile is on the GPU
+    if (--m_segmentTilesLeft[tile.segment] == 0) {
+        m_segmentData[tile.segment].reset();
+    }
+    if (--m_pendingTiles == 0) {
+        unregisterTileStreaming(this);
+        // An open stream still indexes segments after these
+        if (m_streamId == 0) m_segmentData.clear();
+    }
+    if (m_visiblePendingTile == static_cast<int>(index)) m_visiblePendingTile = -1;
+
+    this->invalidate();
+    return true;
+}
+
+int RotatableImage::nextPendingTile() const {
+    if (m_visiblePendingTile >= 0) return m_visiblePendingTile;
+    for (size_t i = 0; i < m_tiles.size(); i++) {
+        if (!m_tiles[i].uploaded) return static_cast<int>(i);
+    }
+    return -1;
+}
+
+int RotatableImage::uploadPendingTiles(int maxUploads) {
+    PERF_TRACE_SCOPE("tile_upload");
+    int uploaded = 0;
+
+    // Pass 1: tiles that were on screen last frame, so the user never waits
+    // on a tile below the fold while looking at a placeholder
+    for (size_t i = 0; i < s_tileStreamingImages.size() && uploaded < maxUploads; ) {
+        RotatableImage* img = s_tileStreamingImages[i];
+        int tile = img->m_visiblePendingTile;
+        img->m_visiblePendingTile = -1;
+        if (tile >= 0 && img->uploadTile(tile)) uploaded++;
+        // uploadTile may have unregistered img; only advance if it's still here
+        if (i < s_tileStreamingImages.size() && s_tileStreamingImages[i] == img) i++;
+    }
+
+    // Pass 2: remaining tiles in registration (load) order, top to bottom
+    while (uploaded < maxUploads && !s_tileStreamingImages.empty()) {
+        RotatableImage* img = s_tileStreamingImages.front();
+        int tile = img->nextPendingTile();
+        if (tile < 0 || !img->uploadTile(tile)) {
+            unregisterTileStreaming(img);  // Nothing left (shouldn't happen)
+            continue;
+        }
+        uploaded++;
+    }
+
+    // Visibility is re-recorded by the next draw
+    for (RotatableImage* img : s_tileStreamingImages) img->m_visiblePendingTile = -1;
+    return uploaded;
+}
+
+bool RotatableImage::hasPendingTiles() {
+    return !s_tileStreamingImages.empty();
+}
+
 void RotatableImage::calculateImageBounds(float viewX, float viewY, float viewW, float viewH,
                                           float& imgX, float& imgY, float& imgW, float& imgH) {
     if (m_imageWidth <= 0 || m_imageHeight <= 0) {
@@ -194,8 +444,8 @@ void RotatableImage::draw(NVGcontext* vg, float x, float y, float width, float h
                           brls::Style style, brls::FrameContext* ctx) {
     if (m_perfPrimary) {
         auto& perf = PerfOverlay::getInstance();
-        perf.endFrame();
-        perf.beginFrame();
+        perf.endFrame(PerfScreen::READER);
+        perf.beginFrame(PerfScreen::READER);
     }
     PERF_BEGIN("reader_draw");
 
@@ -235,7 +485,7 @@ void RotatableImage::draw(NVGcontext* vg, float x, float y, float width, float h
     nvgFill(vg);
 
     // If no image at all, just show background
-    if (m_nvgImage == 0 && m_segmentNvgImages.empty()) {
+    if (m_nvgImage == 0 && m_tiles.empty()) {
         nvgRestore(vg);
         return;
     }
@@ -243,14 +493,26 @@ void RotatableImage::draw(NVGcontext* vg, float x, float y, float width, float h
         nvgRestore(vg);
         return;
     }
+    if (m_residentBytes > 0) TextureResidency::getInstance().touch(this);
 
     // Segmented image drawing (tall images auto-split for GPU texture limit)
-    if (!m_segmentNvgImages.empty() && m_origHeight > 0) {
+    if (!m_tiles.empty() && m_origHeight > 0) {
         float imgX, imgY, imgW, imgH;
         calculateImageBounds(x, y, width, height, imgX, imgY, imgW, imgH);
 
         bool isRotated90or270 = (m_rotationDegrees == 90.0f || m_rotationDegrees == 270.0f);
         bool hasRotation = (m_rotationDegrees != 0.0f);
+        bool hasZoom = (m_zoomLevel != 1.0f);
+
+        // Apply zoom transform (same as the single-texture path)
+        if (hasZoom) {
+            float centerX = imgX + imgW / 2.0f;
+            float centerY = imgY + imgH / 2.0f;
+            nvgTranslate(vg, centerX, centerY);
+            nvgScale(vg, m_zoomLevel, m_zoomLevel);
+            nvgTranslate(vg, m_zoomOffset.x, m_zoomOffset.y);
+            nvgTranslate(vg, -centerX, -centerY);
+        }
 
         // Determine drawing space: for rotated images, apply rotation transform
         // and draw segments in pre-rotation coordinates
@@ -280,20 +542,43 @@ void RotatableImage::draw(NVGcontext* vg, float x, float y, float width, float h
             drawH = imgH;
         }
 
-        // Draw segments stacked vertically in (possibly pre-rotation) space
+        // On-screen test for upload priority only works in untransformed
+        // space; with rotation/zoom pending tiles just upload top to bottom.
+        bool canTestVisibility = !hasRotation && !hasZoom && !hasSlide;
+        float screenH = brls::Application::contentHeight;
+        NVGcolor placeholder = nvgLerpRGBA(m_bgColor, nvgRGB(128, 128, 128), 0.12f);
+
+        // Draw tiles stacked vertically in (possibly pre-rotation) space
         float yPos = drawY;
-        for (size_t i = 0; i < m_segmentNvgImages.size(); i++) {
-            float segFraction = (float)m_segmentSrcHeights[i] / (float)m_origHeight;
-            float segDisplayH = drawH * segFraction;
+        for (size_t i = 0; i < m_tiles.size(); i++) {
+            const Tile& tile = m_tiles[i];
+            float tileDisplayH = drawH * (tile.srcHeight / (float)m_origHeight);
 
-            NVGpaint paint = nvgImagePattern(vg, drawX, yPos, drawW, segDisplayH,
-                                              0, m_segmentNvgImages[i], 1.0f);
             nvgBeginPath(vg);
-            nvgRect(vg, drawX, yPos, drawW, segDisplayH);
-            nvgFillPaint(vg, paint);
+            nvgRect(vg, drawX, yPos, drawW, tileDisplayH);
+            if (tile.nvgImage != 0) {
+                NVGpaint paint = nvgImagePattern(vg, drawX, yPos, drawW, tileDisplayH,
+                                                  0, tile.nvgImage, 1.0f);
+                nvgFillPaint(vg, paint);
+            } else {
+                // Placeholder until the tile's upload comes around
+                nvgFillColor(vg, placeholder);
+                if (!tile.uploaded && m_visiblePendingTile < 0 &&
+                    (!canTestVisibility || (yPos + tileDisplayH > 0.0f && yPos < screenH))) {
+                    m_visiblePendingTile = static_cast<int>(i);
+                }
+            }
             nvgFill(vg);
 
-            yPos += segDisplayH;
+            yPos += tileDisplayH;
+        }
+
+        // Rows a streaming decode has not delivered yet
+        if (yPos < drawY + drawH - 0.5f) {
+            nvgBeginPath(vg);
+            nvgRect(vg, drawX, yPos, drawW, drawY + drawH - yPos);
+            nvgFillColor(vg, placeholder);
+            nvgFill(vg);
         }
         nvgRestore(vg);
         return;
@@ -443,18 +728,37 @@ void RotatableImage::takeImageFrom(RotatableImage* source) {
     m_imageWidth = source->m_imageWidth;
     m_imageHeight = source->m_imageHeight;
 
-    // Transfer segments
-    m_segmentNvgImages = std::move(source->m_segmentNvgImages);
-    m_segmentSrcHeights = std::move(source->m_segmentSrcHeights);
+    // Transfer segment tiles, including any still waiting for upload
+    m_tiles = std::move(source->m_tiles);
+    m_segmentData = std::move(source->m_segmentData);
+    m_segmentTilesLeft = std::move(source->m_segmentTilesLeft);
+    m_pendingTiles = source->m_pendingTiles;
+    if (m_pendingTiles > 0) {
+        std::replace(s_tileStreamingImages.begin(), s_tileStreamingImages.end(), source, this);
+    }
     m_origWidth = source->m_origWidth;
     m_origHeight = source->m_origHeight;
+    m_streamId = source->m_streamId;
+    if (m_streamId != 0) s_openStreams[m_streamId] = this;
+    size_t residentBytes = source->m_residentBytes;
 
     // Clear the source without deleting handles (we own them now)
     source->m_nvgImage = 0;
+    source->m_tiles.clear();
+    source->m_segmentData.clear();
+    source->m_segmentTilesLeft.clear();
+    source->m_pendingTiles = 0;
+    source->m_visiblePendingTile = -1;
     source->m_imageWidth = 0;
     source->m_imageHeight = 0;
     source->m_origWidth = 0;
     source->m_origHeight = 0;
+    source->m_streamId = 0;
+    if (residentBytes > 0) {
+        TextureResidency::getInstance().untrack(source);
+        source->m_residentBytes = 0;
+        addResidentBytes(residentBytes);
+    }
 
     this->invalidate();
     source->invalidate();
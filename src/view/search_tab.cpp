@@ -602,13 +602,33 @@ void SearchTab::loadSources() {
         SuwayomiClient& client = SuwayomiClient::getInstance();
         std::vector<Source> sources;
 
-        if (client.fetchSourceList(sources)) {
+        // Draw the cached list right away if it is stale; the fresh one
+        // replaces it below only when the set of sources changed
+        auto staleShown = std::make_shared<bool>(false);
+        bool success = client.fetchSourceList(sources, [this, aliveWeak, staleShown](const std::vector<Source>& cached) {
+            brls::sync([this, cached, aliveWeak, staleShown]() {
+                auto alive = aliveWeak.lock();
+                if (!alive || !*alive) return;
+                hideLoadingIndicator();
+                m_sources = cached;
+                showSources();
+                *staleShown = true;
+            });
+        });
+
+        if (success) {
             brls::Logger::info("SearchTab: Got {} sources", sources.size());
 
-            brls::sync([this, sources, aliveWeak]() {
+            brls::sync([this, sources, aliveWeak, staleShown]() {
                 auto alive = aliveWeak.lock();
                 if (!alive || !*alive) return;
                 hideLoadingIndicator();
+                bool unchanged = *staleShown && m_sources.size() == sources.size() &&
+                    std::equal(m_sources.begin(), m_sources.end(), sources.begin(),
+                               [](const Source& a, const Source& b) {
+                                   return a.id == b.id && a.name == b.name && a.lang == b.lang;
+                               });
+                if (unchanged) return;
                 m_sources = sources;
                 showSources();
             });
@@ -625,7 +645,7 @@ void SearchTab::loadSources() {
                 }
             });
         }
-    });
+    }, std::weak_ptr<bool>(m_alive));
 }
 
 void SearchTab::filterSourcesByLanguage() {
@@ -2543,7 +2563,7 @@ void SearchTab::performSearch(const std::string& query) {
                 populateSearchResultsBySource();
             }
         });
-    });
+    }, std::weak_ptr<bool>(m_alive));
 }
 
 void SearchTab::performSourceSearch(int64_t sourceId, const std::string& query) {
@@ -2605,7 +2625,7 @@ void SearchTab::performSourceSearch(int64_t sourceId, const std::string& query)
                 brls::Application::giveFocus(m_backBtn);
             });
         }
-    });
+    }, std::weak_ptr<bool>(m_alive));
 }
 
 void SearchTab::onSourceSelected(const Source& source) {
@@ -9,10 +9,12 @@
 #include "app/application.hpp"
 #include "app/suwayomi_client.hpp"
 #include "app/downloads_manager.hpp"
+#include "app/mutation_outbox.hpp"
 #include "utils/library_cache.hpp"
 #include "utils/async.hpp"
 #include "utils/http_client.hpp"
 #include "utils/perf_overlay.hpp"
+#include "utils/perf_trace.hpp"
 #include <algorithm>
 #include <chrono>
 #include <ctime>
@@ -694,6 +696,7 @@ void SettingsTab::createAccountSection() {
                     }
 
                     // Sync offline reading progress to server
+                    MutationOutbox::getInstance().flush();
                     DownloadsManager& dm = DownloadsManager::getInstance();
                     if (!dm.getDownloads().empty()) {
                         brls::Logger::info("Reconnect: Syncing offline reading progress...");
@@ -918,9 +921,36 @@ void SettingsTab::createUISection() {
         Application::getInstance().getSettings().showPerfOverlay = value;
         PerfOverlay::getInstance().setEnabled(value);
         Application::getInstance().saveSettings();
-        brls::Application::notify(value ? "Perf overlay enabled" : "Perf overlay disabled");
+        if (value) {
+            brls::Application::notify("Perf overlay enabled");
+            return;
+        }
+        // Keep the frame statistics gathered while it was on
+        std::string path = platform::path("frame_stats.csv");
+        bool saved = PerfOverlay::getInstance().dumpStats(path);
+        brls::Application::notify(saved ? "Perf overlay disabled, stats saved to " + path
+                                        : "Perf overlay disabled");
     });
     m_contentBox->addView(perfToggle);
+
+    // Perf trace recording (not saved) - turning it off writes a Chrome trace
+    auto* traceToggle = new brls::BooleanCell();
+    traceToggle->init("Record Perf Trace", PerfTrace::getInstance().isRecording(), [](bool value) {
+        if (value) {
+            PerfTrace::getInstance().start();
+            brls::Application::notify("Perf trace recording");
+            return;
+        }
+        PerfTrace::getInstance().stop();
+        asyncRun([]() {
+            std::string path = platform::path("perf_trace.json");
+            bool ok = PerfTrace::getInstance().exportJson(path);
+            brls::sync([ok, path]() {
+                brls::Application::notify(ok ? "Perf trace saved to " + path : "Failed to save perf trace");
+            });
+        });
+    });
+    m_contentBox->addView(traceToggle);
 }
 
 void SettingsTab::createLibrarySection() {
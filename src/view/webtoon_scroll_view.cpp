@@ -7,6 +7,7 @@
 #include "app/application.hpp"
 #include "utils/image_loader.hpp"
 #include "utils/perf_overlay.hpp"
+#include "utils/texture_residency.hpp"
 #include <algorithm>
 #include <cmath>
 #include <map>
@@ -300,6 +301,17 @@ bool WebtoonScrollView::isFailedPage(int pageIndex) const {
     return m_failedPages.count(pageIndex) > 0;
 }
 
+size_t WebtoonScrollView::estimatePageTextureBytes(int pageIndex) const {
+    if (pageIndex < 0 || pageIndex >= static_cast<int>(m_pageHeights.size())) return 0;
+    if (isTransitionPage(pageIndex) || isFailedPage(pageIndex)) return 0;
+
+    // Reader textures are decoded close to display width, so the layout size
+    // (unrotated width x height) is a good estimate both before and after load.
+    float width = std::max(0.0f, m_viewWidth - (m_sidePadding * 2));
+    float height = std::max(0.0f, m_pageHeights[pageIndex]);
+    return static_cast<size_t>(width * height) * 4;
+}
+
 void WebtoonScrollView::setTransitionText(int pageIndex, const std::string& line1, const std::string& line2) {
     if (pageIndex < 0 || pageIndex >= static_cast<int>(m_pages.size())) return;
     TransitionInfo info;
@@ -496,25 +508,13 @@ void WebtoonScrollView::setPages(const std::vector<Page>& pages, float screenWid
     // Calculate available width after padding
     float availableWidth = screenWidth - (m_sidePadding * 2);
 
-    // For webtoons, we'll estimate heights based on typical aspect ratios
-    // Images will be FIT_WIDTH, so height depends on aspect ratio
-    // Default to 2:3 aspect ratio if unknown (will adjust when images load)
-    float defaultHeight = availableWidth * 1.5f;  // 2:3 aspect ratio
-
     m_totalHeight = 0.0f;
     m_pageHeights.clear();
     m_pageHeights.reserve(pages.size());
 
     // Create image containers for each page
     for (size_t i = 0; i < pages.size(); i++) {
-        float pageHeight;
-
-        if (isTransitionPage(static_cast<int>(i))) {
-            // Transition pages use a fixed smaller height
-            pageHeight = TRANSITION_PAGE_HEIGHT;
-        } else {
-            pageHeight = defaultHeight;
-        }
+        float pageHeight = initialPageHeight(pages[i], availableWidth);
 
         auto pageImg = std::make_shared<RotatableImage>();
         pageImg->setWidth(availableWidth);
@@ -611,7 +611,6 @@ void WebtoonScrollView::appendPages(const std::vector<Page>& pages) {
     if (pages.empty()) return;
 
     float availableWidth = m_viewWidth - (m_sidePadding * 2);
-    float defaultHeight = availableWidth * 1.5f;
 
     brls::Logger::info("WEBTOON_APPEND: start, adding {} pages, current total={}, scrollY={:.1f}, totalH={:.0f}",
                         pages.size(), m_pages.size(), m_scrollY, m_totalHeight);
@@ -623,9 +622,7 @@ void WebtoonScrollView::appendPages(const std::vector<Page>& pages) {
     int startIdx = static_cast<int>(m_pages.size());
 
     for (size_t i = 0; i < pages.size(); i++) {
-        const std::string& url = pages[i].imageUrl;
-        bool isTransition = url.compare(0, TRANSITION_PREFIX.size(), TRANSITION_PREFIX) == 0;
-        float pageHeight = isTransition ? TRANSITION_PAGE_HEIGHT : defaultHeight;
+        float pageHeight = initialPageHeight(pages[i], availableWidth);
 
         auto pageImg = std::make_shared<RotatableImage>();
         pageImg->setWidth(availableWidth);
@@ -669,7 +666,6 @@ void WebtoonScrollView::prependPages(const std::vector<Page>& pages) {
     if (pages.empty()) return;
 
     float availableWidth = m_viewWidth - (m_sidePadding * 2);
-    float defaultHeight = availableWidth * 1.5f;
 
     brls::Logger::info("WEBTOON_PREPEND: start, adding {} pages, current total={}, scrollY={:.1f}, totalH={:.0f}",
                         pages.size(), m_pages.size(), m_scrollY, m_totalHeight);
@@ -683,9 +679,7 @@ void WebtoonScrollView::prependPages(const std::vector<Page>& pages) {
     std::vector<float> newHeights;
 
     for (size_t i = 0; i < pages.size(); i++) {
-        const std::string& url = pages[i].imageUrl;
-        bool isTransition = url.compare(0, TRANSITION_PREFIX.size(), TRANSITION_PREFIX) == 0;
-        float pageHeight = isTransition ? TRANSITION_PAGE_HEIGHT : defaultHeight;
+        float pageHeight = initialPageHeight(pages[i], availableWidth);
 
         auto pageImg = std::make_shared<RotatableImage>();
         pageImg->setWidth(availableWidth);
@@ -971,6 +965,7 @@ void WebtoonScrollView::scrollToPage(int pageIndex) {
 void WebtoonScrollView::scrollByViewport(float fraction) {
     float viewSize = isHorizontalLayout() ? m_viewWidth : m_viewHeight;
     float scrollAmount = viewSize * fraction;
+    if (fraction != 0.0f) m_travelDirection = (fraction > 0.0f) ? 1 : -1;
 
     m_scrollY -= scrollAmount;
 
@@ -1191,6 +1186,88 @@ bool WebtoonScrollView::isPageVisible(int pageIndex) const {
     return (pageEnd > visibleStart && pageStart < visibleEnd);
 }
 
+float WebtoonScrollView::initialPageHeight(const Page& page, float availableWidth) const {
+    if (page.imageUrl.compare(0, TRANSITION_PREFIX.size(), TRANSITION_PREFIX) == 0) {
+        // Transition pages use a fixed smaller height
+        return TRANSITION_PAGE_HEIGHT;
+    }
+    if (page.width > 0 && page.height > 0) {
+        return availableWidth * static_cast<float>(page.height) / static_cast<float>(page.width);
+    }
+    // Images are FIT_WIDTH, so height depends on aspect ratio: assume 2:3
+    return availableWidth * 1.5f;
+}
+
+void WebtoonScrollView::resizePage(int pageIndex, float newHeight) {
+    if (pageIndex < 0 || pageIndex >= static_cast<int>(m_pageHeights.size())) return;
+
+    float oldHeight = m_pageHeights[pageIndex];
+    float heightDelta = newHeight - oldHeight;
+    if (std::abs(heightDelta) <= 0.5f) return;
+
+    float pageStart = getPageOffset(pageIndex);
+    float visibleTop = -m_scrollY;
+
+    m_totalHeight += heightDelta;
+    m_pageHeights[pageIndex] = newHeight;
+    invalidateOffsetCache();
+
+    // Compensate scroll for pages above the user's reading
+    // position so visible content stays pinned in place.
+    //
+    // Use anchor-page check when available (after prepend/append)
+    // to avoid cascading drift: only pages before the anchor
+    // get compensation. Otherwise fall back to position check.
+    bool shouldAdjust = false;
+    if (m_anchorPage >= 0) {
+        shouldAdjust = (pageIndex < m_anchorPage);
+    } else {
+        shouldAdjust = (pageStart < visibleTop);
+    }
+
+    if (shouldAdjust) {
+        // In horizontal layout, scroll is in effective-size
+        // space (height * availableH/availableW), not raw height.
+        float scrollDelta = heightDelta;
+        if (isHorizontalLayout()) {
+            float aw = m_viewWidth - (m_sidePadding * 2);
+            float ah = m_viewHeight - (m_sidePadding * 2);
+            if (aw > 0) scrollDelta = heightDelta * (ah / aw);
+        }
+        m_scrollY -= scrollDelta;
+        brls::Logger::info("WEBTOON_HEIGHT: page {} (anchor={}, start={:.0f}, visTop={:.0f}), scroll adjusted by {:.1f} (hDelta={:.1f})",
+                            pageIndex, m_anchorPage, pageStart, visibleTop, -scrollDelta, heightDelta);
+    } else {
+        brls::Logger::info("WEBTOON_HEIGHT: page {} below anchor/viewport (anchor={}, start={:.0f} visTop={:.0f}), delta={:.1f}, no adjust",
+                            pageIndex, m_anchorPage, pageStart, visibleTop, heightDelta);
+    }
+}
+
+void WebtoonScrollView::setPageSizes(const std::map<std::string, std::pair<int, int>>& sizes) {
+    if (sizes.empty() || m_pages.empty()) return;
+
+    float availableWidth = m_viewWidth - (m_sidePadding * 2);
+    int applied = 0;
+    for (int i = 0; i < static_cast<int>(m_pages.size()); i++) {
+        Page& page = m_pages[i];
+        if (page.width > 0 && page.height > 0) continue;
+        auto it = sizes.find(page.imageUrl);
+        if (it == sizes.end() || it->second.first <= 0 || it->second.second <= 0) continue;
+
+        page.width = it->second.first;
+        page.height = it->second.second;
+        if (m_loadedPages.count(i) || m_failedPages.count(i)) continue;
+        resizePage(i, initialPageHeight(page, availableWidth));
+        applied++;
+    }
+
+    if (applied > 0) {
+        brls::Logger::debug("WebtoonScrollView: Applied {} probed page sizes", applied);
+        updateVisibleImages();
+        updateCurrentPage();
+    }
+}
+
 void WebtoonScrollView::updateVisibleImages() {
     if (m_pages.empty()) return;
 
@@ -1221,16 +1298,69 @@ void WebtoonScrollView::updateVisibleImages() {
         return;  // No visible pages
     }
 
-    // Expand range for preloading
-    int loadStart = std::max(0, firstVisible - PRELOAD_PAGES);
-    int loadEnd = std::min(static_cast<int>(m_pages.size()) - 1, lastVisible + PRELOAD_PAGES);
+    // Follow the direction of travel (negative velocity scrolls towards the end)
+    if (m_scrollVelocity < -MOMENTUM_MIN_VELOCITY) {
+        m_travelDirection = 1;
+    } else if (m_scrollVelocity > MOMENTUM_MIN_VELOCITY) {
+        m_travelDirection = -1;
+    }
+    const int dir = m_travelDirection;
+
+    // Look-ahead distance: at least one screen, plus however far the reader
+    // will scroll while a page loads. Velocity is in px per 60fps frame.
+    float speed = std::abs(m_scrollVelocity);
+    float latencyFrames = ImageLoader::getAverageFullSizeLoadMs() / 16.67f;
+    float travel = speed * latencyFrames * PREFETCH_LATENCY_MARGIN;
+    if (!m_isTouching) {
+        // A fling decays geometrically and can't cover more than v / (1 - friction)
+        travel = std::min(travel, speed / (1.0f - MOMENTUM_FRICTION));
+    }
+    float lookahead = std::min(viewSize * PREFETCH_MAX_SCREENS, viewSize * PREFETCH_MIN_SCREENS + travel);
+
+    // Visible pages always load; prefetch pages ahead until the look-ahead
+    // distance or the VRAM budget runs out (always at least one page ahead).
+    const size_t prefetchBudget = static_cast<size_t>(
+        TextureResidency::getInstance().getStats().budgetBytes * PREFETCH_BUDGET_SHARE);
+    size_t budgetUsed = 0;
+    for (int i = firstVisible; i <= lastVisible; i++) {
+        budgetUsed += estimatePageTextureBytes(i);
+    }
+    const int leadEdge = (dir > 0) ? lastVisible : firstVisible;
+    const int trailEdge = (dir > 0) ? firstVisible : lastVisible;
+    int aheadEnd = leadEdge;
+    for (int next = leadEdge + dir; next >= 0 && next < n; next += dir) {
+        float distance = (dir > 0) ? m_offsetCache[next] - visibleEnd
+                                   : visibleStart - m_offsetCache[next + 1];
+        if (distance > lookahead) break;
+        size_t bytes = estimatePageTextureBytes(next);
+        if (aheadEnd != leadEdge && budgetUsed + bytes > prefetchBudget) break;
+        budgetUsed += bytes;
+        aheadEnd = next;
+    }
+
+    // Queue visible pages first, then prefetch nearest-first in travel order
+    std::vector<int> loadOrder;
+    loadOrder.reserve(lastVisible - firstVisible + 1 + std::abs(aheadEnd - leadEdge));
+    for (int i = trailEdge; i != leadEdge + dir; i += dir) {
+        loadOrder.push_back(i);
+    }
+    for (int i = leadEdge + dir; i != aheadEnd + dir; i += dir) {
+        loadOrder.push_back(i);
+    }
 
     // Capture alive flag for async callbacks
     std::weak_ptr<bool> aliveWeak = m_alive;
 
     // Load pages in range
-    for (int i = loadStart; i <= loadEnd; i++) {
+    for (int i : loadOrder) {
+        // TextureResidency may have evicted a loaded page; load it again
+        if (m_loadedPages.count(i) > 0 && !isTransitionPage(i) &&
+            m_pageImages[i] && !m_pageImages[i]->hasImage()) {
+            m_loadedPages.erase(i);
+        }
         if (m_loadedPages.count(i) > 0 || m_loadingPages.count(i) > 0) {
+            // Prefetched pages aren't drawn yet; keep them off the LRU tail
+            if (m_pageImages[i]) m_pageImages[i]->touchResidency();
             continue;  // Already loaded or loading
         }
 
@@ -1289,51 +1419,8 @@ void WebtoonScrollView::updateVisibleImages() {
                     if (imageWidth > 0 && imageHeight > 0) {
                         float availableWidth = m_viewWidth - (m_sidePadding * 2);
                         float aspectRatio = imageHeight / imageWidth;
-                        float newHeight = availableWidth * aspectRatio;
-
-                        float oldHeight = m_pageHeights[pageIndex];
-                        float heightDelta = newHeight - oldHeight;
-
-                        if (std::abs(heightDelta) > 0.5f) {
-                            float pageStart = getPageOffset(pageIndex);
-                            float visibleTop = -m_scrollY;
-                            float viewSize = isHorizontalLayout() ? m_viewWidth : m_viewHeight;
-                            float visibleBottom = visibleTop + viewSize;
-
-                            m_totalHeight += heightDelta;
-                            m_pageHeights[pageIndex] = newHeight;
-                            invalidateOffsetCache();
-
-                            // Compensate scroll for pages above the user's reading
-                            // position so visible content stays pinned in place.
-                            //
-                            // Use anchor-page check when available (after prepend/append)
-                            // to avoid cascading drift: only pages before the anchor
-                            // get compensation. Otherwise fall back to position check.
-                            bool shouldAdjust = false;
-                            if (m_anchorPage >= 0) {
-                                shouldAdjust = (pageIndex < m_anchorPage);
-                            } else {
-                                shouldAdjust = (pageStart < visibleTop);
-                            }
-
-                            if (shouldAdjust) {
-                                // In horizontal layout, scroll is in effective-size
-                                // space (height * availableH/availableW), not raw height.
-                                float scrollDelta = heightDelta;
-                                if (isHorizontalLayout()) {
-                                    float aw = m_viewWidth - (m_sidePadding * 2);
-                                    float ah = m_viewHeight - (m_sidePadding * 2);
-                                    if (aw > 0) scrollDelta = heightDelta * (ah / aw);
-                                }
-                                m_scrollY -= scrollDelta;
-                                brls::Logger::info("WEBTOON_HEIGHT: page {} (anchor={}, start={:.0f}, visTop={:.0f}), scroll adjusted by {:.1f} (hDelta={:.1f})",
-                                                    pageIndex, m_anchorPage, pageStart, visibleTop, -scrollDelta, heightDelta);
-                            } else {
-                                brls::Logger::info("WEBTOON_HEIGHT: page {} below anchor/viewport (anchor={}, start={:.0f} visTop={:.0f}), delta={:.1f}, no adjust",
-                                                    pageIndex, m_anchorPage, pageStart, visibleTop, heightDelta);
-                            }
-                        }
+                        // No-op when the size was known up front
+                        resizePage(pageIndex, availableWidth * aspectRatio);
                     }
                 } else {
                     // Image load failed - mark as failed for retry
@@ -1374,8 +1461,20 @@ void WebtoonScrollView::updateVisibleImages() {
     // This is important when multiple chapters accumulate via append/prepend
     // Iterate m_loadedPages (small set, typically ~10 entries) instead of all
     // pages to avoid O(n) per-frame cost with 170+ pages across chapters.
-    int keepStart = std::max(0, firstVisible - UNLOAD_PAGES);
-    int keepEnd = std::min(static_cast<int>(m_pages.size()) - 1, lastVisible + UNLOAD_PAGES);
+    // Keep one extra page ahead as hysteresis against load/unload thrash at
+    // the window edge; pages behind are kept nearest-first with the budget
+    // left after the visible and prefetch pages.
+    int aheadKeep = std::max(0, std::min(n - 1, aheadEnd + dir));
+    int behindKeep = trailEdge;
+    size_t retained = budgetUsed;
+    for (int i = trailEdge - dir; i >= 0 && i < n; i -= dir) {
+        size_t bytes = estimatePageTextureBytes(i);
+        if (retained + bytes > prefetchBudget) break;
+        retained += bytes;
+        behindKeep = i;
+    }
+    int keepStart = std::min(aheadKeep, behindKeep);
+    int keepEnd = std::max(aheadKeep, behindKeep);
 
     // Collect pages to unload (can't erase from set while iterating)
     std::vector<int> toUnload;
@@ -1483,8 +1582,8 @@ void WebtoonScrollView::updateCurrentPage() {
 void WebtoonScrollView::draw(NVGcontext* vg, float x, float y, float width, float height,
                               brls::Style style, brls::FrameContext* ctx) {
     auto& perf = PerfOverlay::getInstance();
-    perf.endFrame();
-    perf.beginFrame();
+    perf.endFrame(PerfScreen::WEBTOON);
+    perf.beginFrame(PerfScreen::WEBTOON);
     PERF_BEGIN("webtoon_draw");
 
     // Update view dimensions